@@ -11,7 +11,6 @@ SOURCES += \
     $$PWD/boxplotanimation.cpp \
     $$PWD/boxwhiskersanimation.cpp \
     $$PWD/candlestickanimation.cpp \
-    $$PWD/candlestickbodywicksanimation.cpp \
     $$PWD/chartanimation.cpp
 
 PRIVATE_HEADERS += \
@@ -25,5 +24,4 @@ PRIVATE_HEADERS += \
     $$PWD/scatteranimation_p.h \
     $$PWD/boxplotanimation_p.h \
     $$PWD/boxwhiskersanimation_p.h \
-    $$PWD/candlestickanimation_p.h \
-    $$PWD/candlestickbodywicksanimation_p.h
+    $$PWD/candlestickanimation_p.h
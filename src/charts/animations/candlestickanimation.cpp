@@ -27,88 +27,63 @@
 **
 ****************************************************************************/
 
-#include <private/candlestick_p.h>
 #include <private/candlestickanimation_p.h>
-#include <private/candlestickbodywicksanimation_p.h>
 #include <private/candlestickchartitem_p.h>
-#include <private/candlestickdata_p.h>
+
+Q_DECLARE_METATYPE(QVector<QT_CHARTS_NAMESPACE::CandlestickData>)
 
 QT_CHARTS_BEGIN_NAMESPACE
 
 CandlestickAnimation::CandlestickAnimation(CandlestickChartItem *item, int duration,
                                            QEasingCurve &curve)
-    : QObject(item),
-      m_item(item),
-      m_animationDuration(duration),
-      m_animationCurve(curve)
+    : ChartAnimation(item),
+      m_item(item)
 {
+    setDuration(duration);
+    setEasingCurve(curve);
 }
 
 CandlestickAnimation::~CandlestickAnimation()
 {
 }
 
-void CandlestickAnimation::addCandlestick(Candlestick *candlestick)
-{
-    CandlestickBodyWicksAnimation *animation = m_animations.value(candlestick, 0);
-    if (!animation) {
-        animation = new CandlestickBodyWicksAnimation(candlestick, this, m_animationDuration,
-                                                      m_animationCurve);
-        m_animations.insert(candlestick, animation);
-
-        qreal median = (candlestick->m_data.m_open + candlestick->m_data.m_close) / 2;
-        CandlestickData start;
-        start.m_open = median;
-        start.m_high = median;
-        start.m_low = median;
-        start.m_close = median;
-        animation->setup(start, candlestick->m_data);
-    } else {
-        animation->stop();
-        animation->setEndData(candlestick->m_data);
-    }
-}
-
-ChartAnimation *CandlestickAnimation::candlestickAnimation(Candlestick *candlestick)
+QVariant CandlestickAnimation::interpolated(const QVariant &from, const QVariant &to,
+                                            qreal progress) const
 {
-    CandlestickBodyWicksAnimation *animation = m_animations.value(candlestick, 0);
-    if (animation)
-        animation->m_changeAnimation = false;
+    const QVector<CandlestickData> startVector = qvariant_cast<QVector<CandlestickData> >(from);
+    const QVector<CandlestickData> endVector = qvariant_cast<QVector<CandlestickData> >(to);
+    QVector<CandlestickData> result(endVector.count());
 
-    return animation;
-}
+    Q_ASSERT(startVector.count() == endVector.count());
 
-ChartAnimation *CandlestickAnimation::candlestickChangeAnimation(Candlestick *candlestick)
-{
-    CandlestickBodyWicksAnimation *animation = m_animations.value(candlestick, 0);
-    if (animation) {
-        animation->m_changeAnimation = true;
-        animation->setEndData(candlestick->m_data);
+    for (int i = 0; i < endVector.count(); i++) {
+        const CandlestickData &start = startVector.at(i);
+        const CandlestickData &end = endVector.at(i);
+        CandlestickData &value = result[i];
+        value.m_timestamp = end.m_timestamp;
+        value.m_open = start.m_open + progress * (end.m_open - start.m_open);
+        value.m_high = start.m_high + progress * (end.m_high - start.m_high);
+        value.m_low = start.m_low + progress * (end.m_low - start.m_low);
+        value.m_close = start.m_close + progress * (end.m_close - start.m_close);
     }
-
-    return animation;
-}
-
-void CandlestickAnimation::setAnimationStart(Candlestick *candlestick)
-{
-    CandlestickBodyWicksAnimation *animation = m_animations.value(candlestick, 0);
-    if (animation)
-        animation->setStartData(candlestick->m_data);
+    return qVariantFromValue(result);
 }
 
-void CandlestickAnimation::stopAll()
+void CandlestickAnimation::updateCurrentValue(const QVariant &value)
 {
-    foreach (Candlestick *candlestick, m_animations.keys()) {
-        CandlestickBodyWicksAnimation *animation = m_animations.value(candlestick, 0);
-        if (animation)
-            animation->stopAndDestroyLater();
-        m_animations.remove(candlestick);
+    if (state() != QAbstractAnimation::Stopped) { //workaround
+        QVector<CandlestickData> layout = qvariant_cast<QVector<CandlestickData> >(value);
+        m_item->setLayout(layout);
     }
 }
 
-void CandlestickAnimation::removeCandlestickAnimation(Candlestick *candlestick)
+void CandlestickAnimation::setup(const QVector<CandlestickData> &oldLayout,
+                                 const QVector<CandlestickData> &newLayout)
 {
-    m_animations.remove(candlestick);
+    QVariantAnimation::KeyValues value;
+    setKeyValues(value); //workaround for wrong interpolation call
+    setKeyValueAt(0.0, qVariantFromValue(oldLayout));
+    setKeyValueAt(1.0, qVariantFromValue(newLayout));
 }
 
 #include "moc_candlestickanimation_p.cpp"
@@ -40,15 +40,14 @@
 #define CANDLESTICKANIMATION_P_H
 
 #include <private/chartanimation_p.h>
+#include <private/candlestickdata_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-class Candlestick;
 class CandlestickChartItem;
-class CandlestickBodyWicksAnimation;
 
-class QT_CHARTS_PRIVATE_EXPORT CandlestickAnimation : public QObject
+class QT_CHARTS_PRIVATE_EXPORT CandlestickAnimation : public ChartAnimation
 {
     Q_OBJECT
 
@@ -56,19 +55,14 @@ public:
     CandlestickAnimation(CandlestickChartItem *item, int duration, QEasingCurve &curve);
     ~CandlestickAnimation();
 
-    void addCandlestick(Candlestick *candlestick);
-    ChartAnimation *candlestickAnimation(Candlestick *candlestick);
-    ChartAnimation *candlestickChangeAnimation(Candlestick *candlestick);
+public: // from QVariantAnimation
+    virtual QVariant interpolated(const QVariant &from, const QVariant &to, qreal progress) const;
+    virtual void updateCurrentValue(const QVariant &value);
 
-    void setAnimationStart(Candlestick *candlestick);
-    void stopAll();
-    void removeCandlestickAnimation(Candlestick *candlestick);
+    void setup(const QVector<CandlestickData> &oldLayout, const QVector<CandlestickData> &newLayout);
 
 protected:
-    QHash<Candlestick *, CandlestickBodyWicksAnimation *> m_animations;
     CandlestickChartItem *m_item;
-    int m_animationDuration;
-    QEasingCurve m_animationCurve;
 };
 
 QT_CHARTS_END_NAMESPACE
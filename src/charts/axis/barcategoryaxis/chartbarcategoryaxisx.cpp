@@ -73,16 +73,18 @@ QVector<qreal> ChartBarCategoryAxisX::calculateLayout() const
     return points;
 }
 
-QStringList ChartBarCategoryAxisX::createCategoryLabels(const QVector<qreal>& layout) const
+QStringList ChartBarCategoryAxisX::createCategoryLabels(const QVector<qreal>& layout, int stride) const
 {
     QStringList result ;
     const QRectF &gridRect = gridGeometry();
     qreal d = (max() - min()) / gridRect.width();
+    const QStringList categories = m_categoriesAxis->categories();
 
     for (int i = 0; i < layout.count() - 1; ++i) {
-        qreal x = qFloor((((layout[i] + layout[i + 1]) / 2 - gridRect.left()) * d + min() + 0.5));
-        if (x < max() && (x >= 0) && x < m_categoriesAxis->categories().count()) {
-            result << m_categoriesAxis->categories().at(x);
+        int x = qFloor((((layout[i] + layout[i + 1]) / 2 - gridRect.left()) * d + min() + 0.5));
+        if (x < max() && (x >= 0) && x < categories.count()) {
+            // thinned out labels are left empty, which keeps them cheap to lay out
+            result << (x % stride ? QString() : categories.at(x));
         } else {
             // No label for x coordinate
             result << QString();
@@ -98,7 +100,14 @@ void ChartBarCategoryAxisX::updateGeometry()
     const QVector<qreal>& layout = ChartAxisElement::layout();
     if (layout.isEmpty())
         return;
-    setLabels(createCategoryLabels(layout));
+
+    int first;
+    int last;
+    m_categoriesAxis->d_func()->visibleCategories(&first, &last);
+    const qreal spacing = gridGeometry().width() / (max() - min());
+    setLabelStride(calculateLabelStride(m_categoriesAxis->categories(), first, last, spacing));
+
+    setLabels(createCategoryLabels(layout, labelStride()));
     HorizontalAxis::updateGeometry();
 }
 
@@ -115,6 +124,9 @@ QSizeF ChartBarCategoryAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constra
     QSizeF sh;
     QSizeF base = HorizontalAxis::sizeHint(which, constraint);
     QStringList ticksList = m_categoriesAxis->categories();
+    int first;
+    int last;
+    m_categoriesAxis->d_func()->visibleCategories(&first, &last);
 
     qreal width = 0; // Width is irrelevant for X axes with interval labels
     qreal height = 0;
@@ -130,8 +142,10 @@ QSizeF ChartBarCategoryAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constra
         }
         case Qt::PreferredSize:{
             qreal labelHeight = 0.0;
-            foreach (const QString& s, ticksList) {
-                QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
+            // only categories within the axis range are shown, so only those are measured
+            for (int i = first; i <= last; ++i) {
+                QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), ticksList.at(i),
+                                                               axis()->labelsAngle());
                 labelHeight = qMax(rect.height(), labelHeight);
             }
             height = labelHeight + labelPadding() + base.height() + 1.0;
@@ -73,16 +73,18 @@ QVector<qreal> ChartBarCategoryAxisY::calculateLayout() const
     return points;
 }
 
-QStringList ChartBarCategoryAxisY::createCategoryLabels(const QVector<qreal>& layout) const
+QStringList ChartBarCategoryAxisY::createCategoryLabels(const QVector<qreal>& layout, int stride) const
 {
     QStringList result;
     const QRectF &gridRect = gridGeometry();
     qreal d = (max() - min()) / gridRect.height();
+    const QStringList categories = m_categoriesAxis->categories();
 
     for (int i = 0; i < layout.count() - 1; ++i) {
-        qreal x = qFloor(((gridRect.height() - (layout[i + 1] + layout[i]) / 2 + gridRect.top()) * d + min() + 0.5));
-        if ((x < m_categoriesAxis->categories().count()) && (x >= 0)) {
-            result << m_categoriesAxis->categories().at(x);
+        int x = qFloor(((gridRect.height() - (layout[i + 1] + layout[i]) / 2 + gridRect.top()) * d + min() + 0.5));
+        if ((x < categories.count()) && (x >= 0)) {
+            // thinned out labels are left empty, which keeps them cheap to lay out
+            result << (x % stride ? QString() : categories.at(x));
         } else {
             // No label for x coordinate
             result << QString();
@@ -97,7 +99,14 @@ void ChartBarCategoryAxisY::updateGeometry()
     const QVector<qreal>& layout = ChartAxisElement::layout();
     if (layout.isEmpty())
         return;
-    setLabels(createCategoryLabels(layout));
+
+    int first;
+    int last;
+    m_categoriesAxis->d_func()->visibleCategories(&first, &last);
+    const qreal spacing = gridGeometry().height() / (max() - min());
+    setLabelStride(calculateLabelStride(m_categoriesAxis->categories(), first, last, spacing));
+
+    setLabels(createCategoryLabels(layout, labelStride()));
     VerticalAxis::updateGeometry();
 }
 
@@ -114,6 +123,9 @@ QSizeF ChartBarCategoryAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constra
     QSizeF sh;
     QSizeF base = VerticalAxis::sizeHint(which, constraint);
     QStringList ticksList = m_categoriesAxis->categories();
+    int first;
+    int last;
+    m_categoriesAxis->d_func()->visibleCategories(&first, &last);
     qreal width = 0;
     qreal height = 0; // Height is irrelevant for Y axes with interval labels
 
@@ -130,8 +142,10 @@ QSizeF ChartBarCategoryAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constra
         }
         case Qt::PreferredSize:{
             qreal labelWidth = 0.0;
-            foreach (const QString& s, ticksList) {
-                QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), s, axis()->labelsAngle());
+            // only categories within the axis range are shown, so only those are measured
+            for (int i = first; i <= last; ++i) {
+                QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), ticksList.at(i),
+                                                               axis()->labelsAngle());
                 labelWidth = qMax(rect.width(), labelWidth);
             }
             width = labelWidth + labelPadding() + base.width() + 1.0;
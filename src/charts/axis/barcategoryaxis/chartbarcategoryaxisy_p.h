@@ -59,7 +59,7 @@ protected:
     QVector<qreal> calculateLayout() const;
     void updateGeometry();
 private:
-    QStringList createCategoryLabels(const QVector<qreal>& layout) const;
+    QStringList createCategoryLabels(const QVector<qreal>& layout, int stride) const;
 public Q_SLOTS:
     void handleCategoriesChanged();
 private:
@@ -204,8 +204,12 @@ void QBarCategoryAxis::append(const QStringList &categories)
 
     int count = d->m_categories.count();
 
-    foreach(QString category, categories) {
-        if (!d->m_categories.contains(category) && !category.isNull()) {
+    d->m_categories.reserve(count + categories.count());
+    d->m_categoryIndex.reserve(count + categories.count());
+
+    foreach (const QString &category, categories) {
+        if (!category.isNull() && !d->m_categoryIndex.contains(category)) {
+            d->m_categoryIndex.insert(category, d->m_categories.count());
             d->m_categories.append(category);
         }
     }
@@ -236,8 +240,10 @@ void QBarCategoryAxis::append(const QString &category)
 
     int count = d->m_categories.count();
 
-    if (!d->m_categories.contains(category) && !category.isNull())
+    if (!category.isNull() && !d->m_categoryIndex.contains(category)) {
+        d->m_categoryIndex.insert(category, count);
         d->m_categories.append(category);
+    }
 
     if (d->m_categories.count() == count)
         return;
@@ -259,8 +265,12 @@ void QBarCategoryAxis::remove(const QString &category)
 {
     Q_D(QBarCategoryAxis);
 
-    if (d->m_categories.contains(category)) {
-        d->m_categories.removeAt(d->m_categories.indexOf(category));
+    int index = d->categoryIndex(category);
+
+    if (index != -1) {
+        d->m_categories.removeAt(index);
+        d->m_categoryIndex.remove(category);
+        d->reindexCategories(index);
         if (!d->m_categories.isEmpty()) {
             if (d->m_minCategory == category) {
                 setRange(d->m_categories.first(), d->m_maxCategory);
@@ -288,8 +298,10 @@ void QBarCategoryAxis::insert(int index, const QString &category)
 
     int count = d->m_categories.count();
 
-    if (!d->m_categories.contains(category) && !category.isNull())
+    if (!category.isNull() && !d->m_categoryIndex.contains(category)) {
         d->m_categories.insert(index, category);
+        d->reindexCategories(index);
+    }
 
     if (d->m_categories.count() == count)
         return;
@@ -318,10 +330,12 @@ void QBarCategoryAxis::replace(const QString &oldCategory, const QString &newCat
 {
     Q_D(QBarCategoryAxis);
 
-    int pos = d->m_categories.indexOf(oldCategory);
+    int pos = d->categoryIndex(oldCategory);
 
-    if (pos != -1 && !d->m_categories.contains(newCategory) && !newCategory.isNull()) {
+    if (pos != -1 && !newCategory.isNull() && !d->m_categoryIndex.contains(newCategory)) {
         d->m_categories.replace(pos, newCategory);
+        d->m_categoryIndex.remove(oldCategory);
+        d->m_categoryIndex.insert(newCategory, pos);
         if (d->m_minCategory == oldCategory)
             setRange(newCategory, d->m_maxCategory);
         else if (d->m_maxCategory == oldCategory)
@@ -339,6 +353,7 @@ void QBarCategoryAxis::clear()
 {
     Q_D(QBarCategoryAxis);
     d->m_categories.clear();
+    d->m_categoryIndex.clear();
     setRange(QString(), QString());
     emit categoriesChanged();
     emit countChanged();
@@ -354,6 +369,7 @@ void QBarCategoryAxis::setCategories(const QStringList &categories)
 {
     Q_D(QBarCategoryAxis);
     d->m_categories.clear();
+    d->m_categoryIndex.clear();
     d->m_minCategory = QString();
     d->m_maxCategory = QString();
     d->m_min = 0;
@@ -544,21 +560,24 @@ void  QBarCategoryAxisPrivate::setRange(const QString &minCategory, const QStrin
         return;
     }
 
-    if (m_categories.indexOf(maxCategory) < m_categories.indexOf(minCategory))
+    const int minIndex = categoryIndex(minCategory);
+    const int maxIndex = categoryIndex(maxCategory);
+
+    if (maxIndex < minIndex)
         return;
 
     if (!minCategory.isNull() && (m_minCategory != minCategory || m_minCategory.isNull())
-            && m_categories.contains(minCategory)) {
+            && minIndex != -1) {
         m_minCategory = minCategory;
-        m_min = m_categories.indexOf(m_minCategory) - 0.5;
+        m_min = minIndex - 0.5;
         changed = true;
         emit q->minChanged(minCategory);
     }
 
     if (!maxCategory.isNull() && (m_maxCategory != maxCategory || m_maxCategory.isNull())
-            && m_categories.contains(maxCategory)) {
+            && maxIndex != -1) {
         m_maxCategory = maxCategory;
-        m_max = m_categories.indexOf(m_maxCategory) + 0.5;
+        m_max = maxIndex + 0.5;
         changed = true;
         emit q->maxChanged(maxCategory);
     }
@@ -570,6 +589,19 @@ void  QBarCategoryAxisPrivate::setRange(const QString &minCategory, const QStrin
     }
 }
 
+// Nothing is visible if last ends up smaller than first
+void QBarCategoryAxisPrivate::visibleCategories(int *first, int *last) const
+{
+    *first = qMax(0, qFloor(m_min + 0.5));
+    *last = qMin(m_categories.count() - 1, qCeil(m_max - 0.5));
+}
+
+void QBarCategoryAxisPrivate::reindexCategories(int from)
+{
+    for (int i = from; i < m_categories.count(); ++i)
+        m_categoryIndex[m_categories.at(i)] = i;
+}
+
 void QBarCategoryAxisPrivate::initializeGraphics(QGraphicsItem* parent)
 {
     Q_Q(QBarCategoryAxis);
@@ -587,12 +619,12 @@ void QBarCategoryAxisPrivate::updateCategoryDomain()
 {
     bool changed = false;
 
-    qreal tmpMin = m_categories.indexOf(m_minCategory) - 0.5;
+    qreal tmpMin = categoryIndex(m_minCategory) - 0.5;
     if (!qFuzzyIsNull(m_min - tmpMin)) {
         m_min = tmpMin;
         changed = true;
     }
-    qreal tmpMax = m_categories.indexOf(m_maxCategory) + 0.5;
+    qreal tmpMax = categoryIndex(m_maxCategory) + 0.5;
     if (!qFuzzyIsNull(m_max - tmpMax)) {
         m_max = tmpMax;
         changed = true;
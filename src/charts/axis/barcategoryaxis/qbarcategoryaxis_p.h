@@ -42,6 +42,7 @@
 #include <QtCharts/QBarCategoryAxis>
 #include <private/qabstractaxis_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QHash>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -70,12 +71,18 @@ public:
     qreal max() { return m_max; }
     void setRange(qreal min,qreal max);
 
+    //category lookup
+    int categoryIndex(const QString &category) const { return m_categoryIndex.value(category, -1); }
+    void visibleCategories(int *first, int *last) const;
+
 private:
     //range handling
     void setRange(const QString &minCategory, const QString &maxCategory);
+    void reindexCategories(int from);
 
 private:
     QStringList m_categories;
+    QHash<QString, int> m_categoryIndex;
     QString m_minCategory;
     QString m_maxCategory;
     qreal m_min;
@@ -42,8 +42,19 @@
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Number of hidden items kept for reuse on top of the active ones
+static const int minimumPoolSize = 16;
+
+// Interval axes and every other tick get a shade, see createItems()
+static inline int shadeItemCount(int gridItemCount)
+{
+    return gridItemCount > 0 ? 1 + gridItemCount / 2 : 0;
+}
+
 CartesianChartAxis::CartesianChartAxis(QAbstractAxis *axis, QGraphicsItem *item , bool intervalAxis)
-    : ChartAxisElement(axis, item, intervalAxis)
+    : ChartAxisElement(axis, item, intervalAxis),
+      m_tickItemCount(0),
+      m_minorTickItemCount(0)
 {
     Q_ASSERT(item);
 }
@@ -78,7 +89,10 @@ void CartesianChartAxis::createItems(int count)
     title->setDefaultTextColor(axis()->titleBrush().color());
     title->setHtml(axis()->titleText());
 
-    for (int i = 0; i < count; ++i) {
+    // Only allocate what the pool of hidden items cannot provide
+    const int tickCount = m_tickItemCount + count;
+    int gridCount = gridItems().size();
+    for (int i = labelItems().size(); i < tickCount; ++i) {
         QGraphicsLineItem *arrow = new QGraphicsLineItem(this);
         QGraphicsLineItem *grid = new QGraphicsLineItem(this);
         QGraphicsTextItem *label = new QGraphicsTextItem(this);
@@ -92,22 +106,81 @@ void CartesianChartAxis::createItems(int count)
         gridGroup()->addToGroup(grid);
         labelGroup()->addToGroup(label);
 
-        if (gridItems().size() == 1 || (((gridItems().size() + 1) % 2) && gridItems().size() > 0)) {
+        ++gridCount;
+        if (shadeItemCount(gridCount) > shadeItemCount(gridCount - 1)) {
             QGraphicsRectItem *shades = new QGraphicsRectItem(this);
             shades->setPen(axis()->shadesPen());
             shades->setBrush(axis()->shadesBrush());
             shadeGroup()->addToGroup(shades);
         }
     }
+
+    setTickItemCount(tickCount);
+}
+
+void CartesianChartAxis::deleteItems(int count)
+{
+    setTickItemCount(m_tickItemCount - count);
+    trimItemPool();
+}
+
+// Shows the first count tick items and hides the rest. The layout code indexes the item
+// lists directly, so active items always come first.
+void CartesianChartAxis::setTickItemCount(int count)
+{
+    const int extraGridCount = intervalAxis() ? 2 : 0;
+    const int from = qMin(count, m_tickItemCount);
+    const int to = qMax(count, m_tickItemCount);
+
+    QList<QGraphicsItem *> arrows = arrowItems();
+    QList<QGraphicsItem *> lines = gridItems();
+    QList<QGraphicsItem *> labels = labelItems();
+    QList<QGraphicsItem *> shades = shadeItems();
+
+    for (int i = from; i < to; ++i) {
+        const bool visible = i < count;
+        arrows.at(i + 1)->setVisible(visible);
+        lines.at(i + extraGridCount)->setVisible(visible);
+        labels.at(i)->setVisible(visible);
+    }
+
+    const int activeShades = shadeItemCount(count + extraGridCount);
+    for (int i = shadeItemCount(from + extraGridCount); i < shadeItemCount(to + extraGridCount); ++i)
+        shades.at(i)->setVisible(i < activeShades);
+
+    m_tickItemCount = count;
+}
+
+// Keeps the number of hidden tick items bounded after the tick count drops sharply
+void CartesianChartAxis::trimItemPool()
+{
+    QList<QGraphicsItem *> labels = labelItems();
+    const int poolSize = qMax(m_tickItemCount, minimumPoolSize);
+    if (labels.size() - m_tickItemCount <= poolSize)
+        return;
+
+    QList<QGraphicsItem *> lines = gridItems();
+    QList<QGraphicsItem *> shades = shadeItems();
+    QList<QGraphicsItem *> arrows = arrowItems();
+
+    const int tickCount = m_tickItemCount + poolSize;
+    const int extraGridCount = intervalAxis() ? 2 : 0;
+    while (shades.size() > shadeItemCount(tickCount + extraGridCount))
+        delete shades.takeLast();
+    while (labels.size() > tickCount) {
+        delete lines.takeLast();
+        delete labels.takeLast();
+        delete arrows.takeLast();
+    }
 }
 
-void CartesianChartAxis::updateMinorTickItems()
+void CartesianChartAxis::updateMinorTickItems(int tickCount)
 {
     int currentCount = minorArrowItems().size();
     int expectedCount = 0;
     if (axis()->type() == QAbstractAxis::AxisTypeValue) {
         QValueAxis *valueAxis = qobject_cast<QValueAxis *>(axis());
-        expectedCount = valueAxis->minorTickCount() * (valueAxis->tickCount() - 1);
+        expectedCount = valueAxis->minorTickCount() * (tickCount - 1);
         expectedCount = qMax(expectedCount, 0);
     } else if (axis()->type() == QAbstractAxis::AxisTypeLogValue) {
         QLogValueAxis *logValueAxis = qobject_cast<QLogValueAxis *>(axis());
@@ -123,43 +196,29 @@ void CartesianChartAxis::updateMinorTickItems()
         return;
     }
 
-    int diff = expectedCount - currentCount;
-    if (diff > 0) {
-        for (int i = 0; i < diff; ++i) {
-            QGraphicsLineItem *minorGridLineItem = new QGraphicsLineItem(this);
-            minorGridLineItem->setPen(axis()->minorGridLinePen());
-            minorGridGroup()->addToGroup(minorGridLineItem);
+    // Reuse hidden items first, like the major tick items
+    for (int i = currentCount; i < expectedCount; ++i) {
+        QGraphicsLineItem *minorGridLineItem = new QGraphicsLineItem(this);
+        minorGridLineItem->setPen(axis()->minorGridLinePen());
+        minorGridGroup()->addToGroup(minorGridLineItem);
 
-            QGraphicsLineItem *minorArrowLineItem = new QGraphicsLineItem(this);
-            minorArrowLineItem->setPen(axis()->linePen());
-            minorArrowGroup()->addToGroup(minorArrowLineItem);
-        }
-    } else {
-        QList<QGraphicsItem *> minorGridItemsList = minorGridItems();
-        QList<QGraphicsItem *> minorArrowItemsList = minorArrowItems();
-        for (int i = 0; i > diff; --i) {
-            if (!minorGridItemsList.isEmpty())
-                delete minorGridItemsList.takeLast();
-
-            if (!minorArrowItemsList.isEmpty())
-                delete minorArrowItemsList.takeLast();
-        }
+        QGraphicsLineItem *minorArrowLineItem = new QGraphicsLineItem(this);
+        minorArrowLineItem->setPen(axis()->linePen());
+        minorArrowGroup()->addToGroup(minorArrowLineItem);
     }
-}
 
-void CartesianChartAxis::deleteItems(int count)
-{
-    QList<QGraphicsItem *> lines = gridItems();
-    QList<QGraphicsItem *> labels = labelItems();
-    QList<QGraphicsItem *> shades = shadeItems();
-    QList<QGraphicsItem *> axis = arrowItems();
-
-    for (int i = 0; i < count; ++i) {
-        if (lines.size() == 1 || (((lines.size() + 1) % 2) && lines.size() > 0))
-            delete(shades.takeLast());
-        delete(lines.takeLast());
-        delete(labels.takeLast());
-        delete(axis.takeLast());
+    QList<QGraphicsItem *> minorGridItemsList = minorGridItems();
+    QList<QGraphicsItem *> minorArrowItemsList = minorArrowItems();
+    for (int i = qMin(expectedCount, m_minorTickItemCount); i < qMax(expectedCount, m_minorTickItemCount); ++i) {
+        minorGridItemsList.at(i)->setVisible(i < expectedCount);
+        minorArrowItemsList.at(i)->setVisible(i < expectedCount);
+    }
+    m_minorTickItemCount = expectedCount;
+
+    const int poolSize = qMax(expectedCount, minimumPoolSize);
+    while (minorArrowItemsList.size() - expectedCount > poolSize) {
+        delete minorGridItemsList.takeLast();
+        delete minorArrowItemsList.takeLast();
     }
 }
 
@@ -172,7 +231,7 @@ void CartesianChartAxis::updateLayout(QVector<qreal> &layout)
     else if (diff <= 0)
         createItems(-diff);
 
-    updateMinorTickItems();
+    updateMinorTickItems(layout.size());
 
     if (animation()) {
         switch (presenter()->state()) {
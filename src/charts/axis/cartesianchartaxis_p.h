@@ -80,10 +80,15 @@ public Q_SLOTS:
 private:
     void createItems(int count);
     void deleteItems(int count);
-    void updateMinorTickItems();
+    void setTickItemCount(int count);
+    void trimItemPool();
+    void updateMinorTickItems(int tickCount);
 
 private:
     QRectF m_gridRect;
+    // Items beyond the active counts are kept hidden for reuse instead of being deleted
+    int m_tickItemCount;
+    int m_minorTickItemCount;
 
     friend class AxisAnimation;
     friend class LineArrowItem;
@@ -29,6 +29,7 @@
 
 #include <private/chartcategoryaxisx_p.h>
 #include <QtCharts/QCategoryAxis>
+#include <private/qcategoryaxis_p.h>
 #include <QtCharts/QAbstractAxis>
 #include <private/chartpresenter_p.h>
 #include <private/abstractchartlayout_p.h>
@@ -50,7 +51,12 @@ ChartCategoryAxisX::~ChartCategoryAxisX()
 
 QVector<qreal> ChartCategoryAxisX::calculateLayout() const
 {
-    int tickCount = m_axis->categoriesLabels().count() + 1;
+    // Only the categories within the axis range get ticks and labels
+    const QVector<qreal> &boundaries = m_axis->d_func()->boundaries();
+    int first;
+    int last;
+    m_axis->d_func()->visibleCategories(min(), max(), &first, &last);
+    int tickCount = last - first + 2;
     QVector<qreal> points;
 
     if (tickCount < 2)
@@ -61,15 +67,8 @@ QVector<qreal> ChartCategoryAxisX::calculateLayout() const
     if (range > 0) {
         points.resize(tickCount);
         qreal scale = gridRect.width() / range;
-        for (int i = 0; i < tickCount; ++i) {
-            if (i < tickCount - 1) {
-                qreal x = (m_axis->startValue(m_axis->categoriesLabels().at(i)) - min()) * scale + gridRect.left();
-                points[i] = x;
-            } else {
-                qreal x = (m_axis->endValue(m_axis->categoriesLabels().at(i - 1)) - min())  * scale + gridRect.left();
-                points[i] = x;
-            }
-        }
+        for (int i = 0; i < tickCount; ++i)
+            points[i] = (boundaries.at(first + i) - min()) * scale + gridRect.left();
     }
 
     return points;
@@ -77,7 +76,22 @@ QVector<qreal> ChartCategoryAxisX::calculateLayout() const
 
 void ChartCategoryAxisX::updateGeometry()
 {
-    setLabels(m_axis->categoriesLabels() << QString());
+    const QVector<qreal> &layout = ChartAxisElement::layout();
+    int first;
+    int last;
+    m_axis->d_func()->visibleCategories(min(), max(), &first, &last);
+
+    QStringList labels = m_axis->categoriesLabels().mid(first, last - first + 1);
+    if (layout.size() > 1) {
+        // thin out labels that would overlap, assuming evenly spaced categories
+        const qreal spacing = qAbs(layout.last() - layout.first()) / (layout.size() - 1);
+        setLabelStride(calculateLabelStride(labels, 0, labels.size() - 1, spacing));
+        for (int i = 0; i < labels.size(); ++i) {
+            if ((first + i) % labelStride())
+                labels[i] = QString();
+        }
+    }
+    setLabels(labels << QString());
     HorizontalAxis::updateGeometry();
 }
 
@@ -87,7 +101,10 @@ QSizeF ChartCategoryAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constraint
 
     QSizeF sh;
     QSizeF base = HorizontalAxis::sizeHint(which, constraint);
-    QStringList ticksList = m_axis->categoriesLabels();
+    int first;
+    int last;
+    m_axis->d_func()->visibleCategories(min(), max(), &first, &last);
+    QStringList ticksList = m_axis->categoriesLabels().mid(first, last - first + 1);
     qreal width = 0; // Width is irrelevant for X axes with interval labels
     qreal height = 0;
 
@@ -29,6 +29,7 @@
 
 #include <private/chartcategoryaxisy_p.h>
 #include <QtCharts/QCategoryAxis>
+#include <private/qcategoryaxis_p.h>
 #include <QtCharts/QAbstractAxis>
 #include <private/chartpresenter_p.h>
 #include <private/abstractchartlayout_p.h>
@@ -51,7 +52,12 @@ ChartCategoryAxisY::~ChartCategoryAxisY()
 
 QVector<qreal> ChartCategoryAxisY::calculateLayout() const
 {
-    int tickCount = m_axis->categoriesLabels().count() + 1;
+    // Only the categories within the axis range get ticks and labels
+    const QVector<qreal> &boundaries = m_axis->d_func()->boundaries();
+    int first;
+    int last;
+    m_axis->d_func()->visibleCategories(min(), max(), &first, &last);
+    int tickCount = last - first + 2;
     QVector<qreal> points;
 
     if (tickCount < 2)
@@ -62,15 +68,8 @@ QVector<qreal> ChartCategoryAxisY::calculateLayout() const
     if (range > 0) {
         points.resize(tickCount);
         qreal scale = gridRect.height() / range;
-        for (int i = 0; i < tickCount; ++i) {
-            if (i < tickCount - 1) {
-                qreal y = -(m_axis->startValue(m_axis->categoriesLabels().at(i)) - min()) * scale + gridRect.bottom();
-                points[i] = y;
-            } else {
-                qreal y = -(m_axis->endValue(m_axis->categoriesLabels().at(i - 1)) - min())  * scale + gridRect.bottom();
-                points[i] = y;
-            }
-        }
+        for (int i = 0; i < tickCount; ++i)
+            points[i] = -(boundaries.at(first + i) - min()) * scale + gridRect.bottom();
     }
 
     return points;
@@ -78,7 +77,22 @@ QVector<qreal> ChartCategoryAxisY::calculateLayout() const
 
 void ChartCategoryAxisY::updateGeometry()
 {
-    setLabels(m_axis->categoriesLabels() << QString());
+    const QVector<qreal> &layout = ChartAxisElement::layout();
+    int first;
+    int last;
+    m_axis->d_func()->visibleCategories(min(), max(), &first, &last);
+
+    QStringList labels = m_axis->categoriesLabels().mid(first, last - first + 1);
+    if (layout.size() > 1) {
+        // thin out labels that would overlap, assuming evenly spaced categories
+        const qreal spacing = qAbs(layout.last() - layout.first()) / (layout.size() - 1);
+        setLabelStride(calculateLabelStride(labels, 0, labels.size() - 1, spacing));
+        for (int i = 0; i < labels.size(); ++i) {
+            if ((first + i) % labelStride())
+                labels[i] = QString();
+        }
+    }
+    setLabels(labels << QString());
     VerticalAxis::updateGeometry();
 }
 
@@ -88,7 +102,10 @@ QSizeF ChartCategoryAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constraint
 
     QSizeF sh;
     QSizeF base = VerticalAxis::sizeHint(which, constraint);
-    QStringList ticksList = m_axis->categoriesLabels();
+    int first;
+    int last;
+    m_axis->d_func()->visibleCategories(min(), max(), &first, &last);
+    QStringList ticksList = m_axis->categoriesLabels().mid(first, last - first + 1);
     qreal width = 0;
     qreal height = 0; // Height is irrelevant for Y axes with interval labels
 
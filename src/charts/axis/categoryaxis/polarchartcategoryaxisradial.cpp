@@ -31,6 +31,7 @@
 #include <private/chartpresenter_p.h>
 #include <private/abstractchartlayout_p.h>
 #include <QtCharts/QCategoryAxis>
+#include <private/qcategoryaxis_p.h>
 #include <QtCore/QDebug>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -48,7 +49,8 @@ PolarChartCategoryAxisRadial::~PolarChartCategoryAxisRadial()
 QVector<qreal> PolarChartCategoryAxisRadial::calculateLayout() const
 {
     QCategoryAxis *catAxis = static_cast<QCategoryAxis *>(axis());
-    int tickCount = catAxis->categoriesLabels().count() + 1;
+    const QVector<qreal> &boundaries = catAxis->d_func()->boundaries();
+    int tickCount = boundaries.count();
     QVector<qreal> points;
 
     if (tickCount < 2)
@@ -58,14 +60,8 @@ QVector<qreal> PolarChartCategoryAxisRadial::calculateLayout() const
     if (range > 0) {
         points.resize(tickCount);
         qreal scale = (axisGeometry().width() / 2) / range;
-        qreal angle;
-        for (int i = 0; i < tickCount; ++i) {
-            if (i < tickCount - 1)
-                angle = (catAxis->startValue(catAxis->categoriesLabels().at(i)) - min()) * scale;
-            else
-                angle = (catAxis->endValue(catAxis->categoriesLabels().at(i - 1)) - min()) * scale;
-            points[i] = angle;
-        }
+        for (int i = 0; i < tickCount; ++i)
+            points[i] = (boundaries.at(i) - min()) * scale;
     }
 
     return points;
@@ -36,6 +36,7 @@
 #include <QtCharts/QChart>
 #include <QtCore/QtMath>
 #include <QtCore/QDebug>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 /*!
@@ -183,15 +184,15 @@ void QCategoryAxis::append(const QString &categoryLabel, qreal categoryEndValue)
 {
     Q_D(QCategoryAxis);
 
-    if (!d->m_categories.contains(categoryLabel)) {
+    if (!d->m_categoryIndex.contains(categoryLabel)) {
         if (d->m_categories.isEmpty()) {
-            Range range(d->m_categoryMinimum, categoryEndValue);
-            d->m_categoriesMap.insert(categoryLabel, range);
+            d->m_boundaries << d->m_categoryMinimum << categoryEndValue;
+            d->m_categoryIndex.insert(categoryLabel, 0);
             d->m_categories.append(categoryLabel);
             emit categoriesChanged();
-        } else if (categoryEndValue > endValue(d->m_categories.last())) {
-            Range previousRange = d->m_categoriesMap.value(d->m_categories.last());
-            d->m_categoriesMap.insert(categoryLabel, Range(previousRange.second, categoryEndValue));
+        } else if (categoryEndValue > d->m_boundaries.last()) {
+            d->m_boundaries.append(categoryEndValue);
+            d->m_categoryIndex.insert(categoryLabel, d->m_categories.count());
             d->m_categories.append(categoryLabel);
             emit categoriesChanged();
         }
@@ -211,9 +212,8 @@ void QCategoryAxis::setStartValue(qreal min)
         d->m_categoryMinimum = min;
         emit categoriesChanged();
     } else {
-        Range range = d->m_categoriesMap.value(d->m_categories.first());
-        if (min < range.second) {
-            d->m_categoriesMap.insert(d->m_categories.first(), Range(min, range.second));
+        if (min < d->m_boundaries.at(1)) {
+            d->m_boundaries[0] = min;
             emit categoriesChanged();
         }
     }
@@ -227,7 +227,8 @@ qreal QCategoryAxis::startValue(const QString &categoryLabel) const
     Q_D(const QCategoryAxis);
     if (categoryLabel.isEmpty())
         return d->m_categoryMinimum;
-    return d->m_categoriesMap.value(categoryLabel).first;
+    int index = d->categoryIndex(categoryLabel);
+    return index != -1 ? d->m_boundaries.at(index) : 0;
 }
 
 /*!
@@ -236,7 +237,8 @@ qreal QCategoryAxis::startValue(const QString &categoryLabel) const
 qreal QCategoryAxis::endValue(const QString &categoryLabel) const
 {
     Q_D(const QCategoryAxis);
-    return d->m_categoriesMap.value(categoryLabel).second;
+    int index = d->categoryIndex(categoryLabel);
+    return index != -1 ? d->m_boundaries.at(index + 1) : 0;
 }
 
 /*!
@@ -249,27 +251,22 @@ qreal QCategoryAxis::endValue(const QString &categoryLabel) const
 void QCategoryAxis::remove(const QString &categoryLabel)
 {
     Q_D(QCategoryAxis);
-    int labelIndex = d->m_categories.indexOf(categoryLabel);
+    int labelIndex = d->categoryIndex(categoryLabel);
 
     // check if such label exists
     if (labelIndex != -1) {
         d->m_categories.removeAt(labelIndex);
-        d->m_categoriesMap.remove(categoryLabel);
-
-        // the range of the interval that follows (if exists) needs to be updated
-        if (labelIndex < d->m_categories.count()) {
-            QString label = d->m_categories.at(labelIndex);
-            Range range = d->m_categoriesMap.value(label);
-
-            // set the range
-            if (labelIndex == 0) {
-                range.first = d->m_categoryMinimum;
-                d->m_categoriesMap.insert(label, range);
-            } else {
-                range.first = d->m_categoriesMap.value(d->m_categories.at(labelIndex - 1)).second;
-                d->m_categoriesMap.insert(label, range);
-            }
-        }
+        d->m_categoryIndex.remove(categoryLabel);
+        d->reindexCategories(labelIndex);
+
+        // dropping the high end of the removed interval extends the interval that
+        // follows (if exists) down to the previous high end
+        d->m_boundaries.remove(labelIndex + 1);
+        if (d->m_categories.isEmpty())
+            d->m_boundaries.clear();
+        else if (labelIndex == 0)
+            d->m_boundaries[0] = d->m_categoryMinimum;
+
         emit categoriesChanged();
     }
 }
@@ -277,23 +274,24 @@ void QCategoryAxis::remove(const QString &categoryLabel)
 /*!
     \qmlmethod CategoryAxis::replace(string oldLabel, string newLabel)
     Replaces an existing category label specified by \a oldLabel with \a newLabel.
-    If the old label does not exist, the method returns without making any changes.
+    If the old label does not exist or the new label is already used by another category,
+    the method returns without making any changes.
 */
 /*!
     Replaces an existing category label specified by \a oldLabel with \a newLabel.
-    If the old label does not exist, the method returns without making any changes.
+    If the old label does not exist or the new label is already used by another category,
+    the method returns without making any changes.
  */
 void QCategoryAxis::replaceLabel(const QString &oldLabel, const QString &newLabel)
 {
     Q_D(QCategoryAxis);
-    int labelIndex = d->m_categories.indexOf(oldLabel);
+    int labelIndex = d->categoryIndex(oldLabel);
 
-    // check if such label exists
-    if (labelIndex != -1) {
+    // check if such label exists and the new one is not taken, labels must stay unique
+    if (labelIndex != -1 && !d->m_categoryIndex.contains(newLabel)) {
         d->m_categories.replace(labelIndex, newLabel);
-        Range range = d->m_categoriesMap.value(oldLabel);
-        d->m_categoriesMap.remove(oldLabel);
-        d->m_categoriesMap.insert(newLabel, range);
+        d->m_categoryIndex.remove(oldLabel);
+        d->m_categoryIndex.insert(newLabel, labelIndex);
         emit categoriesChanged();
     }
 }
@@ -359,6 +357,38 @@ int QCategoryAxisPrivate::ticksCount() const
     return m_categories.count() + 1;
 }
 
+// Returns the index of the category whose range contains value, or -1 if value is outside
+// of all categories. Ranges are half-open except for the last one, which includes its end.
+int QCategoryAxisPrivate::categoryAt(qreal value) const
+{
+    if (m_boundaries.isEmpty() || value < m_boundaries.first() || value > m_boundaries.last())
+        return -1;
+
+    int index = std::upper_bound(m_boundaries.constBegin(), m_boundaries.constEnd(), value)
+            - m_boundaries.constBegin() - 1;
+    return qMin(index, m_categories.count() - 1);
+}
+
+// Returns the range of categories intersecting [min, max]. Nothing is visible if last ends up
+// smaller than first.
+void QCategoryAxisPrivate::visibleCategories(qreal min, qreal max, int *first, int *last) const
+{
+    *first = 0;
+    *last = -1;
+
+    if (m_boundaries.isEmpty() || max < m_boundaries.first() || min > m_boundaries.last())
+        return;
+
+    *first = min <= m_boundaries.first() ? 0 : categoryAt(min);
+    *last = max >= m_boundaries.last() ? m_categories.count() - 1 : categoryAt(max);
+}
+
+void QCategoryAxisPrivate::reindexCategories(int from)
+{
+    for (int i = from; i < m_categories.count(); ++i)
+        m_categoryIndex[m_categories.at(i)] = i;
+}
+
 void QCategoryAxisPrivate::initializeGraphics(QGraphicsItem *parent)
 {
     Q_Q(QCategoryAxis);
@@ -84,6 +84,10 @@ Q_SIGNALS:
 private:
     Q_DECLARE_PRIVATE(QCategoryAxis)
     Q_DISABLE_COPY(QCategoryAxis)
+    friend class ChartCategoryAxisX;
+    friend class ChartCategoryAxisY;
+    friend class PolarChartCategoryAxisAngular;
+    friend class PolarChartCategoryAxisRadial;
 };
 
 QT_CHARTS_END_NAMESPACE
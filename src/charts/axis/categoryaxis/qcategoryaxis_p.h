@@ -42,6 +42,8 @@
 #include <QtCharts/QCategoryAxis>
 #include <private/qvalueaxis_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QHash>
+#include <QtCore/QVector>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -58,9 +60,21 @@ public:
     void initializeGraphics(QGraphicsItem* parent);
     int ticksCount() const;
 
+    //category lookup
+    int categoryIndex(const QString &label) const { return m_categoryIndex.value(label, -1); }
+    int categoryAt(qreal value) const;
+    void visibleCategories(qreal min, qreal max, int *first, int *last) const;
+    const QVector<qreal> &boundaries() const { return m_boundaries; }
+
+private:
+    void reindexCategories(int from);
+
 private:
-    QMap<QString , Range> m_categoriesMap;
     QStringList m_categories;
+    QHash<QString, int> m_categoryIndex;
+    // Sorted category limits: m_boundaries[i] is the low end and m_boundaries[i + 1]
+    // the high end of category i. Empty when there are no categories.
+    QVector<qreal> m_boundaries;
     qreal m_categoryMinimum;
     QCategoryAxis::AxisLabelsPosition m_labelsPosition;
 
@@ -31,10 +31,12 @@
 #include <private/qabstractaxis_p.h>
 #include <private/chartpresenter_p.h>
 #include <private/abstractchartlayout_p.h>
+#include <private/abstractdomain_p.h>
 #include <QtCharts/QCategoryAxis>
 #include <QtCore/QtMath>
 #include <QtCore/QDateTime>
 #include <QtCore/QRegularExpression>
+#include <QtGui/QFontMetricsF>
 #include <QtGui/QTextDocument>
 #include <cmath>
 
@@ -42,18 +44,11 @@ QT_CHARTS_BEGIN_NAMESPACE
 
 static const char *labelFormatMatchString = "%[\\-\\+#\\s\\d\\.\\'lhjztL]*([dicuoxfegXFEG])";
 static const char *labelFormatMatchLocalizedString = "^([^%]*)%\\.(\\d+)([defgiEG])(.*)$";
-static QRegularExpression *labelFormatMatcher = 0;
-static QRegularExpression *labelFormatMatcherLocalized = 0;
-class StaticLabelFormatMatcherDeleter
-{
-public:
-    StaticLabelFormatMatcherDeleter() {}
-    ~StaticLabelFormatMatcherDeleter() {
-        delete labelFormatMatcher;
-        delete labelFormatMatcherLocalized;
-    }
-};
-static StaticLabelFormatMatcherDeleter staticLabelFormatMatcherDeleter;
+// Shared by all threads that create axis labels
+Q_GLOBAL_STATIC_WITH_ARGS(QRegularExpression, labelFormatMatcher,
+                          (QString::fromLatin1(labelFormatMatchString)))
+Q_GLOBAL_STATIC_WITH_ARGS(QRegularExpression, labelFormatMatcherLocalized,
+                          (QString::fromLatin1(labelFormatMatchLocalizedString)))
 
 ChartAxisElement::ChartAxisElement(QAbstractAxis *axis, QGraphicsItem *item, bool intervalAxis)
     : ChartElement(item),
@@ -66,7 +61,8 @@ ChartAxisElement::ChartAxisElement(QAbstractAxis *axis, QGraphicsItem *item, boo
       m_shades(new QGraphicsItemGroup(item)),
       m_labels(new QGraphicsItemGroup(item)),
       m_title(new QGraphicsTextItem(item)),
-      m_intervalAxis(intervalAxis)
+      m_intervalAxis(intervalAxis),
+      m_labelStride(1)
 
 {
     //initial initialization
@@ -339,17 +335,25 @@ QString ChartAxisElement::formatLabel(const QString &formatSpec, const QByteArra
 QStringList ChartAxisElement::createValueLabels(qreal min, qreal max, int ticks,
                                                 const QString &format) const
 {
-    QStringList labels;
-
     if (max <= min || ticks < 1)
-        return labels;
+        return QStringList();
+
+    QVector<qreal> values(ticks);
+    for (int i = 0; i < ticks; i++)
+        values[i] = min + (i * (max - min) / (ticks - 1));
+
+    return createValueLabels(values, (max - min) / (ticks - 1), format);
+}
+
+QStringList ChartAxisElement::createValueLabels(const QVector<qreal> &values, qreal step,
+                                                const QString &format) const
+{
+    QStringList labels;
 
     if (format.isEmpty()) {
-        int n = qMax(int(-qFloor(std::log10((max - min) / (ticks - 1)))), 0) + 1;
-        for (int i = 0; i < ticks; i++) {
-            qreal value = min + (i * (max - min) / (ticks - 1));
+        int n = qMax(int(-qFloor(std::log10(step))), 0) + 1;
+        foreach (qreal value, values)
             labels << presenter()->numberToString(value, 'f', n);
-        }
     } else {
         QByteArray array = format.toLatin1();
         QString formatSpec;
@@ -357,9 +361,6 @@ QStringList ChartAxisElement::createValueLabels(qreal min, qreal max, int ticks,
         QString postStr;
         int precision = 6; // Six is the default precision in Qt API
         if (presenter()->localizeNumbers()) {
-            if (!labelFormatMatcherLocalized)
-                labelFormatMatcherLocalized
-                        = new QRegularExpression(QString::fromLatin1(labelFormatMatchLocalizedString));
             QRegularExpressionMatch rmatch;
             if (format.indexOf(*labelFormatMatcherLocalized, 0, &rmatch) != -1) {
                 preStr = rmatch.captured(1);
@@ -369,21 +370,85 @@ QStringList ChartAxisElement::createValueLabels(qreal min, qreal max, int ticks,
                 postStr = rmatch.captured(4);
             }
         } else {
-            if (!labelFormatMatcher)
-                labelFormatMatcher = new QRegularExpression(QString::fromLatin1(labelFormatMatchString));
             QRegularExpressionMatch rmatch;
             if (format.indexOf(*labelFormatMatcher, 0, &rmatch) != -1)
                 formatSpec = rmatch.captured(1);
         }
-        for (int i = 0; i < ticks; i++) {
-            qreal value = min + (i * (max - min) / (ticks - 1));
+        foreach (qreal value, values)
             labels << formatLabel(formatSpec, array, value, precision, preStr, postStr);
-        }
     }
 
     return labels;
 }
 
+// Picks the smallest nice step (1, 2 or 5 times a power of ten) at which the labels fit along
+// length pixels. Label sizes are estimated from the formatted range ends and the widest digit
+// of the labels font, so the cost does not depend on the number of ticks.
+QVector<qreal> ChartAxisElement::createNiceTickValues(qreal min, qreal max, qreal length,
+                                                      const QString &format, qreal *step) const
+{
+    QVector<qreal> values;
+    *step = max - min;
+
+    if (max <= min || length <= 0.0)
+        return values;
+
+    QVector<qreal> ends;
+    ends << min << max;
+
+    // The label precision depends on the step, so refine the estimate once
+    for (int pass = 0; pass < 2; ++pass) {
+        int labelLength = 0;
+        foreach (const QString &label, createValueLabels(ends, *step, format))
+            labelLength = qMax(labelLength, label.length());
+        const qreal extent = estimatedLabelExtent(labelLength) + 2 * labelPadding();
+        *step = AbstractDomain::niceNumber((max - min) * extent / length, true);
+    }
+
+    if (!qIsFinite(*step) || *step <= 0.0)
+        return values;
+
+    // Tick indices are kept in floating point, as min / step easily exceeds the int range for
+    // axes far from zero. Halving the step is bounded as it cannot produce two distinct ticks
+    // once the step drops below the precision of min and max.
+    const qreal maxTicks = qMax(qreal(2.0), std::floor(length));
+    for (int halving = 0; halving < 64; ++halving) {
+        const qreal first = std::ceil(min / *step);
+        const qreal last = std::floor(max / *step);
+        if (last - first >= 1.0) {
+            const qreal count = qMin(last - first + 1.0, maxTicks);
+            values.reserve(int(count));
+            for (qreal i = 0; i < count; ++i)
+                values.append((first + i) * *step);
+            return values;
+        }
+        // Keep at least two ticks even if their labels get truncated
+        const qreal z = qPow(10.0, std::floor(std::log10(*step)));
+        *step = qFuzzyCompare(*step / z, qreal(5.0)) ? *step / 2.5 : *step / 2.0;
+    }
+
+    *step = max - min;
+    values << min << max;
+    return values;
+}
+
+// Estimates how far a label of length characters extends along the axis from the widest digit
+// of the labels font, without laying out any text.
+qreal ChartAxisElement::estimatedLabelExtent(int length) const
+{
+    QFontMetricsF metrics(axis()->labelsFont());
+    qreal digitWidth = 0.0;
+    for (char digit = '0'; digit <= '9'; ++digit)
+        digitWidth = qMax(digitWidth, metrics.width(QLatin1Char(digit)));
+
+    const qreal width = digitWidth * length + 2 * ChartPresenter::textMargin();
+    const qreal height = metrics.height() + 2 * ChartPresenter::textMargin();
+    const qreal angle = qDegreesToRadians(qreal(axis()->labelsAngle()));
+    if (axis()->orientation() == Qt::Horizontal)
+        return qAbs(qCos(angle)) * width + qAbs(qSin(angle)) * height;
+    return qAbs(qSin(angle)) * width + qAbs(qCos(angle)) * height;
+}
+
 QStringList ChartAxisElement::createLogValueLabels(qreal min, qreal max, qreal base, int ticks,
                                                    const QString &format) const
 {
@@ -414,9 +479,6 @@ QStringList ChartAxisElement::createLogValueLabels(qreal min, qreal max, qreal b
         QString postStr;
         int precision = 6; // Six is the default precision in Qt API
         if (presenter()->localizeNumbers()) {
-            if (!labelFormatMatcherLocalized)
-                labelFormatMatcherLocalized =
-                        new QRegularExpression(QString::fromLatin1(labelFormatMatchLocalizedString));
             QRegularExpressionMatch rmatch;
             if (format.indexOf(*labelFormatMatcherLocalized, 0, &rmatch) != -1) {
                 preStr = rmatch.captured(1);
@@ -426,8 +488,6 @@ QStringList ChartAxisElement::createLogValueLabels(qreal min, qreal max, qreal b
                 postStr = rmatch.captured(4);
             }
         } else {
-            if (!labelFormatMatcher)
-                labelFormatMatcher = new QRegularExpression(QString::fromLatin1(labelFormatMatchString));
             QRegularExpressionMatch rmatch;
             if (format.indexOf(*labelFormatMatcher, 0, &rmatch) != -1)
                 formatSpec = rmatch.captured(1);
@@ -458,6 +518,28 @@ QStringList ChartAxisElement::createDateTimeLabels(qreal min, qreal max,int tick
     return labels;
 }
 
+// Returns how many ticks spacing pixels apart a label out of labels[first..last] needs so that
+// neighbouring labels do not overlap. Only the longest label is measured.
+int ChartAxisElement::calculateLabelStride(const QStringList &labels, int first, int last,
+                                           qreal spacing) const
+{
+    if (spacing <= 0.0)
+        return 1;
+
+    int longest = -1;
+    for (int i = first; i <= last; ++i) {
+        if (longest < 0 || labels.at(i).size() > labels.at(longest).size())
+            longest = i;
+    }
+    if (longest < 0 || labels.at(longest).isEmpty())
+        return 1;
+
+    QRectF rect = ChartPresenter::textBoundingRect(axis()->labelsFont(), labels.at(longest),
+                                                   axis()->labelsAngle());
+    qreal extent = axis()->orientation() == Qt::Horizontal ? rect.width() : rect.height();
+    return qMax(1, qCeil((extent + 2 * labelPadding()) / spacing));
+}
+
 void ChartAxisElement::axisSelected()
 {
     emit clicked();
@@ -75,6 +75,9 @@ public:
     inline qreal titlePadding() const { return qreal(2.0); }
     void setLabels(const QStringList &labels) { m_labelsList = labels; }
     QStringList labels() const { return m_labelsList; }
+    //number of ticks a single label may span when labels are thinned out
+    void setLabelStride(int stride) { m_labelStride = stride; }
+    int labelStride() const { return m_labelStride; }
 
     qreal min() const;
     qreal max() const;
@@ -88,9 +91,15 @@ public:
     bool intervalAxis() const { return m_intervalAxis; }
 
     QStringList createValueLabels(qreal max, qreal min, int ticks, const QString &format) const;
+    QStringList createValueLabels(const QVector<qreal> &values, qreal step,
+                                  const QString &format) const;
+    QVector<qreal> createNiceTickValues(qreal min, qreal max, qreal length,
+                                        const QString &format, qreal *step) const;
+    qreal estimatedLabelExtent(int length) const;
     QStringList createLogValueLabels(qreal min, qreal max, qreal base, int ticks,
                                      const QString &format) const;
     QStringList createDateTimeLabels(qreal max, qreal min, int ticks, const QString &format) const;
+    int calculateLabelStride(const QStringList &labels, int first, int last, qreal spacing) const;
 
     // from QGraphicsLayoutItem
     QRectF boundingRect() const
@@ -170,6 +179,7 @@ private:
     QScopedPointer<QGraphicsItemGroup> m_labels;
     QScopedPointer<QGraphicsTextItem> m_title;
     bool m_intervalAxis;
+    int m_labelStride;
 };
 
 QT_CHARTS_END_NAMESPACE
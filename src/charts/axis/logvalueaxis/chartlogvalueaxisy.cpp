@@ -42,6 +42,8 @@ ChartLogValueAxisY::ChartLogValueAxisY(QLogValueAxis *axis, QGraphicsItem *item)
 {
     QObject::connect(m_axis, SIGNAL(baseChanged(qreal)), this, SLOT(handleBaseChanged(qreal)));
     QObject::connect(m_axis, SIGNAL(labelFormatChanged(QString)), this, SLOT(handleLabelFormatChanged(QString)));
+    QObject::connect(m_axis, SIGNAL(tickTypeChanged(QLogValueAxis::TickType)),
+                     this, SLOT(handleTickTypeChanged(QLogValueAxis::TickType)));
 }
 
 ChartLogValueAxisY::~ChartLogValueAxisY()
@@ -70,7 +72,29 @@ QVector<qreal> ChartLogValueAxisY::calculateLayout() const
 void ChartLogValueAxisY::updateGeometry()
 {
     const QVector<qreal> &layout = ChartAxisElement::layout();
-    setLabels(createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(), layout.size(), m_axis->labelFormat()));
+    QStringList labels = createLogValueLabels(m_axis->min(), m_axis->max(), m_axis->base(),
+                                              layout.size(), m_axis->labelFormat());
+
+    int stride = 1;
+    if (m_axis->tickType() == QLogValueAxis::TicksAutomatic && layout.size() >= 2) {
+        int length = 0;
+        foreach (const QString &label, labels)
+            length = qMax(length, label.size());
+        const qreal extent = estimatedLabelExtent(length) + 2 * labelPadding();
+        stride = qMax(1, qCeil(extent / qAbs(layout.at(1) - layout.at(0))));
+    }
+    if (stride > 1) {
+        // Label only the powers divisible by the stride, so labels stay put while panning
+        const qreal logMax = std::log10(m_axis->max()) / std::log10(m_axis->base());
+        const qreal logMin = std::log10(m_axis->min()) / std::log10(m_axis->base());
+        const int firstPower = qCeil(qMin(logMin, logMax));
+        for (int i = 0; i < labels.size(); ++i) {
+            if ((firstPower + i) % stride != 0)
+                labels[i].clear();
+        }
+    }
+    setLabelStride(stride);
+    setLabels(labels);
     VerticalAxis::updateGeometry();
 }
 
@@ -88,6 +112,14 @@ void ChartLogValueAxisY::handleLabelFormatChanged(const QString &format)
     if(presenter()) presenter()->layout()->invalidate();
 }
 
+void ChartLogValueAxisY::handleTickTypeChanged(QLogValueAxis::TickType type)
+{
+    Q_UNUSED(type);
+    QGraphicsLayoutItem::updateGeometry();
+    if (presenter())
+        presenter()->layout()->invalidate();
+}
+
 QSizeF ChartLogValueAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constraint) const
 {
     Q_UNUSED(constraint)
@@ -41,11 +41,10 @@
 
 #include <private/verticalaxis_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
+#include <QtCharts/QLogValueAxis>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-class QLogValueAxis;
-
 class QT_CHARTS_PRIVATE_EXPORT ChartLogValueAxisY : public VerticalAxis
 {
     Q_OBJECT
@@ -63,6 +62,7 @@ protected:
 private Q_SLOTS:
     void handleBaseChanged(qreal base);
     void handleLabelFormatChanged(const QString &format);
+    void handleTickTypeChanged(QLogValueAxis::TickType type);
 
 private:
     QLogValueAxis *m_axis;
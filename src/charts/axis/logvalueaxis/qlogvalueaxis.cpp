@@ -140,6 +140,33 @@ QT_CHARTS_BEGIN_NAMESPACE
   value to -1 and the number of grid lines between major ticks will be calculated automatically.
 */
 
+/*!
+  \enum QLogValueAxis::TickType
+
+  This enum describes how the labels of the major tick marks are shown.
+
+  \value TicksFixed Every major tick mark, one per power of the base, is labeled.
+  \value TicksAutomatic Every major tick mark is drawn, but only every nth one is labeled,
+         where n is chosen from the length of the axis and the size of the label font, so
+         that the labels do not overlap at any zoom level.
+*/
+/*!
+  \property QLogValueAxis::tickType
+  \brief How the major tick marks are labeled. The default value is
+  QLogValueAxis::TicksFixed.
+
+  Automatic labeling is only supported for charts of the type QChart::ChartTypeCartesian.
+*/
+/*!
+  \qmlproperty enumeration LogValueAxis::tickType
+  How the major tick marks are labeled. Automatic labeling is only supported in ChartView.
+
+  \value LogValueAxis.TicksFixed
+        Every major tick mark is labeled (default).
+  \value LogValueAxis.TicksAutomatic
+        Labels are thinned out so that they fit the length of the axis.
+*/
+
 /*!
   \property QLogValueAxis::labelFormat
   \brief The label format of the axis.
@@ -205,6 +232,12 @@ QT_CHARTS_BEGIN_NAMESPACE
   \a minorTickCount, changes.
 */
 
+/*!
+  \fn void QLogValueAxis::tickTypeChanged(QLogValueAxis::TickType type)
+  This signal is emitted when the labeling of the major tick marks, specified by \a type,
+  changes.
+*/
+
 /*!
   \fn void QLogValueAxis::labelFormatChanged(const QString &format)
   This signal is emitted when the \a format of axis labels changes.
@@ -363,6 +396,21 @@ int QLogValueAxis::minorTickCount() const
     return d->m_minorTickCount;
 }
 
+void QLogValueAxis::setTickType(QLogValueAxis::TickType type)
+{
+    Q_D(QLogValueAxis);
+    if (d->m_tickType != type) {
+        d->m_tickType = type;
+        emit tickTypeChanged(type);
+    }
+}
+
+QLogValueAxis::TickType QLogValueAxis::tickType() const
+{
+    Q_D(const QLogValueAxis);
+    return d->m_tickType;
+}
+
 /*!
   Returns the type of the axis.
 */
@@ -380,6 +428,7 @@ QLogValueAxisPrivate::QLogValueAxisPrivate(QLogValueAxis *q)
       m_base(10),
       m_tickCount(0),
       m_minorTickCount(0),
+      m_tickType(QLogValueAxis::TicksFixed),
       m_labelFormat()
 {
 }
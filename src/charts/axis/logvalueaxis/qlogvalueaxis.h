@@ -49,8 +49,15 @@ class QT_CHARTS_EXPORT QLogValueAxis : public QAbstractAxis
     Q_PROPERTY(qreal base READ base WRITE setBase NOTIFY baseChanged)
     Q_PROPERTY(int tickCount READ tickCount NOTIFY tickCountChanged)
     Q_PROPERTY(int minorTickCount READ minorTickCount WRITE setMinorTickCount NOTIFY minorTickCountChanged)
+    Q_PROPERTY(TickType tickType READ tickType WRITE setTickType NOTIFY tickTypeChanged)
+    Q_ENUMS(TickType)
 
 public:
+    enum TickType {
+        TicksFixed = 0,
+        TicksAutomatic
+    };
+
     explicit QLogValueAxis(QObject *parent = nullptr);
     ~QLogValueAxis();
 
@@ -78,6 +85,9 @@ public:
     void setMinorTickCount(int minorTickCount);
     int minorTickCount() const;
 
+    void setTickType(QLogValueAxis::TickType type);
+    QLogValueAxis::TickType tickType() const;
+
 Q_SIGNALS:
     void minChanged(qreal min);
     void maxChanged(qreal max);
@@ -86,6 +96,7 @@ Q_SIGNALS:
     void baseChanged(qreal base);
     void tickCountChanged(int tickCount);
     void minorTickCountChanged(int minorTickCount);
+    void tickTypeChanged(QLogValueAxis::TickType type);
 
 private:
     Q_DECLARE_PRIVATE(QLogValueAxis)
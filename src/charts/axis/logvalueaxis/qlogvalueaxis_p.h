@@ -73,6 +73,7 @@ class QT_CHARTS_PRIVATE_EXPORT QLogValueAxisPrivate : public QAbstractAxisPrivat
     qreal m_base;
     int m_tickCount;
     int m_minorTickCount;
+    QLogValueAxis::TickType m_tickType;
     QString m_labelFormat;
     Q_DECLARE_PUBLIC(QLogValueAxis)
 };
@@ -47,6 +47,8 @@ ChartValueAxisX::ChartValueAxisX(QValueAxis *axis, QGraphicsItem *item )
     QObject::connect(m_axis, SIGNAL(minorTickCountChanged(int)),
                      this, SLOT(handleMinorTickCountChanged(int)));
     QObject::connect(m_axis, SIGNAL(labelFormatChanged(QString)), this, SLOT(handleLabelFormatChanged(QString)));
+    QObject::connect(m_axis, SIGNAL(tickTypeChanged(QValueAxis::TickType)),
+                     this, SLOT(handleTickTypeChanged(QValueAxis::TickType)));
 }
 
 ChartValueAxisX::~ChartValueAxisX()
@@ -55,6 +57,18 @@ ChartValueAxisX::~ChartValueAxisX()
 
 QVector<qreal> ChartValueAxisX::calculateLayout() const
 {
+    if (m_axis->tickType() == QValueAxis::TicksAutomatic) {
+        const QRectF &gridRect = gridGeometry();
+        qreal step;
+        const QVector<qreal> ticks = createNiceTickValues(min(), max(), gridRect.width(),
+                                                          m_axis->labelFormat(), &step);
+        QVector<qreal> points(ticks.size());
+        const qreal scale = gridRect.width() / (max() - min());
+        for (int i = 0; i < ticks.size(); ++i)
+            points[i] = (ticks.at(i) - min()) * scale + gridRect.left();
+        return points;
+    }
+
     int tickCount = m_axis->tickCount();
 
     Q_ASSERT(tickCount >= 2);
@@ -74,7 +88,23 @@ void ChartValueAxisX::updateGeometry()
     const QVector<qreal>& layout = ChartAxisElement::layout();
     if (layout.isEmpty())
         return;
-    setLabels(createValueLabels(min(), max(), layout.size(), m_axis->labelFormat()));
+    if (m_axis->tickType() == QValueAxis::TicksAutomatic) {
+        const QRectF &gridRect = gridGeometry();
+        qreal step;
+        QVector<qreal> ticks = createNiceTickValues(min(), max(), gridRect.width(),
+                                                    m_axis->labelFormat(), &step);
+        // The layout may be stale if the geometry changed while it was animating, so label
+        // the values at its points instead
+        if (ticks.size() != layout.size()) {
+            ticks.resize(layout.size());
+            const qreal scale = gridRect.width() / (max() - min());
+            for (int i = 0; i < layout.size(); ++i)
+                ticks[i] = min() + (layout.at(i) - gridRect.left()) / scale;
+        }
+        setLabels(createValueLabels(ticks, step, m_axis->labelFormat()));
+    } else {
+        setLabels(createValueLabels(min(), max(), layout.size(), m_axis->labelFormat()));
+    }
     HorizontalAxis::updateGeometry();
 }
 
@@ -85,6 +115,14 @@ void ChartValueAxisX::handleTickCountChanged(int tick)
     if(presenter()) presenter()->layout()->invalidate();
 }
 
+void ChartValueAxisX::handleTickTypeChanged(QValueAxis::TickType type)
+{
+    Q_UNUSED(type);
+    QGraphicsLayoutItem::updateGeometry();
+    if (presenter())
+        presenter()->layout()->invalidate();
+}
+
 void ChartValueAxisX::handleMinorTickCountChanged(int tick)
 {
     Q_UNUSED(tick);
@@ -107,7 +145,15 @@ QSizeF ChartValueAxisX::sizeHint(Qt::SizeHint which, const QSizeF &constraint) c
     QSizeF sh;
 
     QSizeF base = HorizontalAxis::sizeHint(which, constraint);
-    QStringList ticksList = createValueLabels(min(),max(),m_axis->tickCount(),m_axis->labelFormat());
+    QStringList ticksList;
+    if (m_axis->tickType() == QValueAxis::TicksAutomatic && !gridGeometry().isEmpty()) {
+        qreal step;
+        const QVector<qreal> ticks = createNiceTickValues(min(), max(), gridGeometry().width(),
+                                                          m_axis->labelFormat(), &step);
+        ticksList = createValueLabels(ticks, step, m_axis->labelFormat());
+    } else {
+        ticksList = createValueLabels(min(), max(), m_axis->tickCount(), m_axis->labelFormat());
+    }
     // Width of horizontal axis sizeHint indicates the maximum distance labels can extend past
     // first and last ticks. Base width is irrelevant.
     qreal width = 0;
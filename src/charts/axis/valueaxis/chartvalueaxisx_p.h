@@ -41,11 +41,10 @@
 
 #include <private/horizontalaxis_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
+#include <QtCharts/QValueAxis>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-class QValueAxis;
-
 class QT_CHARTS_PRIVATE_EXPORT ChartValueAxisX : public HorizontalAxis
 {
     Q_OBJECT
@@ -59,6 +58,7 @@ protected:
     void updateGeometry();
 private Q_SLOTS:
     void handleTickCountChanged(int tick);
+    void handleTickTypeChanged(QValueAxis::TickType type);
     void handleMinorTickCountChanged(int tick);
     void handleLabelFormatChanged(const QString &format);
 
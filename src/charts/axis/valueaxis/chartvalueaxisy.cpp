@@ -46,6 +46,8 @@ ChartValueAxisY::ChartValueAxisY(QValueAxis *axis, QGraphicsItem *item)
     QObject::connect(m_axis, SIGNAL(minorTickCountChanged(int)),
                      this, SLOT(handleMinorTickCountChanged(int)));
     QObject::connect(m_axis, SIGNAL(labelFormatChanged(QString)), this, SLOT(handleLabelFormatChanged(QString)));
+    QObject::connect(m_axis, SIGNAL(tickTypeChanged(QValueAxis::TickType)),
+                     this, SLOT(handleTickTypeChanged(QValueAxis::TickType)));
 }
 
 ChartValueAxisY::~ChartValueAxisY()
@@ -54,6 +56,18 @@ ChartValueAxisY::~ChartValueAxisY()
 
 QVector<qreal> ChartValueAxisY::calculateLayout() const
 {
+    if (m_axis->tickType() == QValueAxis::TicksAutomatic) {
+        const QRectF &gridRect = gridGeometry();
+        qreal step;
+        const QVector<qreal> ticks = createNiceTickValues(min(), max(), gridRect.height(),
+                                                          m_axis->labelFormat(), &step);
+        QVector<qreal> points(ticks.size());
+        const qreal scale = gridRect.height() / (max() - min());
+        for (int i = 0; i < ticks.size(); ++i)
+            points[i] = -(ticks.at(i) - min()) * scale + gridRect.bottom();
+        return points;
+    }
+
     int tickCount = m_axis->tickCount();
 
     Q_ASSERT(tickCount >= 2);
@@ -75,7 +89,23 @@ void ChartValueAxisY::updateGeometry()
     const QVector<qreal> &layout = ChartAxisElement::layout();
     if (layout.isEmpty())
         return;
-    setLabels(createValueLabels(min(),max(),layout.size(),m_axis->labelFormat()));
+    if (m_axis->tickType() == QValueAxis::TicksAutomatic) {
+        const QRectF &gridRect = gridGeometry();
+        qreal step;
+        QVector<qreal> ticks = createNiceTickValues(min(), max(), gridRect.height(),
+                                                    m_axis->labelFormat(), &step);
+        // The layout may be stale if the geometry changed while it was animating, so label
+        // the values at its points instead
+        if (ticks.size() != layout.size()) {
+            ticks.resize(layout.size());
+            const qreal scale = gridRect.height() / (max() - min());
+            for (int i = 0; i < layout.size(); ++i)
+                ticks[i] = min() + (gridRect.bottom() - layout.at(i)) / scale;
+        }
+        setLabels(createValueLabels(ticks, step, m_axis->labelFormat()));
+    } else {
+        setLabels(createValueLabels(min(), max(), layout.size(), m_axis->labelFormat()));
+    }
     VerticalAxis::updateGeometry();
 }
 
@@ -86,6 +116,14 @@ void ChartValueAxisY::handleTickCountChanged(int tick)
     if (presenter()) presenter()->layout()->invalidate();
 }
 
+void ChartValueAxisY::handleTickTypeChanged(QValueAxis::TickType type)
+{
+    Q_UNUSED(type);
+    QGraphicsLayoutItem::updateGeometry();
+    if (presenter())
+        presenter()->layout()->invalidate();
+}
+
 void ChartValueAxisY::handleMinorTickCountChanged(int tick)
 {
     Q_UNUSED(tick);
@@ -107,7 +145,15 @@ QSizeF ChartValueAxisY::sizeHint(Qt::SizeHint which, const QSizeF &constraint) c
 
     QSizeF sh;
     QSizeF base = VerticalAxis::sizeHint(which, constraint);
-    QStringList ticksList = createValueLabels(min(),max(),m_axis->tickCount(),m_axis->labelFormat());
+    QStringList ticksList;
+    if (m_axis->tickType() == QValueAxis::TicksAutomatic && !gridGeometry().isEmpty()) {
+        qreal step;
+        const QVector<qreal> ticks = createNiceTickValues(min(), max(), gridGeometry().height(),
+                                                          m_axis->labelFormat(), &step);
+        ticksList = createValueLabels(ticks, step, m_axis->labelFormat());
+    } else {
+        ticksList = createValueLabels(min(), max(), m_axis->tickCount(), m_axis->labelFormat());
+    }
     qreal width = 0;
     // Height of vertical axis sizeHint indicates the maximum distance labels can extend past
     // first and last ticks. Base height is irrelevant.
@@ -138,6 +138,38 @@ QT_CHARTS_BEGIN_NAMESPACE
   between major ticks on the chart. Labels are not drawn for minor ticks. The default value is 0.
 */
 
+/*!
+  \enum QValueAxis::TickType
+
+  This enum describes how the major tick marks of the axis are placed.
+
+  \value TicksFixed The number of tick marks is set by tickCount, and the ticks divide
+         the axis range evenly.
+  \value TicksAutomatic The tick marks are placed at \e nice values (multiples of 1*10^n,
+         2*10^n, or 5*10^n) within the axis range. The spacing is chosen from the length of
+         the axis and the size of the label font, so that the labels do not overlap at any
+         zoom level. tickCount is ignored.
+*/
+/*!
+  \property QValueAxis::tickType
+  \brief How the major tick marks are placed on the axis. The default value is
+  QValueAxis::TicksFixed.
+
+  Automatic tick placement is only supported for charts of the type
+  QChart::ChartTypeCartesian.
+*/
+/*!
+  \qmlproperty enumeration ValueAxis::tickType
+  How the major tick marks are placed on the axis. Automatic tick placement is only supported
+  in ChartView.
+
+  \value ValueAxis.TicksFixed
+        The number of tick marks is set by tickCount (default).
+  \value ValueAxis.TicksAutomatic
+        The tick marks are placed at \e nice values, spaced so that the labels fit the
+        length of the axis.
+*/
+
 /*!
   \property QValueAxis::labelFormat
   \brief The label format of the axis.
@@ -180,6 +212,11 @@ QT_CHARTS_BEGIN_NAMESPACE
   changes.
 */
 
+/*!
+  \fn void QValueAxis::tickTypeChanged(QValueAxis::TickType type)
+  This signal is emitted when the tick placement of the axis, specified by \a type, changes.
+*/
+
 /*!
   \fn void QValueAxis::minorTickCountChanged(int minorTickCount)
   This signal is emitted when the number of minor tick marks on the axis, specified by
@@ -296,6 +333,21 @@ int QValueAxis::minorTickCount() const
     return d->m_minorTickCount;
 }
 
+void QValueAxis::setTickType(QValueAxis::TickType type)
+{
+    Q_D(QValueAxis);
+    if (d->m_tickType != type) {
+        d->m_tickType = type;
+        emit tickTypeChanged(type);
+    }
+}
+
+QValueAxis::TickType QValueAxis::tickType() const
+{
+    Q_D(const QValueAxis);
+    return d->m_tickType;
+}
+
 void QValueAxis::setLabelFormat(const QString &format)
 {
     Q_D(QValueAxis);
@@ -354,6 +406,7 @@ QValueAxisPrivate::QValueAxisPrivate(QValueAxis *q)
       m_max(0),
       m_tickCount(5),
       m_minorTickCount(0),
+      m_tickType(QValueAxis::TicksFixed),
       m_format(),
       m_applying(false)
 {
@@ -44,8 +44,15 @@ class QT_CHARTS_EXPORT QValueAxis : public QAbstractAxis
     Q_PROPERTY(qreal max READ max WRITE setMax NOTIFY maxChanged)
     Q_PROPERTY(QString labelFormat READ labelFormat WRITE setLabelFormat NOTIFY labelFormatChanged)
     Q_PROPERTY(int minorTickCount READ minorTickCount WRITE setMinorTickCount NOTIFY minorTickCountChanged)
+    Q_PROPERTY(TickType tickType READ tickType WRITE setTickType NOTIFY tickTypeChanged)
+    Q_ENUMS(TickType)
 
 public:
+    enum TickType {
+        TicksFixed = 0,
+        TicksAutomatic
+    };
+
     explicit QValueAxis(QObject *parent = nullptr);
     ~QValueAxis();
 
@@ -67,6 +74,8 @@ public:
     int tickCount() const;
     void setMinorTickCount(int count);
     int minorTickCount() const;
+    void setTickType(QValueAxis::TickType type);
+    QValueAxis::TickType tickType() const;
 
     void setLabelFormat(const QString &format);
     QString labelFormat() const;
@@ -80,6 +89,7 @@ Q_SIGNALS:
     void rangeChanged(qreal min, qreal max);
     void tickCountChanged(int tickCount);
     void minorTickCountChanged(int tickCount);
+    void tickTypeChanged(QValueAxis::TickType type);
     void labelFormatChanged(const QString &format);
 
 private:
@@ -70,6 +70,7 @@ private:
     qreal m_max;
     int m_tickCount;
     int m_minorTickCount;
+    QValueAxis::TickType m_tickType;
     QString m_format;
     bool m_applying;
     Q_DECLARE_PUBLIC(QValueAxis)
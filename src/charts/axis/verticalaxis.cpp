@@ -85,7 +85,8 @@ void VerticalAxis::updateGeometry()
     QList<QGraphicsItem *> arrow = arrowItems();
     QGraphicsTextItem *title = titleItem();
 
-    Q_ASSERT(labels.size() == labelList.size());
+    // hidden items reserved for reuse follow the active ones
+    Q_ASSERT(labels.size() >= labelList.size());
     Q_ASSERT(layout.size() == labelList.size());
 
     const QRectF &axisRect = axisGeometry();
@@ -162,7 +163,8 @@ void VerticalAxis::updateGeometry()
         if (text.isEmpty()) {
             labelItem->setHtml(text);
         } else {
-            qreal labelHeight = (axisRect.height() / layout.count()) - (2 * labelPadding());
+            qreal labelHeight = (axisRect.height() / layout.count() * labelStride())
+                    - (2 * labelPadding());
             QString truncatedText = ChartPresenter::truncatedText(axis()->labelsFont(), text,
                                                                   axis()->labelsAngle(),
                                                                   availableSpace,
@@ -362,7 +364,7 @@ void VerticalAxis::updateMinorTickGeometry()
 
         minorTickCount = valueAxis->minorTickCount();
 
-        if (valueAxis->tickCount() >= 2)
+        if (layout.size() >= 2)
             tickSpacing = layout.at(0) - layout.at(1);
 
         for (int i = 0; i < minorTickCount; ++i) {
@@ -424,13 +426,15 @@ void VerticalAxis::updateMinorTickGeometry()
     if (minorTickCount < 1 || tickSpacing == 0.0 || minorTickSpacings.count() != minorTickCount)
         return;
 
+    const QList<QGraphicsItem *> minorGridItemsList = minorGridItems();
+    const QList<QGraphicsItem *> minorArrowItemsList = minorArrowItems();
     for (int i = 0; i < layout.size() - 1; ++i) {
         for (int j = 0; j < minorTickCount; ++j) {
             const int minorItemIndex = i * minorTickCount + j;
             QGraphicsLineItem *minorGridLineItem =
-                    static_cast<QGraphicsLineItem *>(minorGridItems().value(minorItemIndex));
+                    static_cast<QGraphicsLineItem *>(minorGridItemsList.value(minorItemIndex));
             QGraphicsLineItem *minorArrowLineItem =
-                    static_cast<QGraphicsLineItem *>(minorArrowItems().value(minorItemIndex));
+                    static_cast<QGraphicsLineItem *>(minorArrowItemsList.value(minorItemIndex));
             if (!minorGridLineItem || !minorArrowLineItem)
                 continue;
 
@@ -28,7 +28,6 @@
 ****************************************************************************/
 
 #include <private/abstractbarchartitem_p.h>
-#include <private/bar_p.h>
 #include <QtCharts/QBarSet>
 #include <private/qbarset_p.h>
 #include <QtCharts/QAbstractBarSeries>
@@ -41,6 +40,7 @@
 #include <QtCore/QtMath>
 #include <QtGui/QPainter>
 #include <QtGui/QTextDocument>
+#include <QtWidgets/QGraphicsSceneEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -48,14 +48,18 @@ AbstractBarChartItem::AbstractBarChartItem(QAbstractBarSeries *series, QGraphics
     ChartItem(series->d_func(),item),
     m_animation(0),
     m_series(series),
+    m_hoveredSet(nullptr),
+    m_hoveredCategory(-1),
+    m_pressedSet(nullptr),
+    m_pressedCategory(-1),
     m_firstCategory(-1),
     m_lastCategory(-2),
     m_categoryCount(0),
-    m_labelItemsMissing(false),
     m_orientation(Qt::Horizontal),
     m_resetAnimation(true)
 {
-    setAcceptedMouseButtons(0);
+    setAcceptedMouseButtons(Qt::LeftButton | Qt::RightButton);
+    setAcceptHoverEvents(true);
     setFlag(ItemClipsChildrenToShape);
     setFlag(QGraphicsItem::ItemIsSelectable);
     connect(series->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleLayoutChanged()));
@@ -68,6 +72,8 @@ AbstractBarChartItem::AbstractBarChartItem(QAbstractBarSeries *series, QGraphics
             this, &AbstractBarChartItem::handleBarValueAdd);
     connect(series->d_func(), &QAbstractBarSeriesPrivate::setValueRemoved,
             this, &AbstractBarChartItem::handleBarValueRemove);
+    connect(series->d_func(), &QAbstractBarSeriesPrivate::setValuesReplaced,
+            this, &AbstractBarChartItem::handleBarValuesReplace);
     connect(series, SIGNAL(visibleChanged()), this, SLOT(handleVisibleChanged()));
     connect(series, SIGNAL(opacityChanged()), this, SLOT(handleOpacityChanged()));
     connect(series, SIGNAL(labelsFormatChanged(QString)), this, SLOT(handleUpdatedBars()));
@@ -94,9 +100,63 @@ AbstractBarChartItem::~AbstractBarChartItem()
 
 void AbstractBarChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    Q_UNUSED(painter);
     Q_UNUSED(option);
     Q_UNUSED(widget);
+
+    if (m_layout.isEmpty())
+        return;
+
+    painter->save();
+    painter->setClipRect(m_rect);
+    for (int set = 0; set < m_barSets.size(); set++) {
+        const QBarSet *barSet = m_barSets.at(set);
+        if (!barSet)
+            continue;
+        painter->setPen(barSet->d_ptr->m_pen);
+        painter->setBrush(barSet->d_ptr->m_brush);
+        // Draw the set in as few calls as possible, skipping empty bars to avoid
+        // drawing their outlines
+        const QRectF *rects = m_layout.constData() + set * m_categoryCount;
+        int first = 0;
+        for (int i = 0; i <= m_categoryCount; i++) {
+            if (i == m_categoryCount || rects[i].isEmpty()) {
+                if (i > first)
+                    painter->drawRects(rects + first, i - first);
+                first = i + 1;
+            }
+        }
+    }
+
+    // Labels are painted on top of all bars
+    if (m_series->isLabelsVisible()) {
+        const qreal angle = m_series->d_func()->labelsAngle();
+        const qreal margin = ChartPresenter::textMargin();
+        for (int set = 0; set < m_barSets.size(); set++) {
+            const QBarSet *barSet = m_barSets.at(set);
+            if (!barSet)
+                continue;
+            painter->setFont(barSet->d_ptr->m_labelFont);
+            painter->setPen(barSet->d_ptr->m_labelBrush.color());
+            for (int index = layoutIndex(set, m_firstCategory);
+                 index <= layoutIndex(set, m_lastCategory); index++) {
+                const QStaticText &text = m_labelTexts.at(index);
+                if (text.text().isEmpty())
+                    continue;
+                const QRectF &rect = m_labelRects.at(index);
+                if (angle == 0.0) {
+                    painter->drawStaticText(rect.topLeft() + QPointF(margin, margin), text);
+                } else {
+                    painter->save();
+                    painter->translate(rect.center());
+                    painter->rotate(angle);
+                    painter->drawStaticText(QPointF(margin - rect.width() / 2.0,
+                                                    margin - rect.height() / 2.0), text);
+                    painter->restore();
+                }
+            }
+        }
+    }
+    painter->restore();
 }
 
 QRectF AbstractBarChartItem::boundingRect() const
@@ -104,20 +164,153 @@ QRectF AbstractBarChartItem::boundingRect() const
     return m_rect;
 }
 
+// The scene hit-tests items through their shape, so only the bars themselves take mouse and
+// hover events and the series stacked below this item keep theirs
+QPainterPath AbstractBarChartItem::shape() const
+{
+    return m_shape;
+}
+
+bool AbstractBarChartItem::contains(const QPointF &point) const
+{
+    return barIndexAt(point) >= 0;
+}
+
+// Returns the layout index of the topmost bar at pos, or -1 if there is none. The candidate
+// categories are computed from the domain value at pos, so only the bars of those categories
+// need to be tested.
+int AbstractBarChartItem::barIndexAt(const QPointF &pos) const
+{
+    if (m_categoryCount <= 0 || !m_rect.contains(pos))
+        return -1;
+
+    const QPointF value = domain()->calculateDomainPoint(pos);
+    const qreal categoryPos = (m_orientation == Qt::Vertical ? value.x() : value.y())
+            - m_seriesPosAdjustment;
+    const qreal halfWidth = m_series->d_func()->barWidth() * m_seriesWidth / 2.0;
+    const int first = qMax(m_firstCategory, qCeil(categoryPos - halfWidth));
+    const int last = qMin(m_lastCategory, qFloor(categoryPos + halfWidth));
+
+    for (int set = m_barSets.size() - 1; set >= 0; set--) {
+        if (!m_barSets.at(set))
+            continue;
+        for (int category = last; category >= first; category--) {
+            const int index = layoutIndex(set, category);
+            const QRectF &rect = m_layout.at(index);
+            if (!rect.isEmpty() && rect.contains(pos))
+                return index;
+        }
+    }
+    return -1;
+}
+
+void AbstractBarChartItem::updateShape()
+{
+    QPainterPath path;
+    // Bars of adjacent sets may touch or overlap, which must not leave holes in the shape
+    path.setFillRule(Qt::WindingFill);
+    if (m_layout.size() == m_barSets.size() * m_categoryCount) {
+        for (int set = 0; set < m_barSets.size(); set++) {
+            if (!m_barSets.at(set))
+                continue;
+            const QRectF *rects = m_layout.constData() + set * m_categoryCount;
+            for (int i = 0; i < m_categoryCount; i++) {
+                const QRectF rect = rects[i].intersected(m_rect);
+                if (!rect.isEmpty())
+                    path.addRect(rect);
+            }
+        }
+    }
+    m_shape = path;
+}
+
+void AbstractBarChartItem::setHoveredBar(QBarSet *barset, int category)
+{
+    if (barset == m_hoveredSet && category == m_hoveredCategory)
+        return;
+
+    if (m_hoveredSet) {
+        emit m_series->hovered(false, m_hoveredCategory, m_hoveredSet);
+        emit m_hoveredSet->hovered(false, m_hoveredCategory);
+    }
+    m_hoveredSet = barset;
+    m_hoveredCategory = category;
+    if (m_hoveredSet) {
+        emit m_series->hovered(true, m_hoveredCategory, m_hoveredSet);
+        emit m_hoveredSet->hovered(true, m_hoveredCategory);
+    }
+}
+
+void AbstractBarChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = barIndexAt(event->pos());
+    if (index < 0) {
+        event->ignore();
+        return;
+    }
+    m_pressedSet = m_barSets.at(index / m_categoryCount);
+    m_pressedCategory = m_firstCategory + index % m_categoryCount;
+    emit m_series->pressed(m_pressedCategory, m_pressedSet);
+    emit m_pressedSet->pressed(m_pressedCategory);
+    QGraphicsItem::mousePressEvent(event);
+}
+
+void AbstractBarChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    // Like a button, the bar that got the press gets the release and the click
+    if (m_pressedSet) {
+        QBarSet *barset = m_pressedSet;
+        const int category = m_pressedCategory;
+        m_pressedSet = nullptr;
+        emit m_series->released(category, barset);
+        emit barset->released(category);
+        emit m_series->clicked(category, barset);
+        emit barset->clicked(category);
+    }
+    QGraphicsItem::mouseReleaseEvent(event);
+}
+
+void AbstractBarChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = barIndexAt(event->pos());
+    if (index >= 0) {
+        QBarSet *barset = m_barSets.at(index / m_categoryCount);
+        const int category = m_firstCategory + index % m_categoryCount;
+        emit m_series->doubleClicked(category, barset);
+        emit barset->doubleClicked(category);
+    }
+    QGraphicsItem::mouseDoubleClickEvent(event);
+}
+
+void AbstractBarChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    hoverMoveEvent(event);
+}
+
+void AbstractBarChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    const int index = barIndexAt(event->pos());
+    if (index >= 0)
+        setHoveredBar(m_barSets.at(index / m_categoryCount), m_firstCategory + index % m_categoryCount);
+    else
+        setHoveredBar(nullptr, -1);
+}
+
+void AbstractBarChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event)
+    setHoveredBar(nullptr, -1);
+}
+
 void AbstractBarChartItem::initializeFullLayout()
 {
-    qreal setCount = m_series->count();
+    const int setCount = m_barSets.size();
 
     for (int set = 0; set < setCount; set++) {
-        QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            initializeLayout(set, bar->index(), bar->layoutIndex(), true);
-            // Make bar initially hidden to avoid artifacts, layout setting will show it
-            bar->setVisible(false);
-        }
+        for (int category = m_firstCategory; category <= m_lastCategory; category++)
+            initializeLayout(set, category, layoutIndex(set, category), true);
     }
+    updateShape();
 }
 
 void AbstractBarChartItem::applyLayout(const QVector<QRectF> &layout)
@@ -155,24 +348,14 @@ void AbstractBarChartItem::setAnimation(BarAnimation *animation)
 void AbstractBarChartItem::setLayout(const QVector<QRectF> &layout)
 {
     int setCount = m_series->count();
-    if (layout.size() != m_layout.size() || m_barMap.size() != setCount)
+    if (layout.size() != m_layout.size() || m_barSets.size() != setCount)
         return;
 
+    // Empty bars are not painted, which avoids artifacts at animation start when adding
+    // a new series as it doesn't have correct axes yet
     m_layout = layout;
-
-    const bool visible = m_series->isVisible();
-    for (int set = 0; set < setCount; set++) {
-        QBarSet *barSet = m_series->d_func()->barsetAt(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            const QRectF &rect = layout.at(bar->layoutIndex());
-            bar->setRect(rect);
-            // Hide empty bars to avoid artifacts at animation start when adding a new series
-            // as it doesn't have correct axes yet
-            bar->setVisible(visible && !rect.isEmpty());
-        }
-    }
+    updateShape();
+    update();
 
     positionLabels();
 }
@@ -207,16 +390,6 @@ void AbstractBarChartItem::handleLayoutChanged()
 void AbstractBarChartItem::handleLabelsVisibleChanged(bool visible)
 {
     bool newVisible = visible && m_series->isVisible();
-    QMapIterator<QBarSet *, QList<Bar *> > i(m_barMap);
-    while (i.hasNext()) {
-        i.next();
-        const QList<Bar *> &bars = i.value();
-        for (int j = 0; j < bars.size(); j++) {
-            QGraphicsTextItem *label = bars.at(j)->labelItem();
-            if (label)
-                label->setVisible(newVisible);
-        }
-    }
     if (newVisible) {
         handleUpdatedBars();
         positionLabels();
@@ -235,21 +408,14 @@ void AbstractBarChartItem::handleVisibleChanged()
     bool visible = m_series->isVisible();
     handleLabelsVisibleChanged(m_series->isLabelsVisible());
 
-    QMapIterator<QBarSet *, QList<Bar *> > i(m_barMap);
-    while (i.hasNext()) {
-        i.next();
-        const QList<Bar *> &bars = i.value();
-        for (int j = 0; j < bars.size(); j++) {
-            Bar *bar = bars.at(j);
-            bar->setVisible(visible && i.key()->at(bar->index()) != 0.0);
-        }
-    }
+    setVisible(visible);
+    if (!visible)
+        setHoveredBar(nullptr, -1);
 }
 
 void AbstractBarChartItem::handleOpacityChanged()
 {
-    foreach (QGraphicsItem *item, childItems())
-        item->setOpacity(m_series->opacity());
+    setOpacity(m_series->opacity());
 }
 
 void AbstractBarChartItem::handleUpdatedBars()
@@ -263,49 +429,49 @@ void AbstractBarChartItem::handleUpdatedBars()
 
         const bool updateLabels =
                 m_series->isLabelsVisible() && m_series->isVisible() && presenter();
-        if (updateLabels) {
-            createLabelItems();
+        if (updateLabels)
             m_series->d_func()->setLabelsDirty(false);
-        }
+        // Labels are only formatted for the visible categories, the rest get formatted
+        // when they scroll into view
+        const Qt::TextFormat labelFormat = Qt::mightBeRichText(m_series->labelsFormat())
+                ? Qt::RichText : Qt::PlainText;
+        bool labelsChanged = false;
 
+        bool visualsDirty = seriesVisualsDirty;
         for (int set = 0; set < setCount; set++) {
             QBarSet *barSet = m_series->d_func()->barsetAt(set);
             QBarSetPrivate *barSetP = barSet->d_ptr.data();
-            const bool setVisualsDirty = barSetP->visualsDirty();
             const bool setLabelsDirty = barSetP->labelsDirty();
+            visualsDirty |= barSetP->visualsDirty();
             barSetP->setVisualsDirty(false);
             if (updateLabels)
                 barSetP->setLabelsDirty(false);
-            const int actualBarCount = barSet->count();
-            const QList<Bar *> bars = m_barMap.value(barSet);
-            for (int i = 0; i < bars.size(); i++) {
-                Bar *bar = bars.at(i);
-                if (seriesVisualsDirty || setVisualsDirty || bar->visualsDirty()) {
-                    bar->setPen(barSetP->m_pen);
-                    bar->setBrush(barSetP->m_brush);
-                    bar->setVisualsDirty(false);
-                    bar->update();
-                }
-                if (updateLabels && actualBarCount > bar->index()) {
-                    if (seriesLabelsDirty || setLabelsDirty || bar->labelDirty()) {
-                        bar->setLabelDirty(false);
-                        QGraphicsTextItem *label = bar->labelItem();
-                        QString valueLabel;
-                        qreal value = barSetP->value(bar->index());
-                        if (value == 0.0) {
-                            label->setVisible(false);
-                        } else {
-                            label->setVisible(m_series->isLabelsVisible());
-                            valueLabel = generateLabelText(set, bar->index(), value);
-                        }
-                        label->setHtml(valueLabel);
-                        label->setFont(barSetP->m_labelFont);
-                        label->setDefaultTextColor(barSetP->m_labelBrush.color());
-                        label->update();
+            // The label items follow the layout, which may not have caught up with the sets yet
+            if (!updateLabels || m_barSets.value(set) != barSet)
+                continue;
+            const int lastCategory = qMin(m_lastCategory, barSet->count() - 1);
+            for (int category = m_firstCategory; category <= lastCategory; category++) {
+                const int index = layoutIndex(set, category);
+                if (seriesLabelsDirty || setLabelsDirty || m_labelDirty.at(index)) {
+                    m_labelDirty[index] = false;
+                    QStaticText &text = m_labelTexts[index];
+                    qreal value = barSetP->value(category);
+                    if (value == 0.0) {
+                        text = QStaticText();
+                    } else {
+                        text.setText(generateLabelText(set, category, value));
+                        text.setTextFormat(labelFormat);
                     }
+                    labelsChanged = true;
                 }
             }
         }
+        // Font changes need remeasuring too, so reposition whenever anything changed
+        if (labelsChanged)
+            positionLabels();
+        // Bars and labels are painted with the current visuals of their sets
+        if (visualsDirty || labelsChanged)
+            update();
     }
 }
 
@@ -321,60 +487,63 @@ void AbstractBarChartItem::positionLabels()
 
     if (!m_series->isLabelsVisible())
         return;
-    createLabelItems();
 
     QTransform transform;
     const qreal angle = m_series->d_func()->labelsAngle();
     if (angle != 0.0)
         transform.rotate(angle);
 
-    int setCount = m_series->count();
+    const int setCount = m_barSets.size();
     for (int set = 0; set < setCount; set++) {
-        QBarSet *barSet = m_series->d_func()->barsetAt(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            QGraphicsTextItem *label = bar->labelItem();
-
-            QRectF labelRect = label->boundingRect();
+        const QBarSet *barSet = m_barSets.at(set);
+        if (!barSet)
+            continue;
+        const int offset = barSet->d_ptr->m_pen.width() / 2 + 2;
+        const QFont &font = barSet->d_ptr->m_labelFont;
+        const QFontMetricsF metrics(font);
+        for (int index = layoutIndex(set, m_firstCategory);
+             index <= layoutIndex(set, m_lastCategory); index++) {
+            QStaticText &text = m_labelTexts[index];
+            if (text.text().isEmpty())
+                continue;
+
+            QRectF labelRect = labelBoundingRect(text, font, metrics);
+            const QSizeF labelSize = labelRect.size();
             QPointF center = labelRect.center();
 
             qreal xPos = 0;
-            qreal yPos = m_layout.at(bar->layoutIndex()).center().y() - center.y();
+            qreal yPos = m_layout.at(index).center().y() - center.y();
 
             int xDiff = 0;
             if (angle != 0.0) {
-                label->setTransformOriginPoint(center.x(), center.y());
-                label->setRotation(m_series->d_func()->labelsAngle());
                 qreal oldWidth = labelRect.width();
                 labelRect = transform.mapRect(labelRect);
                 xDiff = (labelRect.width() - oldWidth) / 2;
             }
 
-            int offset = bar->pen().width() / 2 + 2;
-
             switch (m_series->labelsPosition()) {
             case QAbstractBarSeries::LabelsCenter:
-                xPos = m_layout.at(bar->layoutIndex()).center().x() - center.x();
+                xPos = m_layout.at(index).center().x() - center.x();
                 break;
             case QAbstractBarSeries::LabelsInsideEnd:
-                xPos = m_layout.at(bar->layoutIndex()).right() - labelRect.width() - offset + xDiff;
+                xPos = m_layout.at(index).right() - labelRect.width() - offset + xDiff;
                 break;
             case QAbstractBarSeries::LabelsInsideBase:
-                xPos = m_layout.at(bar->layoutIndex()).left() + offset + xDiff;
+                xPos = m_layout.at(index).left() + offset + xDiff;
                 break;
             case QAbstractBarSeries::LabelsOutsideEnd:
-                xPos = m_layout.at(bar->layoutIndex()).right() + offset + xDiff;
+                xPos = m_layout.at(index).right() + offset + xDiff;
                 break;
             default:
                 // Invalid position, never comes here
                 break;
             }
 
-            label->setPos(xPos, yPos);
-            label->setZValue(zValue() + 1);
+            // The rect is the unrotated label, which is rotated around its center
+            m_labelRects[index] = QRectF(QPointF(xPos, yPos), labelSize);
         }
     }
+    update();
 }
 
 void AbstractBarChartItem::handleBarValueChange(int index, QtCharts::QBarSet *barset)
@@ -399,17 +568,22 @@ void AbstractBarChartItem::handleBarValueRemove(int index, int count, QBarSet *b
     // Value removals from the middle of barset need to dirty the rest of the labels of the set.
     markLabelsDirty(barset, index, -1);
 
-    // make sure labels are not visible for removed bars
-    const auto bars = m_barMap.value(barset);
-    for (int c = barset->count(); c < bars.count(); ++c) {
-        auto label = bars.at(c)->labelItem();
-        if (label)
-            label->setVisible(false);
+    // make sure labels are not painted for removed bars
+    const int set = m_barSets.indexOf(barset);
+    if (set >= 0) {
+        for (int c = qMax(barset->count(), m_firstCategory); c <= m_lastCategory; ++c)
+            m_labelTexts[layoutIndex(set, c)] = QStaticText();
     }
 
     handleLayoutChanged();
 }
 
+void AbstractBarChartItem::handleBarValuesReplace(QBarSet *barset)
+{
+    // All labels of the set are dirty and any bars past the new end are gone
+    handleBarValueRemove(0, 0, barset);
+}
+
 void AbstractBarChartItem::handleSeriesAdded(QAbstractSeries *series)
 {
     Q_UNUSED(series)
@@ -429,6 +603,7 @@ void AbstractBarChartItem::handleSeriesRemoved(QAbstractSeries *series)
     // as the item will be scheduled for deletion but it is done asynchronously with deleteLater.
     QAbstractBarSeries *removedSeries = static_cast<QAbstractBarSeries *>(series);
     if (removedSeries == m_series) {
+        setHoveredBar(nullptr, -1);
         disconnect(m_series->d_func(), 0, this, 0);
         disconnect(m_series, 0, this, 0);
         disconnect(m_series->chart()->d_ptr->m_dataset, 0, this, 0);
@@ -442,109 +617,100 @@ void AbstractBarChartItem::positionLabelsVertical()
 {
     if (!m_series->isLabelsVisible())
         return;
-    createLabelItems();
 
     QTransform transform;
     const qreal angle = m_series->d_func()->labelsAngle();
     if (angle != 0.0)
         transform.rotate(angle);
 
-    int setCount = m_series->count();
+    const int setCount = m_barSets.size();
     for (int set = 0; set < setCount; set++) {
-        QBarSet *barSet = m_series->d_func()->barsetAt(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            QGraphicsTextItem *label = bar->labelItem();
-
-            QRectF labelRect = label->boundingRect();
+        const QBarSet *barSet = m_barSets.at(set);
+        if (!barSet)
+            continue;
+        const int offset = barSet->d_ptr->m_pen.width() / 2 + 2;
+        const QFont &font = barSet->d_ptr->m_labelFont;
+        const QFontMetricsF metrics(font);
+        for (int index = layoutIndex(set, m_firstCategory);
+             index <= layoutIndex(set, m_lastCategory); index++) {
+            QStaticText &text = m_labelTexts[index];
+            if (text.text().isEmpty())
+                continue;
+
+            QRectF labelRect = labelBoundingRect(text, font, metrics);
+            const QSizeF labelSize = labelRect.size();
             QPointF center = labelRect.center();
 
-            qreal xPos = m_layout.at(bar->layoutIndex()).center().x() - center.x();
+            qreal xPos = m_layout.at(index).center().x() - center.x();
             qreal yPos = 0;
 
             int yDiff = 0;
             if (angle != 0.0) {
-                label->setTransformOriginPoint(center.x(), center.y());
-                label->setRotation(m_series->d_func()->labelsAngle());
                 qreal oldHeight = labelRect.height();
                 labelRect = transform.mapRect(labelRect);
                 yDiff = (labelRect.height() - oldHeight) / 2;
             }
 
-            int offset = bar->pen().width() / 2 + 2;
-
             switch (m_series->labelsPosition()) {
             case QAbstractBarSeries::LabelsCenter:
-                yPos = m_layout.at(bar->layoutIndex()).center().y() - center.y();
+                yPos = m_layout.at(index).center().y() - center.y();
                 break;
             case QAbstractBarSeries::LabelsInsideEnd:
-                yPos = m_layout.at(bar->layoutIndex()).top() + offset + yDiff;
+                yPos = m_layout.at(index).top() + offset + yDiff;
                 break;
             case QAbstractBarSeries::LabelsInsideBase:
-                yPos = m_layout.at(bar->layoutIndex()).bottom() - labelRect.height() - offset + yDiff;
+                yPos = m_layout.at(index).bottom() - labelRect.height() - offset + yDiff;
                 break;
             case QAbstractBarSeries::LabelsOutsideEnd:
-                yPos = m_layout.at(bar->layoutIndex()).top() - labelRect.height() - offset + yDiff;
+                yPos = m_layout.at(index).top() - labelRect.height() - offset + yDiff;
                 break;
             default:
                 // Invalid position, never comes here
                 break;
             }
 
-            label->setPos(xPos, yPos);
-            label->setZValue(zValue() + 1);
+            // The rect is the unrotated label, which is rotated around its center
+            m_labelRects[index] = QRectF(QPointF(xPos, yPos), labelSize);
         }
     }
+    update();
 }
 
-void AbstractBarChartItem::createLabelItems()
+QRectF AbstractBarChartItem::labelBoundingRect(QStaticText &text, const QFont &font,
+                                               const QFontMetricsF &metrics)
 {
-    if (!m_labelItemsMissing)
-        return;
-
-    m_labelItemsMissing = false;
-
-    QMapIterator<QBarSet *, QList<Bar *> > i(m_barMap);
-    while (i.hasNext()) {
-        i.next();
-        const QList<Bar *> &bars = i.value();
-        for (int j = 0; j < bars.size(); j++) {
-            QGraphicsTextItem *label = bars.at(j)->labelItem();
-            if (!label) {
-                QGraphicsTextItem *newLabel = new QGraphicsTextItem(this);
-                newLabel->setAcceptHoverEvents(false);
-                newLabel->document()->setDocumentMargin(ChartPresenter::textMargin());
-                bars.at(j)->setLabelItem(newLabel);
-            }
-        }
-    }
+    // Plain text is measured directly, only rich text needs a full layout
+    const qreal margin = 2.0 * ChartPresenter::textMargin();
+    if (text.textFormat() == Qt::PlainText)
+        return QRectF(0, 0, metrics.width(text.text()) + margin, metrics.height() + margin);
+    text.prepare(QTransform(), font);
+    const QSizeF size = text.size();
+    return QRectF(0, 0, size.width() + margin, size.height() + margin);
 }
 
 // This function is called whenever barsets change
 void AbstractBarChartItem::handleSetStructureChange()
 {
     QList<QBarSet *> newSets = m_series->barSets();
-    QList<QBarSet *> oldSets = m_barMap.keys();
 
-    // Remove obsolete sets
-    for (int i = 0; i < oldSets.size(); i++) {
-        if (!newSets.contains(oldSets.at(i))) {
-            qDeleteAll(m_barMap.value(oldSets.at(i)));
-            m_barMap.remove(oldSets.at(i));
+    // Forget obsolete sets, their bars are dropped on the next layout update
+    for (int i = 0; i < m_barSets.size(); i++) {
+        QBarSet *set = m_barSets.at(i);
+        if (set && !newSets.contains(set)) {
+            if (m_hoveredSet == set)
+                setHoveredBar(nullptr, -1);
+            if (m_pressedSet == set)
+                m_pressedSet = nullptr;
+            m_barSets[i] = nullptr;
         }
     }
+    updateShape();
 
-    // Create new sets
+    // Dirty the old set labels to ensure labels are updated correctly on all series types
     for (int s = 0; s < newSets.size(); s++) {
         QBarSet *set = newSets.at(s);
-        if (!m_barMap.contains(set)) {
-            QList<Bar *> bars;
-            m_barMap.insert(set, bars);
-        } else {
-            // Dirty the old set labels to ensure labels are updated correctly on all series types
+        if (m_barSets.contains(set))
             markLabelsDirty(set, 0, -1);
-        }
     }
 
     if (themeManager())
@@ -580,6 +746,9 @@ void AbstractBarChartItem::updateBarItems()
         max = qCeil(domain()->maxY()) + 1;
     }
 
+    const int oldFirstCategory = m_firstCategory;
+    const int oldCategoryCount = m_categoryCount;
+
     int lastBarIndex = m_series->d_func()->categoryCount() - 1;
 
     if (lastBarIndex < 0) {
@@ -594,94 +763,49 @@ void AbstractBarChartItem::updateBarItems()
         m_categoryCount = m_lastCategory - m_firstCategory + 1;
     }
 
-    QList<QBarSet *> newSets = m_series->barSets();
-    QList<QBarSet *> oldSets = m_barMap.keys();
+    const QList<QBarSet *> newSets = m_series->barSets();
+    if (newSets == m_barSets && m_firstCategory == oldFirstCategory
+            && m_categoryCount == oldCategoryCount) {
+        return;
+    }
 
-    Q_ASSERT(newSets.size() == oldSets.size());
+    if (m_hoveredSet && (m_hoveredCategory < m_firstCategory
+                         || m_hoveredCategory > m_lastCategory)) {
+        setHoveredBar(nullptr, -1);
+    }
 
-    int layoutSize = m_categoryCount * newSets.size();
+    const int layoutSize = m_categoryCount * newSets.size();
 
-    QVector<QRectF> oldLayout = m_layout;
-    if (layoutSize != m_layout.size())
-        m_layout.resize(layoutSize);
+    const QVector<QRectF> oldLayout = m_layout;
+    const QVector<QStaticText> oldLabelTexts = m_labelTexts;
+    const QVector<QRectF> oldLabelRects = m_labelRects;
+    const QVector<bool> oldLabelDirty = m_labelDirty;
+    m_layout = QVector<QRectF>(layoutSize);
+    m_labelTexts = QVector<QStaticText>(layoutSize);
+    m_labelRects = QVector<QRectF>(layoutSize);
+    m_labelDirty = QVector<bool>(layoutSize, true);
 
-    // Create new graphic items for bars or remove excess ones
-    int layoutIndex = 0;
+    // Keep the rects and labels of bars that stay visible, bars that came into view
+    // get their labels formatted on the next update
     for (int s = 0; s < newSets.size(); s++) {
-        QBarSet *set = newSets.at(s);
-        QList<Bar *> bars = m_barMap.value(set);
-        int addCount = m_categoryCount - bars.size();
-        if (addCount > 0) {
-            for (int c = 0; c < addCount; c++) {
-                Bar *bar = new Bar(set, this);
-                bars.append(bar);
-                connect(bar, &Bar::clicked, m_series, &QAbstractBarSeries::clicked);
-                connect(bar, &Bar::hovered, m_series, &QAbstractBarSeries::hovered);
-                connect(bar, &Bar::pressed, m_series, &QAbstractBarSeries::pressed);
-                connect(bar, &Bar::released, m_series, &QAbstractBarSeries::released);
-                connect(bar, &Bar::doubleClicked, m_series, &QAbstractBarSeries::doubleClicked);
-
-                connect(bar, &Bar::clicked, set, &QBarSet::clicked);
-                connect(bar, &Bar::hovered, set, &QBarSet::hovered);
-                connect(bar, &Bar::pressed, set, &QBarSet::pressed);
-                connect(bar, &Bar::released, set, &QBarSet::released);
-                connect(bar, &Bar::doubleClicked, set, &QBarSet::doubleClicked);
-
-                m_labelItemsMissing = true;
+        const int oldSet = m_barSets.indexOf(newSets.at(s));
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int index = layoutIndex(s, category);
+            const int oldCategory = category - oldFirstCategory;
+            if (oldSet >= 0 && oldCategory >= 0 && oldCategory < oldCategoryCount) {
+                const int oldIndex = oldSet * oldCategoryCount + oldCategory;
+                m_layout[index] = oldLayout.at(oldIndex);
+                m_labelTexts[index] = oldLabelTexts.at(oldIndex);
+                m_labelRects[index] = oldLabelRects.at(oldIndex);
+                m_labelDirty[index] = oldLabelDirty.at(oldIndex);
+            } else if (m_animation) {
+                initializeLayout(s, category, index, m_resetAnimation);
             }
         }
-        // Update bar indexes
-        QHash<int, Bar*> indexMap;
-        QVector<Bar *> unassignedBars(m_categoryCount, nullptr);
-        int unassignedIndex(0);
-        QList<Bar *> newBars;
-        newBars.reserve(m_categoryCount);
-        for (int c = 0; c < bars.size(); c++) {
-            Bar *bar = bars.at(c);
-            if (bar->index() < m_firstCategory || bar->index() > m_lastCategory) {
-                // Delete excess unassigned bars first
-                if (addCount < 0) {
-                    addCount++;
-                    delete bar;
-                    bar = nullptr;
-                } else {
-                    unassignedBars[unassignedIndex++] = bar;
-                    bar->setLayoutIndex(layoutIndex);
-                    newBars.append(bar);
-                    layoutIndex++;
-                }
-            } else {
-                indexMap.insert(bar->index(), bar);
-                newBars.append(bar);
-                m_layout[layoutIndex] = oldLayout.at(bar->layoutIndex());
-                bar->setLayoutIndex(layoutIndex);
-                layoutIndex++;
-            }
-        }
-        unassignedIndex = 0;
-        for (int c = m_firstCategory; c <= m_lastCategory; c++) {
-            Bar *bar = indexMap.value(c);
-            if (!bar) {
-                bar = unassignedBars.at(unassignedIndex++);
-                bar->setIndex(c);
-                indexMap.insert(bar->index(), bar);
-            }
-        }
-
-        m_indexForBarMap.insert(set, indexMap);
-
-        if (m_animation) {
-            for (int i = 0; i < unassignedIndex; i++) {
-                Bar *bar = unassignedBars.at(i);
-                initializeLayout(s, bar->index(), bar->layoutIndex(), m_resetAnimation);
-                bar->setRect(m_layout.at(bar->layoutIndex()));
-                // Make bar initially hidden to avoid artifacts, layout setting will show it
-                bar->setVisible(false);
-            }
-        }
-
-        m_barMap.insert(set, newBars);
     }
+
+    m_barSets = newSets;
+    updateShape();
 }
 
 void AbstractBarChartItem::markLabelsDirty(QBarSet *barset, int index, int count)
@@ -691,13 +815,13 @@ void AbstractBarChartItem::markLabelsDirty(QBarSet *barset, int index, int count
     if (index <= 0 && count < 0) {
         barset->d_ptr.data()->setLabelsDirty(true);
     } else {
-        const QList<Bar *> bars = m_barMap.value(barset);
+        const int set = m_barSets.indexOf(barset);
+        if (set < 0)
+            return;
         const int maxIndex = count > 0 ? index + count : barset->count();
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            if (bar->index() >= index && bar->index() < maxIndex)
-                bar->setLabelDirty(true);
-        }
+        const int last = qMin(maxIndex - 1, m_lastCategory);
+        for (int category = qMax(index, m_firstCategory); category <= last; category++)
+            m_labelDirty[layoutIndex(set, category)] = true;
     }
 }
 
@@ -45,10 +45,12 @@
 #include <QtCharts/private/qchartglobal_p.h>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
+#include <QtGui/QPainterPath>
+#include <QtGui/QStaticText>
+#include <QtGui/QFontMetricsF>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-class Bar;
 class QAxisCategories;
 class QChart;
 class BarAnimation;
@@ -65,10 +67,12 @@ public:
 public:
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
     QRectF boundingRect() const;
+    QPainterPath shape() const;
+    bool contains(const QPointF &point) const;
 
     virtual QVector<QRectF> calculateLayout() = 0;
     void initializeFullLayout();
-    virtual void initializeLayout(int set, int category, int layoutIndex, bool resetAnimation) = 0;
+    virtual void initializeLayout(int set, int category, int index, bool resetAnimation) = 0;
     virtual void applyLayout(const QVector<QRectF> &layout);
     virtual void setAnimation(BarAnimation *animation);
     virtual ChartAnimation *animation() const;
@@ -89,12 +93,29 @@ public Q_SLOTS:
     void handleBarValueChange(int index, QBarSet *barset);
     void handleBarValueAdd(int index, int count, QBarSet *barset);
     void handleBarValueRemove(int index, int count, QBarSet *barset);
+    void handleBarValuesReplace(QBarSet *barset);
     void handleSeriesAdded(QAbstractSeries *series);
     void handleSeriesRemoved(QAbstractSeries *series);
 
 protected:
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
+
+    // Bars are stored set by set, each set holding one rect per visible category
+    int layoutIndex(int set, int category) const
+    {
+        return set * m_categoryCount + category - m_firstCategory;
+    }
+    int barIndexAt(const QPointF &pos) const;
+    void setHoveredBar(QBarSet *barset, int category);
+    void updateShape();
+
     void positionLabelsVertical();
-    void createLabelItems();
+    QRectF labelBoundingRect(QStaticText &text, const QFont &font, const QFontMetricsF &metrics);
     void handleSetStructureChange();
     virtual QString generateLabelText(int set, int category, qreal value);
     void updateBarItems();
@@ -103,17 +124,23 @@ protected:
 
     QRectF m_rect;
     QVector<QRectF> m_layout;
+    QPainterPath m_shape;
 
     BarAnimation *m_animation;
 
     QAbstractBarSeries *m_series; // Not owned.
-    QMap<QBarSet *, QList<Bar *> > m_barMap;
-    QMap<QBarSet *, QHash<int, Bar *> > m_indexForBarMap;
+    QList<QBarSet *> m_barSets; // Sets in layout order, removed sets are null until relayout
+    QVector<QStaticText> m_labelTexts; // Empty for bars without a label
+    QVector<QRectF> m_labelRects; // Unrotated label rects, rotated around their centers
+    QVector<bool> m_labelDirty;
+    QBarSet *m_hoveredSet;
+    int m_hoveredCategory;
+    QBarSet *m_pressedSet;
+    int m_pressedCategory;
     int m_firstCategory;
     int m_lastCategory;
     int m_categoryCount;
     QSizeF m_oldSize;
-    bool m_labelItemsMissing;
     Qt::Orientation m_orientation;
     bool m_resetAnimation;
     qreal m_seriesPosAdjustment;
@@ -4,12 +4,12 @@ INCLUDEPATH += $$PWD \
     $$PWD/vertical/bar \
     $$PWD/vertical/stacked \
     $$PWD/vertical/percent \
+    $$PWD/vertical/histogram \
     $$PWD/horizontal/bar \
     $$PWD/horizontal/stacked \
     $$PWD/horizontal/percent
 
 SOURCES += \
-    $$PWD/bar.cpp \
     $$PWD/abstractbarchartitem.cpp \
     $$PWD/qabstractbarseries.cpp \  
     $$PWD/qbarset.cpp \
@@ -22,6 +22,7 @@ SOURCES += \
     $$PWD/vertical/stacked/stackedbarchartitem.cpp \
     $$PWD/vertical/percent/qpercentbarseries.cpp \
     $$PWD/vertical/percent/percentbarchartitem.cpp \
+    $$PWD/vertical/histogram/qhistogramseries.cpp \
     $$PWD/horizontal/bar/qhorizontalbarseries.cpp \
     $$PWD/horizontal/bar/horizontalbarchartitem.cpp \
     $$PWD/horizontal/stacked/qhorizontalstackedbarseries.cpp \
@@ -30,7 +31,6 @@ SOURCES += \
     $$PWD/horizontal/percent/horizontalpercentbarchartitem.cpp
 
 PRIVATE_HEADERS += \
-    $$PWD/bar_p.h \
     $$PWD/qbarset_p.h \
     $$PWD/abstractbarchartitem_p.h \
     $$PWD/qabstractbarseries_p.h \
@@ -41,6 +41,7 @@ PRIVATE_HEADERS += \
     $$PWD/vertical/stacked/stackedbarchartitem_p.h \
     $$PWD/vertical/percent/qpercentbarseries_p.h \
     $$PWD/vertical/percent/percentbarchartitem_p.h \
+    $$PWD/vertical/histogram/qhistogramseries_p.h \
     $$PWD/horizontal/bar/qhorizontalbarseries_p.h \
     $$PWD/horizontal/bar/horizontalbarchartitem_p.h \
     $$PWD/horizontal/stacked/qhorizontalstackedbarseries_p.h \
@@ -57,6 +58,7 @@ PUBLIC_HEADERS += \
     $$PWD/vertical/bar/qbarseries.h \
     $$PWD/vertical/stacked/qstackedbarseries.h \
     $$PWD/vertical/percent/qpercentbarseries.h \
+    $$PWD/vertical/histogram/qhistogramseries.h \
     $$PWD/horizontal/bar/qhorizontalbarseries.h \
     $$PWD/horizontal/stacked/qhorizontalstackedbarseries.h \
     $$PWD/horizontal/percent/qhorizontalpercentbarseries.h
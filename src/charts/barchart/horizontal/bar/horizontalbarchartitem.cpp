@@ -30,7 +30,6 @@
 #include <private/horizontalbarchartitem_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <private/qbarset_p.h>
-#include <private/bar_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -40,14 +39,12 @@ HorizontalBarChartItem::HorizontalBarChartItem(QAbstractBarSeries *series, QGrap
 }
 
 void HorizontalBarChartItem::initializeLayout(int set, int category,
-                                              int layoutIndex, bool resetAnimation)
+                                              int index, bool resetAnimation)
 {
     QRectF rect;
 
     if (set > 0) {
-        QBarSet *barSet = m_series->barSets().at(set - 1);
-        Bar *bar = m_indexForBarMap.value(barSet).value(category);
-        rect = m_layout.at(bar->layoutIndex());
+        rect = m_layout.at(layoutIndex(set - 1, category));
         qreal oldTop = rect.top();
         if (resetAnimation)
             rect.setTop(oldTop - rect.height());
@@ -72,7 +69,7 @@ void HorizontalBarChartItem::initializeLayout(int set, int category,
             rect.setBottomRight(bottomRight);
         }
     }
-    m_layout[layoutIndex] = rect.normalized();
+    m_layout[index] = rect.normalized();
 }
 
 QPointF HorizontalBarChartItem::topLeftPoint(int set, int setCount, int category,
@@ -103,10 +100,8 @@ QVector<QRectF> HorizontalBarChartItem::calculateLayout()
 
     for (int set = 0; set < setCount; set++) {
         QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < m_categoryCount; i++) {
-            Bar *bar = bars.at(i);
-            const int category = bar->index();
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int index = layoutIndex(set, category);
             qreal value = barSet->at(category);
             QRectF rect;
             QPointF topLeft;
@@ -120,7 +115,7 @@ QVector<QRectF> HorizontalBarChartItem::calculateLayout()
             QPointF bottomRight = bottomRightPoint(set, setCount, category, barWidth, value);
             rect.setTopLeft(topLeft);
             rect.setBottomRight(bottomRight);
-            layout[bar->layoutIndex()] = rect.normalized();
+            layout[index] = rect.normalized();
         }
     }
     return layout;
@@ -53,7 +53,7 @@ public:
 
 private:
     virtual QVector<QRectF> calculateLayout();
-    void initializeLayout(int set, int category, int layoutIndex, bool resetAnimation);
+    void initializeLayout(int set, int category, int index, bool resetAnimation);
     QPointF topLeftPoint(int set, int setCount, int category, qreal barWidth, qreal value);
     QPointF bottomRightPoint(int set, int setCount, int category, qreal barWidth, qreal value);
 };
@@ -30,7 +30,6 @@
 #include <private/horizontalstackedbarchartitem_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <private/qbarset_p.h>
-#include <private/bar_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -40,7 +39,7 @@ HorizontalStackedBarChartItem::HorizontalStackedBarChartItem(QAbstractBarSeries
 }
 
 void HorizontalStackedBarChartItem::initializeLayout(int set, int category,
-                                                     int layoutIndex, bool resetAnimation)
+                                                     int index, bool resetAnimation)
 {
     Q_UNUSED(set)
     Q_UNUSED(resetAnimation)
@@ -58,17 +57,14 @@ void HorizontalStackedBarChartItem::initializeLayout(int set, int category,
             QBarSet *checkSet = m_series->barSets().at(checkIndex);
             const qreal checkValue = checkSet->at(category);
             if ((value < 0.0) == (checkValue < 0.0)) {
-                Bar *checkBar = m_indexForBarMap.value(checkSet).value(category);
-                rect = m_layout.at(checkBar->layoutIndex());
+                rect = m_layout.at(layoutIndex(checkIndex, category));
                 found = true;
                 break;
             }
         }
         // If we didn't find a previous set to the same direction, just stack next to the first set
         if (!found) {
-            QBarSet *firsSet = m_series->barSets().at(0);
-            Bar *firstBar = m_indexForBarMap.value(firsSet).value(category);
-            rect = m_layout.at(firstBar->layoutIndex());
+            rect = m_layout.at(layoutIndex(0, category));
         }
         if (value < 0)
             rect.setRight(rect.left());
@@ -93,7 +89,7 @@ void HorizontalStackedBarChartItem::initializeLayout(int set, int category,
             rect.setBottomRight(bottomRight);
         }
     }
-    m_layout[layoutIndex] = rect.normalized();
+    m_layout[index] = rect.normalized();
 }
 
 QPointF HorizontalStackedBarChartItem::topLeftPoint(int category, qreal barWidth, qreal value)
@@ -121,10 +117,8 @@ QVector<QRectF> HorizontalStackedBarChartItem::calculateLayout()
 
     for (int set = 0; set < setCount; set++) {
         QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < m_categoryCount; i++) {
-            Bar *bar = bars.at(i);
-            const int category = bar->index();
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int index = layoutIndex(set, category);
             qreal &positiveSum = positiveSums[category - m_firstCategory];
             qreal &negativeSum = negativeSums[category - m_firstCategory];
             qreal value = barSet->at(category);
@@ -157,17 +151,17 @@ QVector<QRectF> HorizontalStackedBarChartItem::calculateLayout()
             rect.setTopLeft(topLeft);
             rect.setBottomRight(bottomRight);
             rect = rect.normalized();
-            layout[bar->layoutIndex()] = rect;
+            layout[index] = rect;
 
             // If animating, we need to reinitialize ~zero size bars with non-zero values
             // so the bar growth animation starts at correct spot. We shouldn't reset if rect
             // is already at correct position horizontally, so we check for that.
             if (m_animation && value != 0.0) {
-                const QRectF &checkRect = m_layout.at(bar->layoutIndex());
+                const QRectF &checkRect = m_layout.at(index);
                 if (checkRect.isEmpty() &&
                         ((value < 0.0 && !qFuzzyCompare(checkRect.right(), rect.right()))
                          || (value > 0.0 && !qFuzzyCompare(checkRect.left(), rect.left())))) {
-                    initializeLayout(set, category, bar->layoutIndex(), true);
+                    initializeLayout(set, category, index, true);
                 }
             }
         }
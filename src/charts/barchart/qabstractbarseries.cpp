@@ -675,7 +675,14 @@ QAbstractBarSeriesPrivate::QAbstractBarSeriesPrivate(QAbstractBarSeries *q) :
     m_labelsAngle(0),
     m_labelsPrecision(6),
     m_visualsDirty(true),
-    m_labelsDirty(true)
+    m_labelsDirty(true),
+    m_categoryAggregatesDirty(true),
+    m_min(0),
+    m_max(0),
+    m_top(0),
+    m_bottom(0),
+    m_maxCategorySum(0),
+    m_seriesExtentsDirty(true)
 {
 }
 
@@ -726,17 +733,8 @@ qreal QAbstractBarSeriesPrivate::min()
     if (m_barSets.count() <= 0)
         return 0;
 
-    qreal min = INT_MAX;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->at(j);
-            if (temp < min)
-                min = temp;
-        }
-    }
-    return min;
+    ensureSeriesExtents();
+    return m_min;
 }
 
 qreal QAbstractBarSeriesPrivate::max()
@@ -744,18 +742,8 @@ qreal QAbstractBarSeriesPrivate::max()
     if (m_barSets.count() <= 0)
         return 0;
 
-    qreal max = INT_MIN;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->at(j);
-            if (temp > max)
-                max = temp;
-        }
-    }
-
-    return max;
+    ensureSeriesExtents();
+    return m_max;
 }
 
 qreal QAbstractBarSeriesPrivate::valueAt(int set, int category)
@@ -785,36 +773,20 @@ qreal QAbstractBarSeriesPrivate::percentageAt(int set, int category)
 
 qreal QAbstractBarSeriesPrivate::categorySum(int category)
 {
-    qreal sum(0);
-    int count = m_barSets.count(); // Count sets
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count())
-            sum += m_barSets.at(set)->at(category);
-    }
-    return sum;
+    ensureCategoryAggregates();
+    return m_categorySums.value(category);
 }
 
 qreal QAbstractBarSeriesPrivate::absoluteCategorySum(int category)
 {
-    qreal sum(0);
-    int count = m_barSets.count(); // Count sets
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count())
-            sum += qAbs(m_barSets.at(set)->at(category));
-    }
-    return sum;
+    ensureCategoryAggregates();
+    return m_absoluteCategorySums.value(category);
 }
 
 qreal QAbstractBarSeriesPrivate::maxCategorySum()
 {
-    qreal max = INT_MIN;
-    int count = categoryCount();
-    for (int i = 0; i < count; i++) {
-        qreal sum = categorySum(i);
-        if (sum > max)
-            max = sum;
-    }
-    return max;
+    ensureSeriesExtents();
+    return m_maxCategorySum;
 }
 
 qreal QAbstractBarSeriesPrivate::minX()
@@ -822,17 +794,8 @@ qreal QAbstractBarSeriesPrivate::minX()
     if (m_barSets.count() <= 0)
         return 0;
 
-    qreal min = INT_MAX;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_ptr.data()->m_values.at(j).x();
-            if (temp < min)
-                min = temp;
-        }
-    }
-    return min;
+    // Values are positioned at their indexes
+    return categoryCount() > 0 ? 0 : INT_MAX;
 }
 
 qreal QAbstractBarSeriesPrivate::maxX()
@@ -840,78 +803,123 @@ qreal QAbstractBarSeriesPrivate::maxX()
     if (m_barSets.count() <= 0)
         return 0;
 
-    qreal max = INT_MIN;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_ptr.data()->m_values.at(j).x();
-            if (temp > max)
-                max = temp;
-        }
-    }
-
-    return max;
+    const int count = categoryCount();
+    return count > 0 ? count - 1 : INT_MIN;
 }
 
 qreal QAbstractBarSeriesPrivate::categoryTop(int category)
 {
     // Returns top (sum of all positive values) of category.
     // Returns 0, if all values are negative
-    qreal top(0);
-    int count = m_barSets.count();
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count()) {
-            qreal temp = m_barSets.at(set)->at(category);
-            if (temp > 0) {
-                top += temp;
-            }
-        }
-    }
-    return top;
+    ensureCategoryAggregates();
+    return m_categoryTops.value(category);
 }
 
 qreal QAbstractBarSeriesPrivate::categoryBottom(int category)
 {
     // Returns bottom (sum of all negative values) of category
     // Returns 0, if all values are positive
-    qreal bottom(0);
-    int count = m_barSets.count();
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count()) {
-            qreal temp = m_barSets.at(set)->at(category);
-            if (temp < 0) {
-                bottom += temp;
-            }
-        }
-    }
-    return bottom;
+    ensureCategoryAggregates();
+    return m_categoryBottoms.value(category);
 }
 
 qreal QAbstractBarSeriesPrivate::top()
 {
     // Returns top of all categories
-    qreal top(0);
-    int count = categoryCount();
-    for (int i = 0; i < count; i++) {
-        qreal temp = categoryTop(i);
-        if (temp > top)
-            top = temp;
-    }
-    return top;
+    ensureSeriesExtents();
+    return m_top;
 }
 
 qreal QAbstractBarSeriesPrivate::bottom()
 {
     // Returns bottom of all categories
-    qreal bottom(0);
-    int count = categoryCount();
-    for (int i = 0; i < count; i++) {
-        qreal temp = categoryBottom(i);
-        if (temp < bottom)
-            bottom = temp;
+    ensureSeriesExtents();
+    return m_bottom;
+}
+
+void QAbstractBarSeriesPrivate::invalidateCategoryAggregates()
+{
+    m_categoryAggregatesDirty = true;
+    m_seriesExtentsDirty = true;
+}
+
+// Recalculates the aggregates of the categories from firstCategory to lastCategory, or to the
+// last category if lastCategory is -1. Appending, inserting or removing values in a set shifts
+// the categories after the change, so those need to be recalculated to the end.
+void QAbstractBarSeriesPrivate::updateCategoryAggregates(int firstCategory, int lastCategory)
+{
+    if (m_categoryAggregatesDirty)
+        return; // Everything is recalculated on the next query anyway
+
+    const int count = categoryCount();
+    m_categorySums.resize(count);
+    m_absoluteCategorySums.resize(count);
+    m_categoryTops.resize(count);
+    m_categoryBottoms.resize(count);
+    m_categoryMins.resize(count);
+    m_categoryMaxs.resize(count);
+
+    if (lastCategory < 0 || lastCategory >= count)
+        lastCategory = count - 1;
+    for (int category = qMax(firstCategory, 0); category <= lastCategory; category++) {
+        qreal sum(0);
+        qreal absoluteSum(0);
+        qreal top(0);
+        qreal bottom(0);
+        qreal min = INT_MAX;
+        qreal max = INT_MIN;
+        for (int set = 0; set < m_barSets.count(); set++) {
+            const QBarSet *barSet = m_barSets.at(set);
+            if (category >= barSet->count())
+                continue;
+            const qreal value = barSet->at(category);
+            sum += value;
+            absoluteSum += qAbs(value);
+            if (value > 0)
+                top += value;
+            else if (value < 0)
+                bottom += value;
+            min = qMin(min, value);
+            max = qMax(max, value);
+        }
+        m_categorySums[category] = sum;
+        m_absoluteCategorySums[category] = absoluteSum;
+        m_categoryTops[category] = top;
+        m_categoryBottoms[category] = bottom;
+        m_categoryMins[category] = min;
+        m_categoryMaxs[category] = max;
+    }
+    m_seriesExtentsDirty = true;
+}
+
+void QAbstractBarSeriesPrivate::ensureCategoryAggregates()
+{
+    if (!m_categoryAggregatesDirty)
+        return;
+
+    m_categoryAggregatesDirty = false;
+    updateCategoryAggregates(0);
+}
+
+void QAbstractBarSeriesPrivate::ensureSeriesExtents()
+{
+    ensureCategoryAggregates();
+    if (!m_seriesExtentsDirty)
+        return;
+
+    m_seriesExtentsDirty = false;
+    m_min = INT_MAX;
+    m_max = INT_MIN;
+    m_top = 0;
+    m_bottom = 0;
+    m_maxCategorySum = INT_MIN;
+    for (int i = 0; i < m_categorySums.size(); i++) {
+        m_min = qMin(m_min, m_categoryMins.at(i));
+        m_max = qMax(m_max, m_categoryMaxs.at(i));
+        m_top = qMax(m_top, m_categoryTops.at(i));
+        m_bottom = qMin(m_bottom, m_categoryBottoms.at(i));
+        m_maxCategorySum = qMax(m_maxCategorySum, m_categorySums.at(i));
     }
-    return bottom;
 }
 
 bool QAbstractBarSeriesPrivate::blockBarUpdate()
@@ -969,7 +977,10 @@ bool QAbstractBarSeriesPrivate::append(QBarSet *set)
                      this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
     QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                      this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+    QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                     this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
 
+    invalidateCategoryAggregates();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -988,7 +999,10 @@ bool QAbstractBarSeriesPrivate::remove(QBarSet *set)
                         this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
     QObject::disconnect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                         this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+    QObject::disconnect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                        this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
 
+    invalidateCategoryAggregates();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -1012,8 +1026,11 @@ bool QAbstractBarSeriesPrivate::append(QList<QBarSet * > sets)
                          this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
         QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                          this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+        QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                         this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
     }
 
+    invalidateCategoryAggregates();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -1040,8 +1057,11 @@ bool QAbstractBarSeriesPrivate::remove(QList<QBarSet * > sets)
                             this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
         QObject::disconnect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                             this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+        QObject::disconnect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                            this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
     }
 
+    invalidateCategoryAggregates();
     emit restructuredBars();        // this notifies barchartitem
 
     return true;
@@ -1061,7 +1081,10 @@ bool QAbstractBarSeriesPrivate::insert(int index, QBarSet *set)
                      this, &QAbstractBarSeriesPrivate::handleSetValueAdd);
     QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valueRemoved,
                      this, &QAbstractBarSeriesPrivate::handleSetValueRemove);
+    QObject::connect(set->d_ptr.data(), &QBarSetPrivate::valuesReplaced,
+                     this, &QAbstractBarSeriesPrivate::handleSetValuesReplace);
 
+    invalidateCategoryAggregates();
     emit restructuredBars();      // this notifies barchartitem
     return true;
 }
@@ -1130,22 +1153,37 @@ QAbstractAxis::AxisType QAbstractBarSeriesPrivate::defaultAxisType(Qt::Orientati
 void QAbstractBarSeriesPrivate::handleSetValueChange(int index)
 {
     QBarSetPrivate *priv = qobject_cast<QBarSetPrivate *>(sender());
-    if (priv)
+    if (priv) {
+        updateCategoryAggregates(index, index);
         emit setValueChanged(index, priv->q_ptr);
+    }
 }
 
 void QAbstractBarSeriesPrivate::handleSetValueAdd(int index, int count)
 {
     QBarSetPrivate *priv = qobject_cast<QBarSetPrivate *>(sender());
-    if (priv)
+    if (priv) {
+        updateCategoryAggregates(index);
         emit setValueAdded(index, count, priv->q_ptr);
+    }
 }
 
 void QAbstractBarSeriesPrivate::handleSetValueRemove(int index, int count)
 {
     QBarSetPrivate *priv = qobject_cast<QBarSetPrivate *>(sender());
-    if (priv)
+    if (priv) {
+        updateCategoryAggregates(index);
         emit setValueRemoved(index, count, priv->q_ptr);
+    }
+}
+
+void QAbstractBarSeriesPrivate::handleSetValuesReplace()
+{
+    QBarSetPrivate *priv = qobject_cast<QBarSetPrivate *>(sender());
+    if (priv) {
+        invalidateCategoryAggregates();
+        emit setValuesReplaced(priv->q_ptr);
+    }
 }
 
 void QAbstractBarSeriesPrivate::populateCategories(QBarCategoryAxis *axis)
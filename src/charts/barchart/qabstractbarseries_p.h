@@ -116,14 +116,20 @@ Q_SIGNALS:
     void setValueChanged(int index, QBarSet *barset);
     void setValueAdded(int index, int count, QBarSet *barset);
     void setValueRemoved(int index, int count, QBarSet *barset);
+    void setValuesReplaced(QBarSet *barset);
 
 private Q_SLOTS:
     void handleSetValueChange(int index);
     void handleSetValueAdd(int index, int count);
     void handleSetValueRemove(int index, int count);
+    void handleSetValuesReplace();
 
 private:
     void populateCategories(QBarCategoryAxis *axis);
+    void invalidateCategoryAggregates();
+    void updateCategoryAggregates(int firstCategory, int lastCategory = -1);
+    void ensureCategoryAggregates();
+    void ensureSeriesExtents();
 
 protected:
     QList<QBarSet *> m_barSets;
@@ -138,6 +144,22 @@ protected:
     bool m_visualsDirty;
     bool m_labelsDirty;
 
+    // Per category aggregates over all sets, kept up to date as set values change
+    QVector<qreal> m_categorySums;
+    QVector<qreal> m_absoluteCategorySums;
+    QVector<qreal> m_categoryTops;
+    QVector<qreal> m_categoryBottoms;
+    QVector<qreal> m_categoryMins;
+    QVector<qreal> m_categoryMaxs;
+    bool m_categoryAggregatesDirty;
+    // Series wide extents, derived from the category aggregates on demand
+    qreal m_min;
+    qreal m_max;
+    qreal m_top;
+    qreal m_bottom;
+    qreal m_maxCategorySum;
+    bool m_seriesExtentsDirty;
+
 private:
     Q_DECLARE_PUBLIC(QAbstractBarSeries)
     friend class HorizontalBarChartItem;
@@ -208,6 +208,25 @@ void QBarModelMapper::setLastBarSetSection(int lastBarSetSection)
     d->initializeBarFromModel();
 }
 
+/*!
+    Returns the item data role that is used to read and write the bar set values of the model.
+*/
+int QBarModelMapper::dataRole() const
+{
+    Q_D(const QBarModelMapper);
+    return d->m_role;
+}
+
+/*!
+    Sets the item data role that is used to read and write the bar set values of the model to \a role.
+*/
+void QBarModelMapper::setDataRole(int role)
+{
+    Q_D(QBarModelMapper);
+    d->m_role = role;
+    d->initializeBarFromModel();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QBarModelMapperPrivate::QBarModelMapperPrivate(QBarModelMapper *q) :
@@ -217,6 +236,7 @@ QBarModelMapperPrivate::QBarModelMapperPrivate(QBarModelMapper *q) :
     m_first(0),
     m_count(-1),
     m_orientation(Qt::Vertical),
+    m_role(Qt::DisplayRole),
     m_firstBarSetSection(-1),
     m_lastBarSetSection(-1),
     m_seriesSignalsBlock(false),
@@ -289,9 +309,9 @@ void QBarModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex botto
             QBarSet *bar = barSet(index);
             if (bar) {
                 if (m_orientation == Qt::Vertical)
-                    bar->replace(row - m_first, m_model->data(index).toReal());
+                    bar->replace(row - m_first, m_model->data(index, m_role).toReal());
                 else
-                    bar->replace(column - m_first, m_model->data(index).toReal());
+                    bar->replace(column - m_first, m_model->data(index, m_role).toReal());
             }
         }
     }
@@ -441,7 +461,7 @@ void QBarModelMapperPrivate::barSetsAdded(QList<QBarSet *> sets)
     for (int i = firstIndex + m_firstBarSetSection; i < firstIndex + m_firstBarSetSection + sets.count(); i++) {
         m_model->setHeaderData(i, m_orientation == Qt::Vertical ? Qt::Horizontal : Qt::Vertical, sets.at(i - firstIndex - m_firstBarSetSection)->label());
         for (int j = 0; j < sets.at(i - firstIndex - m_firstBarSetSection)->count(); j++)
-            m_model->setData(barModelIndex(i, j), sets.at(i - firstIndex - m_firstBarSetSection)->at(j));
+            m_model->setData(barModelIndex(i, j), sets.at(i - firstIndex - m_firstBarSetSection)->at(j), m_role);
     }
     blockModelSignals(false);
     initializeBarFromModel();
@@ -490,7 +510,7 @@ void QBarModelMapperPrivate::valuesAdded(int index, int count)
         m_model->insertColumns(index + m_first, count);
 
     for (int j = index; j < index + count; j++)
-        m_model->setData(barModelIndex(barSetIndex + m_firstBarSetSection, j), m_barSets.at(barSetIndex)->at(j));
+        m_model->setData(barModelIndex(barSetIndex + m_firstBarSetSection, j), m_barSets.at(barSetIndex)->at(j), m_role);
 
     blockModelSignals(false);
     initializeBarFromModel();
@@ -535,7 +555,48 @@ void QBarModelMapperPrivate::barValueChanged(int index)
     int barSetIndex = m_barSets.indexOf(qobject_cast<QBarSet *>(QObject::sender()));
 
     blockModelSignals();
-    m_model->setData(barModelIndex(barSetIndex + m_firstBarSetSection, index), m_barSets.at(barSetIndex)->at(index));
+    m_model->setData(barModelIndex(barSetIndex + m_firstBarSetSection, index), m_barSets.at(barSetIndex)->at(index), m_role);
+    blockModelSignals(false);
+    initializeBarFromModel();
+}
+
+void QBarModelMapperPrivate::barValuesReplaced()
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    QBarSet *set = qobject_cast<QBarSet *>(QObject::sender());
+    int barSetIndex = m_barSets.indexOf(set);
+    if (barSetIndex == -1)
+        return;
+
+    const int section = barSetIndex + m_firstBarSetSection;
+    int oldCount = 0;
+    while (barModelIndex(section, oldCount).isValid())
+        oldCount++;
+    const int newCount = set->count();
+
+    blockModelSignals();
+    // the mapped range grows or shrinks at its end to the number of new values
+    if (newCount > oldCount) {
+        if (m_count != -1)
+            m_count += newCount - oldCount;
+        if (m_orientation == Qt::Vertical)
+            m_model->insertRows(oldCount + m_first, newCount - oldCount);
+        else
+            m_model->insertColumns(oldCount + m_first, newCount - oldCount);
+    } else if (newCount < oldCount) {
+        if (m_count != -1)
+            m_count -= oldCount - newCount;
+        if (m_orientation == Qt::Vertical)
+            m_model->removeRows(newCount + m_first, oldCount - newCount);
+        else
+            m_model->removeColumns(newCount + m_first, oldCount - newCount);
+    }
+
+    for (int j = 0; j < newCount; j++)
+        m_model->setData(barModelIndex(section, j), set->at(j), m_role);
+
     blockModelSignals(false);
     initializeBarFromModel();
 }
@@ -558,13 +619,14 @@ void QBarModelMapperPrivate::initializeBarFromModel()
         if (barIndex.isValid()) {
             QBarSet *barSet = new QBarSet(m_model->headerData(i, m_orientation == Qt::Vertical ? Qt::Horizontal : Qt::Vertical).toString());
             while (barIndex.isValid()) {
-                barSet->append(m_model->data(barIndex, Qt::DisplayRole).toDouble());
+                barSet->append(m_model->data(barIndex, m_role).toDouble());
                 posInBar++;
                 barIndex = barModelIndex(i, posInBar);
             }
             connect(barSet, SIGNAL(valuesAdded(int,int)), this, SLOT(valuesAdded(int,int)));
             connect(barSet, SIGNAL(valuesRemoved(int,int)), this, SLOT(valuesRemoved(int,int)));
             connect(barSet, SIGNAL(valueChanged(int)), this, SLOT(barValueChanged(int)));
+            connect(barSet, SIGNAL(valuesReplaced()), this, SLOT(barValuesReplaced()));
             connect(barSet, SIGNAL(labelChanged()), this, SLOT(barLabelChanged()));
             m_series->append(barSet);
             m_barSets.append(barSet);
@@ -74,6 +74,7 @@ public Q_SLOTS:
     void valuesRemoved(int index, int count);
     void barLabelChanged();
     void barValueChanged(int index);
+    void barValuesReplaced();
     void handleSeriesDestroyed();
 
     void initializeBarFromModel();
@@ -93,6 +94,7 @@ private:
     int m_first;
     int m_count;
     Qt::Orientation m_orientation;
+    int m_role;
     int m_firstBarSetSection;
     int m_lastBarSetSection;
     bool m_seriesSignalsBlock;
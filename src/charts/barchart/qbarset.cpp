@@ -31,6 +31,7 @@
 #include <private/qbarset_p.h>
 #include <private/charthelpers_p.h>
 #include <private/qchart_p.h>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -299,6 +300,18 @@ QT_CHARTS_BEGIN_NAMESPACE
     The corresponding signal handler is \c onValueChanged.
 */
 
+/*!
+    \fn void QBarSet::valuesReplaced()
+    This signal is emitted when all values of the bar set are replaced with other values.
+    \sa replace()
+*/
+/*!
+    \qmlsignal BarSet::valuesReplaced()
+    This signal is emitted when all values of the bar set are replaced with other values.
+
+    The corresponding signal handler is \c onValuesReplaced.
+*/
+
 /*!
     \qmlproperty int BarSet::count
     The number of values in the bar set.
@@ -368,9 +381,8 @@ QString QBarSet::label() const
 */
 void QBarSet::append(const qreal value)
 {
-    // Convert to QPointF
     int index = d_ptr->m_values.count();
-    d_ptr->append(QPointF(d_ptr->m_values.count(), value));
+    d_ptr->append(value);
     emit valuesAdded(index, 1);
 }
 
@@ -448,6 +460,29 @@ void QBarSet::replace(const int index, const qreal value)
     }
 }
 
+/*!
+    Replaces the current values with the values specified by \a values.
+    \note This is much faster than replacing values one by one, or first removing all values
+    and then appending the new ones, as the chart is updated only once. Emits
+    QBarSet::valuesReplaced() when the values have been replaced.
+    \sa valuesReplaced()
+*/
+void QBarSet::replace(const QVector<qreal> &values)
+{
+    replace(QVector<qreal>(values));
+}
+
+/*!
+    \overload
+    Replaces the current values with the values specified by \a values, moving the values
+    into the bar set without copying them.
+*/
+void QBarSet::replace(QVector<qreal> &&values)
+{
+    d_ptr->replace(std::move(values));
+    emit valuesReplaced();
+}
+
 /*!
     \qmlmethod BarSet::at(int index)
     Returns the value specified by \a index from the bar set.
@@ -462,7 +497,7 @@ qreal QBarSet::at(const int index) const
 {
     if (index < 0 || index >= d_ptr->m_values.count())
         return 0;
-    return d_ptr->m_values.at(index).y();
+    return d_ptr->m_values.at(index);
 }
 
 /*!
@@ -489,7 +524,7 @@ qreal QBarSet::sum() const
 {
     qreal total(0);
     for (int i = 0; i < d_ptr->m_values.count(); i++)
-        total += d_ptr->m_values.at(i).y();
+        total += d_ptr->m_values.at(i);
     return total;
 }
 
@@ -675,7 +710,7 @@ QBarSetPrivate::~QBarSetPrivate()
 {
 }
 
-void QBarSetPrivate::append(QPointF value)
+void QBarSetPrivate::append(const qreal value)
 {
     if (isValidValue(value)) {
         m_values.append(value);
@@ -683,9 +718,10 @@ void QBarSetPrivate::append(QPointF value)
     }
 }
 
-void QBarSetPrivate::append(QList<QPointF> values)
+void QBarSetPrivate::append(const QList<qreal> &values)
 {
     int originalIndex = m_values.count();
+    m_values.reserve(originalIndex + values.count());
     for (int i = 0; i < values.count(); i++) {
         if (isValidValue(values.at(i)))
             m_values.append(values.at(i));
@@ -693,26 +729,7 @@ void QBarSetPrivate::append(QList<QPointF> values)
     emit valueAdded(originalIndex, values.size());
 }
 
-void QBarSetPrivate::append(QList<qreal> values)
-{
-    int originalIndex = m_values.count();
-    int index = originalIndex;
-    for (int i = 0; i < values.count(); i++) {
-        if (isValidValue(values.at(i))) {
-            m_values.append(QPointF(index, values.at(i)));
-            index++;
-        }
-    }
-    emit valueAdded(originalIndex, values.size());
-}
-
 void QBarSetPrivate::insert(const int index, const qreal value)
-{
-    m_values.insert(index, QPointF(index, value));
-    emit valueAdded(index, 1);
-}
-
-void QBarSetPrivate::insert(const int index, const QPointF value)
 {
     m_values.insert(index, value);
     emit valueAdded(index, 1);
@@ -727,33 +744,31 @@ int QBarSetPrivate::remove(const int index, const int count)
     else if ((index + count) > m_values.count())
         removeCount = m_values.count() - index; // Trying to remove more items than list has. Limit amount to be removed.
 
-    int c = 0;
-    while (c < removeCount) {
-        m_values.removeAt(index);
-        c++;
-    }
+    m_values.remove(index, removeCount);
     emit valueRemoved(index, removeCount);
     return removeCount;
 }
 
 void QBarSetPrivate::replace(const int index, const qreal value)
 {
-    m_values.replace(index, QPointF(index, value));
+    m_values.replace(index, value);
     emit valueChanged(index);
 }
 
-qreal QBarSetPrivate::pos(const int index)
+void QBarSetPrivate::replace(QVector<qreal> &&values)
 {
-    if (index < 0 || index >= m_values.count())
-        return 0;
-    return m_values.at(index).x();
+    values.erase(std::remove_if(values.begin(), values.end(),
+                                [](qreal value) { return !isValidValue(value); }),
+                 values.end());
+    m_values = std::move(values);
+    emit valuesReplaced();
 }
 
 qreal QBarSetPrivate::value(const int index)
 {
     if (index < 0 || index >= m_values.count())
         return 0;
-    return m_values.at(index).y();
+    return m_values.at(index);
 }
 
 #include "moc_qbarset.cpp"
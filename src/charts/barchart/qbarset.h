@@ -65,6 +65,8 @@ public:
     void insert(const int index, const qreal value);
     void remove(const int index, const int count = 1);
     void replace(const int index, const qreal value);
+    void replace(const QVector<qreal> &values);
+    void replace(QVector<qreal> &&values);
     qreal at(const int index) const;
     qreal operator [](const int index) const;
     int count() const;
@@ -109,6 +111,7 @@ Q_SIGNALS:
     void valuesAdded(int index, int count);
     void valuesRemoved(int index, int count);
     void valueChanged(int index);
+    void valuesReplaced();
 
 private:
     QScopedPointer<QBarSetPrivate> d_ptr;
@@ -42,6 +42,7 @@
 #include <QtCharts/QBarSet>
 #include <QtCharts/private/qchartglobal_p.h>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
 #include <QtGui/QFont>
@@ -56,17 +57,15 @@ public:
     QBarSetPrivate(const QString label, QBarSet *parent);
     ~QBarSetPrivate();
 
-    void append(QPointF value);
-    void append(QList<QPointF> values);
-    void append(QList<qreal> values);
+    void append(const qreal value);
+    void append(const QList<qreal> &values);
 
     void insert(const int index, const qreal value);
-    void insert(const int index, const QPointF value);
     int remove(const int index, const int count);
 
     void replace(const int index, const qreal value);
+    void replace(QVector<qreal> &&values);
 
-    qreal pos(const int index);
     qreal value(const int index);
 
     void setVisualsDirty(bool dirty) { m_visualsDirty = dirty; }
@@ -79,11 +78,12 @@ Q_SIGNALS:
     void valueChanged(int index);
     void valueAdded(int index, int count);
     void valueRemoved(int index, int count);
+    void valuesReplaced();
 
 public:
     QBarSet * const q_ptr;
     QString m_label;
-    QList<QPointF> m_values;
+    QVector<qreal> m_values; // The category of a value is its index
     QPen m_pen;
     QBrush m_brush;
     QBrush m_labelBrush;
@@ -161,6 +161,18 @@ QT_CHARTS_BEGIN_NAMESPACE
     value is -1 (number limited to the number of columns in the model).
 */
 
+/*!
+    \property QHBarModelMapper::dataRole
+    \brief The item data role that is used to read and write the bar set values.
+
+    The default value is Qt::DisplayRole.
+*/
+/*!
+    \qmlproperty int HBarModelMapper::dataRole
+    The item data role that is used to read and write the bar set values.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \fn void QHBarModelMapper::seriesReplaced()
 
@@ -195,6 +207,11 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the number of columns changes.
 */
 
+/*!
+    \fn void QHBarModelMapper::dataRoleChanged()
+    This signal is emitted when the data role changes.
+*/
+
 /*!
     Constructs a mapper object that is a child of \a parent.
 */
@@ -282,6 +299,19 @@ void QHBarModelMapper::setColumnCount(int columnCount)
     }
 }
 
+int QHBarModelMapper::dataRole() const
+{
+    return QBarModelMapper::dataRole();
+}
+
+void QHBarModelMapper::setDataRole(int role)
+{
+    if (role != QBarModelMapper::dataRole()) {
+        QBarModelMapper::setDataRole(role);
+        emit dataRoleChanged();
+    }
+}
+
 #include "moc_qhbarmodelmapper.cpp"
 
 QT_CHARTS_END_NAMESPACE
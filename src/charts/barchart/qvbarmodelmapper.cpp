@@ -165,6 +165,18 @@ QT_CHARTS_BEGIN_NAMESPACE
     value is -1 (number limited to the number of rows in the model).
 */
 
+/*!
+    \property QVBarModelMapper::dataRole
+    \brief The item data role that is used to read and write the bar set values.
+
+    The default value is Qt::DisplayRole.
+*/
+/*!
+    \qmlproperty int VBarModelMapper::dataRole
+    The item data role that is used to read and write the bar set values.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \fn void QVBarModelMapper::seriesReplaced()
 
@@ -197,6 +209,11 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the number of rows changes.
 */
 
+/*!
+    \fn void QVBarModelMapper::dataRoleChanged()
+    This signal is emitted when the data role changes.
+*/
+
 /*!
     Constructs a mapper object that is a child of \a parent.
 */
@@ -284,6 +301,19 @@ void QVBarModelMapper::setRowCount(int rowCount)
     }
 }
 
+int QVBarModelMapper::dataRole() const
+{
+    return QBarModelMapper::dataRole();
+}
+
+void QVBarModelMapper::setDataRole(int role)
+{
+    if (role != QBarModelMapper::dataRole()) {
+        QBarModelMapper::setDataRole(role);
+        emit dataRoleChanged();
+    }
+}
+
 #include "moc_qvbarmodelmapper.cpp"
 
 QT_CHARTS_END_NAMESPACE
@@ -43,6 +43,7 @@ class QT_CHARTS_EXPORT QVBarModelMapper : public QBarModelMapper
     Q_PROPERTY(int lastBarSetColumn READ lastBarSetColumn WRITE setLastBarSetColumn NOTIFY lastBarSetColumnChanged)
     Q_PROPERTY(int firstRow READ firstRow WRITE setFirstRow NOTIFY firstRowChanged)
     Q_PROPERTY(int rowCount READ rowCount WRITE setRowCount NOTIFY rowCountChanged)
+    Q_PROPERTY(int dataRole READ dataRole WRITE setDataRole NOTIFY dataRoleChanged)
 
 public:
     explicit QVBarModelMapper(QObject *parent = nullptr);
@@ -65,6 +66,9 @@ public:
     int rowCount() const;
     void setRowCount(int rowCount);
 
+    int dataRole() const;
+    void setDataRole(int role);
+
 Q_SIGNALS:
     void seriesReplaced();
     void modelReplaced();
@@ -72,6 +76,7 @@ Q_SIGNALS:
     void lastBarSetColumnChanged();
     void firstRowChanged();
     void rowCountChanged();
+    void dataRoleChanged();
 };
 
 QT_CHARTS_END_NAMESPACE
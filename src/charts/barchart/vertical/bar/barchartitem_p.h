@@ -60,7 +60,7 @@ private Q_SLOTS:
 private:
     virtual QVector<QRectF> calculateLayout();
     void initializeLayout(int set, int category,
-                          int layoutIndex, bool resetAnimation);
+                          int index, bool resetAnimation);
     QPointF topLeftPoint(int set, int setCount, int category, qreal barWidth, qreal value);
     QPointF bottomRightPoint(int set, int setCount, int category, qreal barWidth, qreal value);
 };
@@ -79,6 +79,15 @@ QBarSeries::QBarSeries(QObject *parent)
 
 }
 
+/*!
+    \internal
+*/
+QBarSeries::QBarSeries(QBarSeriesPrivate &d, QObject *parent)
+    : QAbstractBarSeries(d, parent)
+{
+
+}
+
 /*!
     Returns the bar series.
 */
@@ -44,6 +44,9 @@ public:
     ~QBarSeries();
     QAbstractSeries::SeriesType type() const;
 
+protected:
+    explicit QBarSeries(QBarSeriesPrivate &d, QObject *parent = nullptr);
+
 private:
     Q_DECLARE_PRIVATE(QBarSeries)
     Q_DISABLE_COPY(QBarSeries)
@@ -0,0 +1,575 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QHistogramSeries>
+#include <QtCharts/QBarSet>
+#include <private/qhistogramseries_p.h>
+#include <QtCore/QtMath>
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+#include <algorithm>
+#include <cmath>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QHistogramSeries
+    \inmodule QtCharts
+    \brief The QHistogramSeries class presents the distribution of raw samples as vertical bars.
+
+    Samples are appended to the series one at a time or in batches, and the series keeps the
+    count of samples in each bin up to date. The counts are presented as the values of a single
+    bar set, so the bins are laid out and painted like any other QBarSeries, one category per bin.
+
+    In the fixed binning mode, the bins are \l binWidth wide and aligned to \l binOrigin.
+    Bins are added at either end as samples fall outside the current bins, without recounting
+    the existing samples. In the adaptive binning mode, \l adaptiveBinCount bins evenly span the
+    range of the samples, and the samples are recounted whenever the range grows. Appending
+    samples in batches keeps the number of recounts low. Appending samples one at a time to a
+    steadily growing range recounts all samples on every append, so the total cost grows with
+    the square of the sample count; such streams should use the fixed binning mode.
+
+    At most 100000 fixed bins are created. When the samples span more bins, the bins cover the
+    bulk of the samples, and samples below the first or beyond the last bin, such as far
+    outliers, are counted in the first or the last bin.
+
+    Changing the binning recounts all samples, split across the threads of the global
+    thread pool for large sample counts.
+
+    The bar set holding the counts is owned by the series and can be accessed with binSet()
+    to change its visual appearance. It should not be removed from the series.
+
+    \sa QBarSeries, QBarSet
+*/
+
+/*!
+    \enum QHistogramSeries::BinningMode
+
+    This enum describes how the bin edges are chosen.
+
+    \value BinsFixed
+           The bins have a fixed width and are aligned to a fixed origin.
+    \value BinsAdaptive
+           A fixed number of bins evenly spans the range of the samples.
+*/
+
+/*!
+    \property QHistogramSeries::binningMode
+    \brief How the bin edges are chosen.
+
+    By default, the bins are adaptive.
+*/
+
+/*!
+    \property QHistogramSeries::binWidth
+    \brief The width of the bins in the fixed binning mode.
+
+    The default value is \c 1.0.
+*/
+
+/*!
+    \property QHistogramSeries::binOrigin
+    \brief The value the bins are aligned to in the fixed binning mode.
+
+    The default value is \c 0.0.
+*/
+
+/*!
+    \property QHistogramSeries::adaptiveBinCount
+    \brief The number of bins in the adaptive binning mode.
+
+    The default value is \c 10.
+*/
+
+/*!
+    \property QHistogramSeries::binCount
+    \brief The current number of bins.
+*/
+
+/*!
+    \property QHistogramSeries::sampleCount
+    \brief The number of samples in the series.
+*/
+
+/*!
+    \fn void QHistogramSeries::binningModeChanged(QHistogramSeries::BinningMode mode)
+    This signal is emitted when the binning mode changes to \a mode.
+*/
+
+/*!
+    \fn void QHistogramSeries::binWidthChanged(qreal width)
+    This signal is emitted when the bin width changes to \a width.
+*/
+
+/*!
+    \fn void QHistogramSeries::binOriginChanged(qreal origin)
+    This signal is emitted when the bin origin changes to \a origin.
+*/
+
+/*!
+    \fn void QHistogramSeries::adaptiveBinCountChanged(int count)
+    This signal is emitted when the number of adaptive bins changes to \a count.
+*/
+
+/*!
+    \fn void QHistogramSeries::binsChanged()
+    This signal is emitted when the bin edges or the number of bins change.
+*/
+
+/*!
+    \fn void QHistogramSeries::sampleCountChanged()
+    This signal is emitted when samples are appended to or cleared from the series.
+*/
+
+/*!
+    Constructs an empty histogram series that is a QObject and a child of \a parent.
+*/
+QHistogramSeries::QHistogramSeries(QObject *parent)
+    : QBarSeries(*new QHistogramSeriesPrivate(this), parent)
+{
+    Q_D(QHistogramSeries);
+    d->m_binSet = new QBarSet(QString(), this);
+    QAbstractBarSeries::append(d->m_binSet);
+}
+
+/*!
+    Removes the histogram series from the chart.
+*/
+QHistogramSeries::~QHistogramSeries()
+{
+}
+
+/*!
+    Appends \a sample to the series. Samples that are not finite are ignored.
+*/
+void QHistogramSeries::append(qreal sample)
+{
+    Q_D(QHistogramSeries);
+    d->appendSamples(&sample, 1);
+}
+
+/*!
+    Appends the list of samples specified by \a samples to the series. Samples that are not
+    finite are ignored.
+*/
+void QHistogramSeries::append(const QVector<qreal> &samples)
+{
+    Q_D(QHistogramSeries);
+    d->appendSamples(samples.constData(), samples.size());
+}
+
+/*!
+    A convenience operator for appending the sample specified by \a sample to the series.
+*/
+QHistogramSeries &QHistogramSeries::operator << (qreal sample)
+{
+    append(sample);
+    return *this;
+}
+
+/*!
+    Removes all samples from the series.
+*/
+void QHistogramSeries::clear()
+{
+    Q_D(QHistogramSeries);
+    if (d->m_samples.isEmpty())
+        return;
+    d->m_samples.clear();
+    d->m_minSample = qInf();
+    d->m_maxSample = -qInf();
+    d->rebin();
+    emit sampleCountChanged();
+}
+
+int QHistogramSeries::sampleCount() const
+{
+    Q_D(const QHistogramSeries);
+    return d->m_samples.size();
+}
+
+/*!
+    Returns the bar set holding the sample count of each bin.
+*/
+QBarSet *QHistogramSeries::binSet() const
+{
+    Q_D(const QHistogramSeries);
+    return d->m_binSet;
+}
+
+void QHistogramSeries::setBinningMode(BinningMode mode)
+{
+    Q_D(QHistogramSeries);
+    if (d->m_binningMode != mode) {
+        d->m_binningMode = mode;
+        d->rebin();
+        emit binningModeChanged(mode);
+    }
+}
+
+QHistogramSeries::BinningMode QHistogramSeries::binningMode() const
+{
+    Q_D(const QHistogramSeries);
+    return d->m_binningMode;
+}
+
+void QHistogramSeries::setBinWidth(qreal width)
+{
+    Q_D(QHistogramSeries);
+    if (width > 0.0 && !qFuzzyCompare(d->m_binWidth, width)) {
+        d->m_binWidth = width;
+        if (d->m_binningMode == BinsFixed)
+            d->rebin();
+        emit binWidthChanged(width);
+    }
+}
+
+qreal QHistogramSeries::binWidth() const
+{
+    Q_D(const QHistogramSeries);
+    return d->m_binWidth;
+}
+
+void QHistogramSeries::setBinOrigin(qreal origin)
+{
+    Q_D(QHistogramSeries);
+    if (d->m_binOrigin != origin) {
+        d->m_binOrigin = origin;
+        if (d->m_binningMode == BinsFixed)
+            d->rebin();
+        emit binOriginChanged(origin);
+    }
+}
+
+qreal QHistogramSeries::binOrigin() const
+{
+    Q_D(const QHistogramSeries);
+    return d->m_binOrigin;
+}
+
+void QHistogramSeries::setAdaptiveBinCount(int count)
+{
+    Q_D(QHistogramSeries);
+    if (count > 0 && d->m_adaptiveBinCount != count) {
+        d->m_adaptiveBinCount = count;
+        if (d->m_binningMode == BinsAdaptive)
+            d->rebin();
+        emit adaptiveBinCountChanged(count);
+    }
+}
+
+int QHistogramSeries::adaptiveBinCount() const
+{
+    Q_D(const QHistogramSeries);
+    return d->m_adaptiveBinCount;
+}
+
+int QHistogramSeries::binCount() const
+{
+    Q_D(const QHistogramSeries);
+    return d->m_binSet ? d->m_binSet->count() : 0;
+}
+
+/*!
+    Returns the lower edge of the bin specified by \a bin.
+*/
+qreal QHistogramSeries::lowerBinEdge(int bin) const
+{
+    Q_D(const QHistogramSeries);
+    return d->m_currentOrigin + (d->m_firstBin + bin) * d->m_currentWidth;
+}
+
+/*!
+    Returns the upper edge of the bin specified by \a bin.
+*/
+qreal QHistogramSeries::upperBinEdge(int bin) const
+{
+    return lowerBinEdge(bin + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Below this many samples counting is not worth handing to other threads
+static const int parallelBinningThreshold = 100000;
+// Keeps far outliers from allocating bins without bound in the fixed binning mode
+static const int maxFixedBinCount = 100000;
+// Bin indices are clamped to this so that differences between them cannot overflow
+static const qreal maxBinIndex = 1 << 29;
+
+static void countSamples(const qreal *samples, int count, qreal origin, qreal width,
+                         int firstBin, QVector<qreal> &bins)
+{
+    // Samples on the outer edges may round outside the bins, they belong to the outermost bins,
+    // and far outliers are clamped into them before the index is converted to int
+    const qreal first = firstBin;
+    const qreal lastBin = bins.size() - 1;
+    qreal *data = bins.data();
+    for (int i = 0; i < count; i++) {
+        const qreal bin = std::floor((samples[i] - origin) / width) - first;
+        data[int(qBound(qreal(0.0), bin, lastBin))] += 1.0;
+    }
+}
+
+class HistogramBinCounter : public QRunnable
+{
+public:
+    HistogramBinCounter(const qreal *samples, int count, qreal origin, qreal width,
+                        int firstBin, int binCount, QSemaphore *done)
+        : m_bins(binCount),
+          m_samples(samples),
+          m_count(count),
+          m_origin(origin),
+          m_width(width),
+          m_firstBin(firstBin),
+          m_done(done)
+    {
+        setAutoDelete(false);
+    }
+
+    void run()
+    {
+        countSamples(m_samples, m_count, m_origin, m_width, m_firstBin, m_bins);
+        m_done->release();
+    }
+
+    QVector<qreal> m_bins;
+
+private:
+    const qreal *m_samples;
+    int m_count;
+    qreal m_origin;
+    qreal m_width;
+    int m_firstBin;
+    QSemaphore *m_done;
+};
+
+QHistogramSeriesPrivate::QHistogramSeriesPrivate(QHistogramSeries *q)
+    : QBarSeriesPrivate(q),
+      m_binningMode(QHistogramSeries::BinsAdaptive),
+      m_binWidth(1.0),
+      m_binOrigin(0.0),
+      m_adaptiveBinCount(10),
+      m_currentOrigin(0.0),
+      m_currentWidth(1.0),
+      m_firstBin(0),
+      m_minSample(qInf()),
+      m_maxSample(-qInf())
+{
+}
+
+void QHistogramSeriesPrivate::appendSamples(const qreal *samples, int count)
+{
+    Q_Q(QHistogramSeries);
+
+    const int oldCount = m_samples.size();
+    qreal minSample = m_minSample;
+    qreal maxSample = m_maxSample;
+    // Streamed samples rely on the normal growth of the vector
+    if (count > 1)
+        m_samples.reserve(oldCount + count);
+    for (int i = 0; i < count; i++) {
+        const qreal sample = samples[i];
+        if (!qIsFinite(sample))
+            continue;
+        m_samples.append(sample);
+        minSample = qMin(minSample, sample);
+        maxSample = qMax(maxSample, sample);
+    }
+    if (m_samples.size() == oldCount)
+        return;
+
+    const bool rangeGrew = oldCount == 0 || minSample < m_minSample || maxSample > m_maxSample;
+    m_minSample = minSample;
+    m_maxSample = maxSample;
+    emit q->sampleCountChanged();
+
+    if (!m_binSet)
+        return;
+
+    // Adaptive bins span the sample range exactly, so a wider range means recounting
+    if (m_binningMode == QHistogramSeries::BinsAdaptive && rangeGrew) {
+        rebin();
+        return;
+    }
+
+    // Fixed bins only grow to cover the new samples, the existing counts stay valid
+    const int oldBinCount = m_binSet->count();
+    int firstBin = m_firstBin;
+    int binCount = oldBinCount;
+    if (m_binningMode == QHistogramSeries::BinsFixed && rangeGrew) {
+        if (oldBinCount == 0) {
+            rebin();
+            return;
+        }
+        // The existing bins stay, bins are added towards the new samples as long as the limit
+        // allows, split evenly between the two ends when both need more than that
+        const int oldEnd = m_firstBin + oldBinCount;
+        int lowBins = m_firstBin - qMin(m_firstBin, binOf(minSample));
+        int highBins = qMax(oldEnd, binOf(maxSample) + 1) - oldEnd;
+        const int spare = maxFixedBinCount - oldBinCount;
+        if (lowBins + highBins > spare) {
+            if (lowBins < spare / 2) {
+                highBins = spare - lowBins;
+            } else if (highBins < spare / 2) {
+                lowBins = spare - highBins;
+            } else {
+                lowBins = spare / 2;
+                highBins = spare - lowBins;
+            }
+        }
+        firstBin = m_firstBin - lowBins;
+        binCount = oldBinCount + lowBins + highBins;
+    }
+
+    QVector<qreal> bins = countBins(oldCount, m_samples.size(), firstBin, binCount);
+    if (firstBin == m_firstBin && binCount == oldBinCount) {
+        // A single new sample only updates the bar of its bin, a batch replaces all counts at
+        // once rather than updating the bars one by one
+        int changedBin = -1;
+        for (int i = 0; i < binCount; i++) {
+            if (bins.at(i) != 0.0) {
+                if (changedBin >= 0) {
+                    changedBin = -1;
+                    break;
+                }
+                changedBin = i;
+            }
+        }
+        if (changedBin >= 0) {
+            m_binSet->replace(changedBin, m_binSet->at(changedBin) + bins.at(changedBin));
+        } else {
+            for (int i = 0; i < binCount; i++)
+                bins[i] += m_binSet->at(i);
+            m_binSet->replace(std::move(bins));
+        }
+        return;
+    }
+
+    const int shift = m_firstBin - firstBin;
+    for (int i = 0; i < oldBinCount; i++)
+        bins[shift + i] += m_binSet->at(i);
+    m_firstBin = firstBin;
+    m_binSet->replace(std::move(bins));
+    emit q->binsChanged();
+}
+
+void QHistogramSeriesPrivate::rebin()
+{
+    Q_Q(QHistogramSeries);
+
+    int binCount = 0;
+    if (m_binningMode == QHistogramSeries::BinsAdaptive) {
+        m_currentOrigin = m_samples.isEmpty() ? 0.0 : m_minSample;
+        m_currentWidth = (m_maxSample - m_minSample) / m_adaptiveBinCount;
+        // The range of the samples may not be representable while the width is
+        if (qIsInf(m_currentWidth))
+            m_currentWidth = m_maxSample / m_adaptiveBinCount - m_minSample / m_adaptiveBinCount;
+        // All samples are equal or there are none, any width puts them into the first bin
+        if (!(m_currentWidth > 0.0))
+            m_currentWidth = 1.0;
+        m_firstBin = 0;
+        if (!m_samples.isEmpty())
+            binCount = m_adaptiveBinCount;
+    } else {
+        m_currentOrigin = m_binOrigin;
+        m_currentWidth = m_binWidth;
+        m_firstBin = m_samples.isEmpty() ? 0 : fixedBinWindow(binCount);
+    }
+
+    if (m_binSet)
+        m_binSet->replace(countBins(0, m_samples.size(), m_firstBin, binCount));
+    emit q->binsChanged();
+}
+
+int QHistogramSeriesPrivate::binOf(qreal sample) const
+{
+    const qreal bin = std::floor((sample - m_currentOrigin) / m_currentWidth);
+    return int(qBound(-maxBinIndex, bin, maxBinIndex));
+}
+
+// Returns the first fixed bin covering the samples and their count in binCount. If more than
+// maxFixedBinCount bins would be needed, the bins are centered on the median sample, so that
+// far outliers at either end do not push the bulk of the samples out of the bins.
+int QHistogramSeriesPrivate::fixedBinWindow(int &binCount) const
+{
+    const int firstBin = binOf(m_minSample);
+    const int lastBin = binOf(m_maxSample);
+    if (lastBin - firstBin < maxFixedBinCount) {
+        binCount = lastBin - firstBin + 1;
+        return firstBin;
+    }
+
+    QVector<qreal> samples = m_samples;
+    const auto median = samples.begin() + samples.size() / 2;
+    std::nth_element(samples.begin(), median, samples.end());
+    binCount = maxFixedBinCount;
+    return qBound(firstBin, binOf(*median) - maxFixedBinCount / 2,
+                  lastBin - maxFixedBinCount + 1);
+}
+
+// Counts the samples in [first, last) into binCount bins starting at firstBin
+QVector<qreal> QHistogramSeriesPrivate::countBins(int first, int last, int firstBin,
+                                                  int binCount) const
+{
+    QVector<qreal> bins(binCount);
+    const int sampleCount = last - first;
+    const int chunkCount = sampleCount < parallelBinningThreshold
+            ? 1 : qMax(1, QThread::idealThreadCount());
+    const int chunkSize = (sampleCount + chunkCount - 1) / chunkCount;
+    const qreal *samples = m_samples.constData();
+
+    // The first chunk is counted on this thread while the pool counts the rest
+    QSemaphore done;
+    QList<HistogramBinCounter *> counters;
+    for (int begin = first + chunkSize; begin < last; begin += chunkSize) {
+        HistogramBinCounter *counter =
+                new HistogramBinCounter(samples + begin, qMin(chunkSize, last - begin),
+                                        m_currentOrigin, m_currentWidth, firstBin, binCount,
+                                        &done);
+        counters.append(counter);
+        if (!QThreadPool::globalInstance()->tryStart(counter))
+            counter->run();
+    }
+    countSamples(samples + first, qMin(chunkSize, sampleCount), m_currentOrigin, m_currentWidth,
+                 firstBin, bins);
+    done.acquire(counters.size());
+
+    for (const HistogramBinCounter *counter : qAsConst(counters)) {
+        for (int i = 0; i < binCount; i++)
+            bins[i] += counter->m_bins.at(i);
+    }
+    qDeleteAll(counters);
+    return bins;
+}
+
+#include "moc_qhistogramseries.cpp"
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,96 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QHISTOGRAMSERIES_H
+#define QHISTOGRAMSERIES_H
+
+#include <QtCharts/QBarSeries>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QHistogramSeriesPrivate;
+
+class QT_CHARTS_EXPORT QHistogramSeries : public QBarSeries
+{
+    Q_OBJECT
+    Q_PROPERTY(BinningMode binningMode READ binningMode WRITE setBinningMode NOTIFY binningModeChanged)
+    Q_PROPERTY(qreal binWidth READ binWidth WRITE setBinWidth NOTIFY binWidthChanged)
+    Q_PROPERTY(qreal binOrigin READ binOrigin WRITE setBinOrigin NOTIFY binOriginChanged)
+    Q_PROPERTY(int adaptiveBinCount READ adaptiveBinCount WRITE setAdaptiveBinCount NOTIFY adaptiveBinCountChanged)
+    Q_PROPERTY(int binCount READ binCount NOTIFY binsChanged)
+    Q_PROPERTY(int sampleCount READ sampleCount NOTIFY sampleCountChanged)
+    Q_ENUMS(BinningMode)
+
+public:
+    enum BinningMode {
+        BinsFixed = 0,
+        BinsAdaptive
+    };
+
+public:
+    explicit QHistogramSeries(QObject *parent = nullptr);
+    ~QHistogramSeries();
+
+    void append(qreal sample);
+    void append(const QVector<qreal> &samples);
+    QHistogramSeries &operator << (qreal sample);
+    void clear();
+
+    int sampleCount() const;
+    QBarSet *binSet() const;
+
+    void setBinningMode(BinningMode mode);
+    BinningMode binningMode() const;
+    void setBinWidth(qreal width);
+    qreal binWidth() const;
+    void setBinOrigin(qreal origin);
+    qreal binOrigin() const;
+    void setAdaptiveBinCount(int count);
+    int adaptiveBinCount() const;
+
+    int binCount() const;
+    qreal lowerBinEdge(int bin) const;
+    qreal upperBinEdge(int bin) const;
+
+Q_SIGNALS:
+    void binningModeChanged(QHistogramSeries::BinningMode mode);
+    void binWidthChanged(qreal width);
+    void binOriginChanged(qreal origin);
+    void adaptiveBinCountChanged(int count);
+    void binsChanged();
+    void sampleCountChanged();
+
+private:
+    Q_DECLARE_PRIVATE(QHistogramSeries)
+    Q_DISABLE_COPY(QHistogramSeries)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QHISTOGRAMSERIES_H
@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef QHISTOGRAMSERIES_P_H
+#define QHISTOGRAMSERIES_P_H
+
+#include <private/qbarseries_p.h>
+#include <QtCharts/QHistogramSeries>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QPointer>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QT_CHARTS_PRIVATE_EXPORT QHistogramSeriesPrivate: public QBarSeriesPrivate
+{
+public:
+    QHistogramSeriesPrivate(QHistogramSeries *q);
+
+    void appendSamples(const qreal *samples, int count);
+    void rebin();
+    int binOf(qreal sample) const;
+    int fixedBinWindow(int &binCount) const;
+    QVector<qreal> countBins(int first, int last, int firstBin, int binCount) const;
+
+protected:
+    QVector<qreal> m_samples;
+    QPointer<QBarSet> m_binSet; // Removing it through the bar series API stops binning
+    QHistogramSeries::BinningMode m_binningMode;
+    qreal m_binWidth;
+    qreal m_binOrigin;
+    int m_adaptiveBinCount;
+    // Bin i currently spans [m_currentOrigin + (m_firstBin + i) * m_currentWidth, ...)
+    qreal m_currentOrigin;
+    qreal m_currentWidth;
+    int m_firstBin;
+    qreal m_minSample;
+    qreal m_maxSample;
+
+private:
+    Q_DECLARE_PUBLIC(QHistogramSeries)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QHISTOGRAMSERIES_P_H
@@ -28,7 +28,6 @@
 ****************************************************************************/
 
 #include <private/percentbarchartitem_p.h>
-#include <private/bar_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBarSet>
 #include <private/qbarset_p.h>
@@ -64,7 +63,7 @@ QString PercentBarChartItem::generateLabelText(int set, int category, qreal valu
 }
 
 void PercentBarChartItem::initializeLayout(int set, int category,
-                                           int layoutIndex, bool resetAnimation)
+                                           int index, bool resetAnimation)
 {
     Q_UNUSED(set)
     Q_UNUSED(resetAnimation)
@@ -72,9 +71,7 @@ void PercentBarChartItem::initializeLayout(int set, int category,
     QRectF rect;
 
     if (set > 0) {
-        QBarSet *barSet = m_series->barSets().at(set - 1);
-        Bar *bar = m_indexForBarMap.value(barSet).value(category);
-        rect = m_layout.at(bar->layoutIndex());
+        rect = m_layout.at(layoutIndex(set - 1, category));
         rect.setBottom(rect.top());
     } else {
         QPointF topLeft;
@@ -94,14 +91,14 @@ void PercentBarChartItem::initializeLayout(int set, int category,
         }
     }
 
-    m_layout[layoutIndex] = rect.normalized();
+    m_layout[index] = rect.normalized();
 }
 
 void PercentBarChartItem::markLabelsDirty(QBarSet *barset, int index, int count)
 {
     Q_UNUSED(barset)
     // Percent series need to dirty all labels of the stack
-    QList<QBarSet *> sets = m_barMap.keys();
+    QList<QBarSet *> sets = m_series->barSets();
     for (int set = 0; set < sets.size(); set++)
         AbstractBarChartItem::markLabelsDirty(sets.at(set), index, count);
 }
@@ -134,10 +131,8 @@ QVector<QRectF> PercentBarChartItem::calculateLayout()
 
     for (int set = 0; set < setCount; set++) {
         QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < m_categoryCount; i++) {
-            Bar *bar = bars.at(i);
-            const int category = bar->index();
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int index = layoutIndex(set, category);
             qreal &sum = tempSums[category - m_firstCategory];
             const qreal &categorySum = categorySums.at(category - m_firstCategory);
             qreal value = barSet->at(category);
@@ -163,7 +158,7 @@ QVector<QRectF> PercentBarChartItem::calculateLayout()
 
             rect.setTopLeft(topLeft);
             rect.setBottomRight(bottomRight);
-            layout[bar->layoutIndex()] = rect.normalized();
+            layout[index] = rect.normalized();
             sum = newSum;
         }
     }
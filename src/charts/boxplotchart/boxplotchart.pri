@@ -5,6 +5,7 @@ SOURCES += \
     $$PWD/qboxplotseries.cpp \
     $$PWD/boxwhiskers.cpp \
     $$PWD/qboxset.cpp \
+    $$PWD/quantileestimator.cpp \
     $$PWD/qboxplotmodelmapper.cpp \
     $$PWD/qhboxplotmodelmapper.cpp \
     $$PWD/qvboxplotmodelmapper.cpp
@@ -15,6 +16,7 @@ PRIVATE_HEADERS += \
     $$PWD/boxwhiskers_p.h \
     $$PWD/boxwhiskersdata_p.h \
     $$PWD/qboxset_p.h \
+    $$PWD/quantileestimator_p.h \
     $$PWD/qboxplotmodelmapper_p.h
 
 PUBLIC_HEADERS += \
@@ -209,6 +209,25 @@ void QBoxPlotModelMapper::setLastBoxSetSection(int lastBoxSetSection)
     d->initializeBoxFromModel();
 }
 
+/*!
+    Returns the item data role that is used to read and write the box set values of the model.
+*/
+int QBoxPlotModelMapper::dataRole() const
+{
+    Q_D(const QBoxPlotModelMapper);
+    return d->m_role;
+}
+
+/*!
+    Sets the item data role that is used to read and write the box set values of the model to \a role.
+*/
+void QBoxPlotModelMapper::setDataRole(int role)
+{
+    Q_D(QBoxPlotModelMapper);
+    d->m_role = role;
+    d->initializeBoxFromModel();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QBoxPlotModelMapperPrivate::QBoxPlotModelMapperPrivate(QBoxPlotModelMapper *q) :
@@ -218,6 +237,7 @@ QBoxPlotModelMapperPrivate::QBoxPlotModelMapperPrivate(QBoxPlotModelMapper *q) :
     m_first(0),
     m_count(-1),
     m_orientation(Qt::Vertical),
+    m_role(Qt::DisplayRole),
     m_firstBoxSetSection(-1),
     m_lastBoxSetSection(-1),
     m_seriesSignalsBlock(false),
@@ -289,9 +309,9 @@ void QBoxPlotModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex b
             QBoxSet *box = boxSet(index);
             if (box) {
                 if (m_orientation == Qt::Vertical)
-                    box->setValue(row - m_first, m_model->data(index).toReal());
+                    box->setValue(row - m_first, m_model->data(index, m_role).toReal());
                 else
-                    box->setValue(column - m_first, m_model->data(index).toReal());
+                    box->setValue(column - m_first, m_model->data(index, m_role).toReal());
             }
         }
     }
@@ -426,7 +446,7 @@ void QBoxPlotModelMapperPrivate::boxSetsAdded(QList<QBoxSet *> sets)
 
     for (int i = firstIndex + m_firstBoxSetSection; i < firstIndex + m_firstBoxSetSection + sets.count(); i++) {
         for (int j = 0; j < sets.at(i - firstIndex - m_firstBoxSetSection)->count(); j++)
-            m_model->setData(boxModelIndex(i, j), sets.at(i - firstIndex - m_firstBoxSetSection)->at(j));
+            m_model->setData(boxModelIndex(i, j), sets.at(i - firstIndex - m_firstBoxSetSection)->at(j), m_role);
     }
     blockModelSignals(false);
     initializeBoxFromModel();
@@ -466,7 +486,7 @@ void QBoxPlotModelMapperPrivate::boxValueChanged(int index)
     int boxSetIndex = m_boxSets.indexOf(qobject_cast<QBoxSet *>(QObject::sender()));
 
     blockModelSignals();
-    m_model->setData(boxModelIndex(boxSetIndex + m_firstBoxSetSection, index), m_boxSets.at(boxSetIndex)->at(index));
+    m_model->setData(boxModelIndex(boxSetIndex + m_firstBoxSetSection, index), m_boxSets.at(boxSetIndex)->at(index), m_role);
     blockModelSignals(false);
     initializeBoxFromModel();
 }
@@ -489,7 +509,7 @@ void QBoxPlotModelMapperPrivate::initializeBoxFromModel()
         if (boxIndex.isValid()) {
             QBoxSet *boxSet = new QBoxSet();
             while (boxIndex.isValid()) {
-                boxSet->append(m_model->data(boxIndex, Qt::DisplayRole).toDouble());
+                boxSet->append(m_model->data(boxIndex, m_role).toDouble());
                 posInBar++;
                 boxIndex = boxModelIndex(i, posInBar);
             }
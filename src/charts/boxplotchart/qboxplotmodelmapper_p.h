@@ -90,6 +90,7 @@ private:
     int m_first;
     int m_count;
     Qt::Orientation m_orientation;
+    int m_role;
     int m_firstBoxSetSection;
     int m_lastBoxSetSection;
     bool m_seriesSignalsBlock;
@@ -47,6 +47,13 @@ QT_CHARTS_BEGIN_NAMESPACE
     The second way is to create an empty QBoxSet instance and specify the values using the
     setValue() method.
 
+    Alternatively, raw samples can be appended with appendSample() and appendSamples(). The
+    box-and-whiskers item then shows the smallest and largest sample and estimates of the
+    quartiles and the median. The estimates are updated as the samples stream in, using the
+    P-square algorithm, so the samples themselves are not stored. To avoid redrawing
+    the chart for every sample, the values are only updated when one of them has moved by more
+    than sampleTolerance().
+
     See the \l{Box and Whiskers Example}{box-and-whiskers chart example} to learn how to
     create a box-and-whiskers chart.
 
@@ -220,7 +227,57 @@ void QBoxSet::setValue(const int index, const qreal value)
 }
 
 /*!
-    Sets all the values of the box-and-whiskers item to 0.
+    Appends the raw sample specified by \a sample to the samples summarized by the
+    box-and-whiskers item.
+    \sa appendSamples()
+*/
+void QBoxSet::appendSample(const qreal sample)
+{
+    if (d_ptr->appendSamples(&sample, 1))
+        emit valuesChanged();
+}
+
+/*!
+    Appends the raw samples specified by \a samples to the samples summarized by the
+    box-and-whiskers item. The values of the item are checked once for all the samples.
+    \sa appendSample()
+*/
+void QBoxSet::appendSamples(const QVector<qreal> &samples)
+{
+    if (d_ptr->appendSamples(samples.constData(), samples.count()))
+        emit valuesChanged();
+}
+
+/*!
+    Returns the number of raw samples summarized by the box-and-whiskers item.
+*/
+int QBoxSet::sampleCount() const
+{
+    return d_ptr->m_median.count();
+}
+
+/*!
+    Sets the tolerance for updating the values of the box-and-whiskers item from raw samples
+    to \a tolerance. The values are only updated when at least one of them differs from the
+    current summary of the samples by more than the tolerance. The default value is 0.0,
+    which updates the values whenever the summary changes.
+*/
+void QBoxSet::setSampleTolerance(const qreal tolerance)
+{
+    d_ptr->m_sampleTolerance = qMax(tolerance, qreal(0.0));
+}
+
+/*!
+    Returns the tolerance for updating the values of the box-and-whiskers item from raw samples.
+*/
+qreal QBoxSet::sampleTolerance() const
+{
+    return d_ptr->m_sampleTolerance;
+}
+
+/*!
+    Sets all the values of the box-and-whiskers item to 0 and discards the summary of
+    the raw samples.
  */
 void QBoxSet::clear()
 {
@@ -307,7 +364,13 @@ QBoxSetPrivate::QBoxSetPrivate(const QString label, QBoxSet *parent) : QObject(p
     m_appendCount(0),
     m_pen(QPen(Qt::NoPen)),
     m_brush(QBrush(Qt::NoBrush)),
-    m_series(0)
+    m_series(0),
+    m_lowerQuartile(0.25),
+    m_median(0.5),
+    m_upperQuartile(0.75),
+    m_sampleMinimum(0.0),
+    m_sampleMaximum(0.0),
+    m_sampleTolerance(0.0)
 {
     m_values = new qreal[m_valuesCount];
 }
@@ -347,6 +410,7 @@ bool QBoxSetPrivate::append(QList<qreal> values)
 
 void QBoxSetPrivate::clear()
 {
+    resetSamples();
     m_appendCount = 0;
     for (int i = 0; i < m_valuesCount; i++)
          m_values[i] = 0.0;
@@ -368,6 +432,57 @@ qreal QBoxSetPrivate::value(const int index)
     return m_values[index];
 }
 
+bool QBoxSetPrivate::appendSamples(const qreal *samples, int count)
+{
+    bool added = false;
+    for (int i = 0; i < count; i++) {
+        const qreal sample = samples[i];
+        if (!isValidValue(sample))
+            continue;
+        if (m_median.count() == 0) {
+            m_sampleMinimum = sample;
+            m_sampleMaximum = sample;
+        } else {
+            m_sampleMinimum = qMin(m_sampleMinimum, sample);
+            m_sampleMaximum = qMax(m_sampleMaximum, sample);
+        }
+        m_lowerQuartile.add(sample);
+        m_median.add(sample);
+        m_upperQuartile.add(sample);
+        added = true;
+    }
+    if (!added)
+        return false;
+
+    const qreal summary[] = { m_sampleMinimum, m_lowerQuartile.value(), m_median.value(),
+                              m_upperQuartile.value(), m_sampleMaximum };
+    const bool restructured = (m_appendCount != m_valuesCount);
+    bool changed = restructured;
+    for (int i = 0; i < m_valuesCount && !changed; i++)
+        changed = qAbs(summary[i] - m_values[i]) > m_sampleTolerance;
+    if (!changed)
+        return false;
+
+    for (int i = 0; i < m_valuesCount; i++)
+        m_values[i] = summary[i];
+    m_appendCount = m_valuesCount;
+    if (restructured)
+        emit restructuredBox();
+    else
+        emit updatedLayout();
+
+    return true;
+}
+
+void QBoxSetPrivate::resetSamples()
+{
+    m_lowerQuartile.reset();
+    m_median.reset();
+    m_upperQuartile.reset();
+    m_sampleMinimum = 0.0;
+    m_sampleMaximum = 0.0;
+}
+
 #include "moc_qboxset.cpp"
 #include "moc_qboxset_p.cpp"
 
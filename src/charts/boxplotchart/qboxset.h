@@ -63,6 +63,12 @@ public:
 
     void clear();
 
+    void appendSample(const qreal sample);
+    void appendSamples(const QVector<qreal> &samples);
+    int sampleCount() const;
+    void setSampleTolerance(const qreal tolerance);
+    qreal sampleTolerance() const;
+
     void setLabel(const QString label);
     QString label() const;
 
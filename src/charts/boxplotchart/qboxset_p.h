@@ -41,6 +41,7 @@
 
 #include <QtCharts/QBoxSet>
 #include <QtCharts/private/qchartglobal_p.h>
+#include <private/quantileestimator_p.h>
 #include <QtCore/QMap>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
@@ -68,6 +69,9 @@ public:
 
     qreal value(const int index);
 
+    bool appendSamples(const qreal *samples, int count);
+    void resetSamples();
+
 Q_SIGNALS:
     void restructuredBox();
     void updatedBox();
@@ -84,6 +88,13 @@ private:
     QBrush m_labelBrush;
     QFont m_labelFont;
     QBoxPlotSeriesPrivate *m_series;
+    // Five-number summary of the appended samples, the samples themselves are not kept
+    QuantileEstimator m_lowerQuartile;
+    QuantileEstimator m_median;
+    QuantileEstimator m_upperQuartile;
+    qreal m_sampleMinimum;
+    qreal m_sampleMaximum;
+    qreal m_sampleTolerance;
 
     friend class QBoxSet;
     friend class QBoxPlotSeriesPrivate;
@@ -177,6 +177,18 @@ QT_CHARTS_BEGIN_NAMESPACE
     the number of columns in the model).
 */
 
+/*!
+    \property QHBoxPlotModelMapper::dataRole
+    \brief The item data role that is used to read and write the box set values.
+
+    The default value is Qt::DisplayRole.
+*/
+/*!
+    \qmlproperty int HBoxPlotModelMapper::dataRole
+    The item data role that is used to read and write the box set values.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \fn void QHBoxPlotModelMapper::seriesReplaced()
 
@@ -211,6 +223,11 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the number of columns changes.
 */
 
+/*!
+    \fn void QHBoxPlotModelMapper::dataRoleChanged()
+    This signal is emitted when the data role changes.
+*/
+
 /*!
     Constructs a mapper object that is a child of \a parent.
 */
@@ -298,6 +315,19 @@ void QHBoxPlotModelMapper::setColumnCount(int columnCount)
     }
 }
 
+int QHBoxPlotModelMapper::dataRole() const
+{
+    return QBoxPlotModelMapper::dataRole();
+}
+
+void QHBoxPlotModelMapper::setDataRole(int role)
+{
+    if (role != QBoxPlotModelMapper::dataRole()) {
+        QBoxPlotModelMapper::setDataRole(role);
+        emit dataRoleChanged();
+    }
+}
+
 #include "moc_qhboxplotmodelmapper.cpp"
 
 QT_CHARTS_END_NAMESPACE
@@ -44,6 +44,7 @@ class QT_CHARTS_EXPORT QHBoxPlotModelMapper : public QBoxPlotModelMapper
     Q_PROPERTY(int lastBoxSetRow READ lastBoxSetRow WRITE setLastBoxSetRow NOTIFY lastBoxSetRowChanged)
     Q_PROPERTY(int firstColumn READ firstColumn WRITE setFirstColumn NOTIFY firstColumnChanged)
     Q_PROPERTY(int columnCount READ columnCount WRITE setColumnCount NOTIFY columnCountChanged)
+    Q_PROPERTY(int dataRole READ dataRole WRITE setDataRole NOTIFY dataRoleChanged)
 
 public:
     explicit QHBoxPlotModelMapper(QObject *parent = nullptr);
@@ -66,6 +67,9 @@ public:
     int columnCount() const;
     void setColumnCount(int rowCount);
 
+    int dataRole() const;
+    void setDataRole(int role);
+
 Q_SIGNALS:
     void seriesReplaced();
     void modelReplaced();
@@ -73,6 +77,7 @@ Q_SIGNALS:
     void lastBoxSetRowChanged();
     void firstColumnChanged();
     void columnCountChanged();
+    void dataRoleChanged();
 };
 
 QT_CHARTS_END_NAMESPACE
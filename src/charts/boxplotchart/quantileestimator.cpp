@@ -0,0 +1,140 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/quantileestimator_p.h>
+#include <algorithm>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+QuantileEstimator::QuantileEstimator(qreal quantile)
+    : m_quantile(quantile),
+      m_count(0)
+{
+    reset();
+}
+
+void QuantileEstimator::reset()
+{
+    m_count = 0;
+    for (int i = 0; i < 5; ++i) {
+        m_heights[i] = 0.0;
+        m_positions[i] = i + 1;
+    }
+    m_desiredPositions[0] = 1.0;
+    m_desiredPositions[1] = 1.0 + 2.0 * m_quantile;
+    m_desiredPositions[2] = 1.0 + 4.0 * m_quantile;
+    m_desiredPositions[3] = 3.0 + 2.0 * m_quantile;
+    m_desiredPositions[4] = 5.0;
+    m_increments[0] = 0.0;
+    m_increments[1] = m_quantile / 2.0;
+    m_increments[2] = m_quantile;
+    m_increments[3] = (1.0 + m_quantile) / 2.0;
+    m_increments[4] = 1.0;
+}
+
+void QuantileEstimator::add(qreal sample)
+{
+    // The first five samples become the initial marker heights
+    if (m_count < 5) {
+        m_heights[m_count++] = sample;
+        if (m_count == 5)
+            std::sort(m_heights, m_heights + 5);
+        return;
+    }
+    m_count++;
+
+    int cell;
+    if (sample < m_heights[0]) {
+        m_heights[0] = sample;
+        cell = 0;
+    } else if (sample >= m_heights[4]) {
+        m_heights[4] = sample;
+        cell = 3;
+    } else {
+        cell = 0;
+        while (sample >= m_heights[cell + 1])
+            cell++;
+    }
+
+    for (int i = cell + 1; i < 5; ++i)
+        m_positions[i] += 1.0;
+    for (int i = 0; i < 5; ++i)
+        m_desiredPositions[i] += m_increments[i];
+
+    // Move the middle markers towards their desired positions, one step at a time
+    for (int i = 1; i < 4; ++i) {
+        const qreal offset = m_desiredPositions[i] - m_positions[i];
+        if ((offset >= 1.0 && m_positions[i + 1] - m_positions[i] > 1.0)
+                || (offset <= -1.0 && m_positions[i - 1] - m_positions[i] < -1.0)) {
+            const int direction = offset > 0.0 ? 1 : -1;
+            const qreal height = parabolic(i, direction);
+            if (m_heights[i - 1] < height && height < m_heights[i + 1])
+                m_heights[i] = height;
+            else
+                m_heights[i] = linear(i, direction);
+            m_positions[i] += direction;
+        }
+    }
+}
+
+qreal QuantileEstimator::value() const
+{
+    if (m_count == 0)
+        return 0.0;
+
+    if (m_count > 5)
+        return m_heights[2];
+
+    // Interpolate between the closest ranks while the samples are still known
+    qreal sorted[5];
+    std::copy(m_heights, m_heights + m_count, sorted);
+    std::sort(sorted, sorted + m_count);
+    const qreal rank = m_quantile * (m_count - 1);
+    const int lower = int(rank);
+    if (lower + 1 >= m_count)
+        return sorted[m_count - 1];
+    return sorted[lower] + (rank - lower) * (sorted[lower + 1] - sorted[lower]);
+}
+
+qreal QuantileEstimator::parabolic(int i, int direction) const
+{
+    const qreal *n = m_positions;
+    const qreal *q = m_heights;
+    return q[i] + direction / (n[i + 1] - n[i - 1])
+            * ((n[i] - n[i - 1] + direction) * (q[i + 1] - q[i]) / (n[i + 1] - n[i])
+               + (n[i + 1] - n[i] - direction) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+}
+
+qreal QuantileEstimator::linear(int i, int direction) const
+{
+    return m_heights[i] + direction * (m_heights[i + direction] - m_heights[i])
+            / (m_positions[i + direction] - m_positions[i]);
+}
+
+QT_CHARTS_END_NAMESPACE
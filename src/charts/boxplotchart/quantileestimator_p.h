@@ -0,0 +1,73 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+
+#ifndef QUANTILEESTIMATOR_P_H
+#define QUANTILEESTIMATOR_P_H
+
+#include <QtCharts/QChartGlobal>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Estimates a quantile of a sample stream with the P-square algorithm, which keeps five
+// markers instead of the samples. The estimate is exact until five samples have been added.
+class QuantileEstimator
+{
+public:
+    explicit QuantileEstimator(qreal quantile = 0.5);
+
+    void add(qreal sample);
+    void reset();
+    qreal value() const;
+    int count() const { return m_count; }
+
+private:
+    qreal parabolic(int i, int direction) const;
+    qreal linear(int i, int direction) const;
+
+    qreal m_quantile;
+    int m_count;
+    qreal m_heights[5];
+    qreal m_positions[5];
+    qreal m_desiredPositions[5];
+    qreal m_increments[5];
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QUANTILEESTIMATOR_P_H
@@ -179,6 +179,18 @@ QT_CHARTS_BEGIN_NAMESPACE
     columns in the model).
 */
 
+/*!
+    \property QVBoxPlotModelMapper::dataRole
+    \brief The item data role that is used to read and write the box set values.
+
+    The default value is Qt::DisplayRole.
+*/
+/*!
+    \qmlproperty int VBoxPlotModelMapper::dataRole
+    The item data role that is used to read and write the box set values.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \fn void QVBoxPlotModelMapper::seriesReplaced()
 
@@ -213,6 +225,11 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the number of rows changes.
 */
 
+/*!
+    \fn void QVBoxPlotModelMapper::dataRoleChanged()
+    This signal is emitted when the data role changes.
+*/
+
 /*!
     Constructs a mapper object that is a child of \a parent.
 */
@@ -300,6 +317,19 @@ void QVBoxPlotModelMapper::setRowCount(int rowCount)
     }
 }
 
+int QVBoxPlotModelMapper::dataRole() const
+{
+    return QBoxPlotModelMapper::dataRole();
+}
+
+void QVBoxPlotModelMapper::setDataRole(int role)
+{
+    if (role != QBoxPlotModelMapper::dataRole()) {
+        QBoxPlotModelMapper::setDataRole(role);
+        emit dataRoleChanged();
+    }
+}
+
 #include "moc_qvboxplotmodelmapper.cpp"
 
 QT_CHARTS_END_NAMESPACE
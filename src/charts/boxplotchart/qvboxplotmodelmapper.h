@@ -43,6 +43,7 @@ class QT_CHARTS_EXPORT QVBoxPlotModelMapper : public QBoxPlotModelMapper
     Q_PROPERTY(int lastBoxSetColumn READ lastBoxSetColumn WRITE setLastBoxSetColumn NOTIFY lastBoxSetColumnChanged)
     Q_PROPERTY(int firstRow READ firstRow WRITE setFirstRow NOTIFY firstRowChanged)
     Q_PROPERTY(int rowCount READ rowCount WRITE setRowCount NOTIFY rowCountChanged)
+    Q_PROPERTY(int dataRole READ dataRole WRITE setDataRole NOTIFY dataRoleChanged)
 
 public:
     explicit QVBoxPlotModelMapper(QObject *parent = nullptr);
@@ -65,6 +66,9 @@ public:
     int rowCount() const;
     void setRowCount(int rowCount);
 
+    int dataRole() const;
+    void setDataRole(int role);
+
 Q_SIGNALS:
     void seriesReplaced();
     void modelReplaced();
@@ -72,6 +76,7 @@ Q_SIGNALS:
     void lastBoxSetColumnChanged();
     void firstRowChanged();
     void rowCountChanged();
+    void dataRoleChanged();
 };
 
 QT_CHARTS_END_NAMESPACE
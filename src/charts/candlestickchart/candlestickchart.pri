@@ -2,7 +2,6 @@ INCLUDEPATH += $$PWD
 DEPENDPATH += $$PWD
 
 SOURCES += \
-    $$PWD/candlestick.cpp \
     $$PWD/candlestickchartitem.cpp \
     $$PWD/qcandlestickseries.cpp \
     $$PWD/qcandlestickset.cpp \
@@ -11,7 +10,6 @@ SOURCES += \
     $$PWD/qvcandlestickmodelmapper.cpp
 
 PRIVATE_HEADERS += \
-    $$PWD/candlestick_p.h \
     $$PWD/candlestickchartitem_p.h \
     $$PWD/candlestickdata_p.h \
     $$PWD/qcandlestickseries_p.h \
@@ -27,13 +27,18 @@
 **
 ****************************************************************************/
 
+#include <QtCharts/QAbstractAxis>
 #include <QtCharts/QCandlestickSeries>
 #include <QtCharts/QCandlestickSet>
+#include <QtCharts/QChart>
+#include <QtCore/QDebug>
+#include <QtGui/QPainter>
+#include <QtWidgets/QGraphicsSceneEvent>
+#include <private/abstractdomain_p.h>
+#include <private/candlestickanimation_p.h>
 #include <private/candlestickchartitem_p.h>
-#include <private/candlestick_p.h>
-#include <private/candlestickdata_p.h>
+#include <private/chartpresenter_p.h>
 #include <private/qcandlestickseries_p.h>
-#include <private/candlestickanimation_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -43,14 +48,17 @@ CandlestickChartItem::CandlestickChartItem(QCandlestickSeries *series, QGraphics
       m_seriesIndex(0),
       m_seriesCount(0),
       m_timePeriod(0.0),
-      m_animation(nullptr)
+      m_aggregationLevel(0),
+      m_animation(nullptr),
+      m_categoryAxis(false),
+      m_hoveredSet(nullptr),
+      m_pressedSet(nullptr)
 {
-    setAcceptedMouseButtons(0);
-    connect(series, SIGNAL(candlestickSetsAdded(QList<QCandlestickSet *>)),
-            this, SLOT(handleCandlestickSetsAdd(QList<QCandlestickSet *>)));
-    connect(series, SIGNAL(candlestickSetsRemoved(QList<QCandlestickSet *>)),
-            this, SLOT(handleCandlestickSetsRemove(QList<QCandlestickSet *>)));
+    setAcceptHoverEvents(true);
+    setAcceptedMouseButtons(Qt::MouseButtonMask);
 
+    connect(series->d_func(), SIGNAL(restructuredCandlesticks()),
+            this, SLOT(handleDataStructureChanged()));
     connect(series->d_func(), SIGNAL(updated()), this, SLOT(handleCandlesticksUpdated()));
     connect(series->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleLayoutUpdated()));
     connect(series->d_func(), SIGNAL(updatedCandlesticks()),
@@ -58,7 +66,7 @@ CandlestickChartItem::CandlestickChartItem(QCandlestickSeries *series, QGraphics
 
     setZValue(ChartPresenter::CandlestickSeriesZValue);
 
-    handleCandlestickSetsAdd(m_series->sets());
+    handleDataStructureChanged();
 }
 
 CandlestickChartItem::~CandlestickChartItem()
@@ -69,12 +77,20 @@ void CandlestickChartItem::setAnimation(CandlestickAnimation *animation)
 {
     m_animation = animation;
 
-    if (m_animation) {
-        foreach (Candlestick *item, m_candlesticks.values())
-            m_animation->addCandlestick(item);
-
+    if (m_animation)
         handleDomainUpdated();
-    }
+}
+
+ChartAnimation *CandlestickChartItem::animation() const
+{
+    return m_animation;
+}
+
+void CandlestickChartItem::setLayout(const QVector<CandlestickData> &layout)
+{
+    m_layout = layout;
+    updateGeometry();
+    update();
 }
 
 QRectF CandlestickChartItem::boundingRect() const
@@ -82,12 +98,73 @@ QRectF CandlestickChartItem::boundingRect() const
     return m_boundingRect;
 }
 
+// Only the candlesticks take mouse and hover events, the rest of the plot area is left to
+// the series stacked below this item
+QPainterPath CandlestickChartItem::shape() const
+{
+    return m_shape;
+}
+
 void CandlestickChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                                  QWidget *widget)
 {
-    Q_UNUSED(painter);
     Q_UNUSED(option);
     Q_UNUSED(widget);
+
+    const QPen pen = m_series->pen();
+    const QColor increasingColor = m_series->increasingColor();
+    const QColor decreasingColor = m_series->decreasingColor();
+    QBrush increasingBrush(m_series->brush());
+    increasingBrush.setColor(increasingColor);
+    QBrush decreasingBrush(m_series->brush());
+    decreasingBrush.setColor(decreasingColor);
+
+    painter->save();
+    painter->setClipRect(m_boundingRect);
+    painter->setPen(pen);
+    if (m_series->capsVisible())
+        painter->drawLines(m_caps);
+    painter->drawLines(m_wicks);
+    if (!m_series->bodyOutlineVisible())
+        painter->setPen(Qt::NoPen);
+    painter->setBrush(increasingBrush);
+    painter->drawRects(m_increasingBodies);
+    painter->setBrush(decreasingBrush);
+    painter->drawRects(m_decreasingBodies);
+
+    // Sets keep their own pen and brush, but the trend color still comes from the series
+    const QVector<QCandlestickSet *> &rowSets = m_series->d_func()->m_rowSets;
+    Geometry geometry;
+    for (int index : qAsConst(m_customCandlesticks)) {
+        const QCandlestickSet *set = index < rowSets.count() ? rowSets.at(index) : nullptr;
+        if (!set || !calculateGeometry(index, geometry))
+            continue;
+
+        const CandlestickData &data = m_layout.at(index);
+        QBrush brush(set->brush() == Qt::NoBrush ? m_series->brush() : set->brush());
+        brush.setColor(data.m_open < data.m_close ? increasingColor : decreasingColor);
+        painter->setBrush(brush);
+        painter->setPen(set->pen() == Qt::NoPen ? pen : set->pen());
+        if (m_series->capsVisible()) {
+            if (!geometry.upperCap.isNull())
+                painter->drawLine(geometry.upperCap);
+            if (!geometry.lowerCap.isNull())
+                painter->drawLine(geometry.lowerCap);
+        }
+        if (!geometry.upperWick.isNull())
+            painter->drawLine(geometry.upperWick);
+        if (!geometry.lowerWick.isNull())
+            painter->drawLine(geometry.lowerWick);
+        if (!m_series->bodyOutlineVisible())
+            painter->setPen(Qt::NoPen);
+        painter->drawRect(geometry.body);
+    }
+    painter->restore();
+}
+
+bool CandlestickChartItem::contains(const QPointF &point) const
+{
+    return candlestickAt(point) >= 0;
 }
 
 void CandlestickChartItem::handleDomainUpdated()
@@ -97,53 +174,24 @@ void CandlestickChartItem::handleDomainUpdated()
 
     // Set bounding rectangle to same as domain size. Add one pixel at the top (-1.0) and the bottom
     // as 0.0 would snip a bit off from the wick at the grid line.
+    prepareGeometryChange();
     m_boundingRect.setRect(0.0, -1.0, domain()->size().width(), domain()->size().height() + 1.0);
 
-    foreach (Candlestick *item, m_candlesticks.values()) {
-        item->updateGeometry(domain());
-
-        if (m_animation)
-            presenter()->startAnimation(m_animation->candlestickAnimation(item));
-    }
+    applyLayout(calculateLayout(), false);
 }
 
 void CandlestickChartItem::handleLayoutUpdated()
 {
-    bool timestampChanged = false;
-    foreach (QCandlestickSet *set, m_candlesticks.keys()) {
-        qreal oldTimestamp = m_candlesticks.value(set)->m_data.m_timestamp;
-        qreal newTimestamp = set->timestamp();
-        if (Q_UNLIKELY(oldTimestamp != newTimestamp)) {
-            removeTimestamp(oldTimestamp);
-            addTimestamp(newTimestamp);
-            timestampChanged = true;
-        }
-    }
-    if (timestampChanged)
-        updateTimePeriod();
-
-    foreach (Candlestick *item, m_candlesticks.values()) {
-        if (m_animation)
-            m_animation->setAnimationStart(item);
-
-        item->setTimePeriod(m_timePeriod);
-        item->setMaximumColumnWidth(m_series->maximumColumnWidth());
-        item->setMinimumColumnWidth(m_series->minimumColumnWidth());
-        item->setBodyWidth(m_series->bodyWidth());
-        item->setCapsWidth(m_series->capsWidth());
-
-        bool dirty = updateCandlestickGeometry(item, item->m_data.m_index);
-        if (dirty && m_animation)
-            presenter()->startAnimation(m_animation->candlestickChangeAnimation(item));
-        else
-            item->updateGeometry(domain());
-    }
+    updateTimePeriod();
+    const int aggregationLevel = m_aggregationLevel;
+    const QVector<CandlestickData> layout = calculateLayout();
+    applyLayout(layout, aggregationLevel == m_aggregationLevel);
 }
 
 void CandlestickChartItem::handleCandlesticksUpdated()
 {
-    foreach (QCandlestickSet *set, m_candlesticks.keys())
-        updateCandlestickAppearance(m_candlesticks.value(set), set);
+    updateGeometry();
+    update();
 }
 
 void CandlestickChartItem::handleCandlestickSeriesChange()
@@ -174,173 +222,369 @@ void CandlestickChartItem::handleCandlestickSeriesChange()
     }
 }
 
-void CandlestickChartItem::handleCandlestickSetsAdd(const QList<QCandlestickSet *> &sets)
+void CandlestickChartItem::handleDataStructureChanged()
 {
-    foreach (QCandlestickSet *set, sets) {
-        Candlestick *item = m_candlesticks.value(set, 0);
-        if (item) {
-            qWarning() << "There is already a candlestick for this set in the hash";
-            continue;
-        }
+    const QList<QCandlestickSet *> &sets = m_series->d_func()->m_sets;
+    if (m_hoveredSet && !sets.contains(m_hoveredSet))
+        setHoveredSet(nullptr);
+    if (m_pressedSet && !sets.contains(m_pressedSet))
+        m_pressedSet = nullptr;
 
-        item = new Candlestick(set, domain(), this);
-        m_candlesticks.insert(set, item);
-        addTimestamp(set->timestamp());
-
-        connect(item, SIGNAL(clicked(QCandlestickSet *)),
-                m_series, SIGNAL(clicked(QCandlestickSet *)));
-        connect(item, SIGNAL(hovered(bool, QCandlestickSet *)),
-                m_series, SIGNAL(hovered(bool, QCandlestickSet *)));
-        connect(item, SIGNAL(pressed(QCandlestickSet *)),
-                m_series, SIGNAL(pressed(QCandlestickSet *)));
-        connect(item, SIGNAL(released(QCandlestickSet *)),
-                m_series, SIGNAL(released(QCandlestickSet *)));
-        connect(item, SIGNAL(doubleClicked(QCandlestickSet *)),
-                m_series, SIGNAL(doubleClicked(QCandlestickSet *)));
-        connect(item, SIGNAL(clicked(QCandlestickSet *)), set, SIGNAL(clicked()));
-        connect(item, SIGNAL(hovered(bool, QCandlestickSet *)), set, SIGNAL(hovered(bool)));
-        connect(item, SIGNAL(pressed(QCandlestickSet *)), set, SIGNAL(pressed()));
-        connect(item, SIGNAL(released(QCandlestickSet *)), set, SIGNAL(released()));
-        connect(item, SIGNAL(doubleClicked(QCandlestickSet *)), set, SIGNAL(doubleClicked()));
-    }
+    updateTimePeriod();
+    handleDomainUpdated();
+}
 
-    handleDataStructureChanged();
+void CandlestickChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = candlestickAt(event->pos());
+    if (index < 0) {
+        event->ignore();
+        return;
+    }
+    m_pressedSet = m_series->d_func()->setAt(index);
+    emit m_series->pressed(m_pressedSet);
+    emit m_pressedSet->pressed();
+    QGraphicsItem::mousePressEvent(event);
 }
 
-void CandlestickChartItem::handleCandlestickSetsRemove(const QList<QCandlestickSet *> &sets)
+void CandlestickChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
 {
-    foreach (QCandlestickSet *set, sets) {
-        Candlestick *item = m_candlesticks.value(set);
+    // Like a button, the candlestick that got the press gets the release and the click
+    if (m_pressedSet) {
+        QCandlestickSet *set = m_pressedSet;
+        m_pressedSet = nullptr;
+        emit m_series->released(set);
+        emit set->released();
+        emit m_series->clicked(set);
+        emit set->clicked();
+    }
+    QGraphicsItem::mouseReleaseEvent(event);
+}
 
-        m_candlesticks.remove(set);
-        removeTimestamp(set->timestamp());
+void CandlestickChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    // For candlestick a pressed signal needs to be explicitly fired for mouseDoubleClickEvent.
+    const int index = candlestickAt(event->pos());
+    if (index >= 0) {
+        QCandlestickSet *set = m_series->d_func()->setAt(index);
+        emit m_series->pressed(set);
+        emit set->pressed();
+        emit m_series->doubleClicked(set);
+        emit set->doubleClicked();
+    }
+    QGraphicsItem::mouseDoubleClickEvent(event);
+}
 
-        if (m_animation) {
-            ChartAnimation *animation = m_animation->candlestickAnimation(item);
-            if (animation) {
-                animation->stop();
-                delete animation;
-            }
-        }
+void CandlestickChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    hoverMoveEvent(event);
+}
 
-        delete item;
-    }
+void CandlestickChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    const int index = candlestickAt(event->pos());
+    setHoveredSet(index >= 0 ? m_series->d_func()->setAt(index) : nullptr);
+}
 
-    handleDataStructureChanged();
+void CandlestickChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event)
+    setHoveredSet(nullptr);
 }
 
-void CandlestickChartItem::handleDataStructureChanged()
+QVector<CandlestickData> CandlestickChartItem::calculateLayout()
 {
-    updateTimePeriod();
+    QCandlestickSeriesPrivate *d = m_series->d_func();
+
+    m_aggregationLevel = calculateAggregationLevel();
+    if (m_aggregationLevel > 0)
+        return d->aggregatedCandlesticks(m_aggregationLevel, m_timePeriod);
+
+    const int count = d->m_timestamps.count();
+    QVector<CandlestickData> layout(count);
+    for (int i = 0; i < count; ++i) {
+        CandlestickData &data = layout[i];
+        data.m_timestamp = d->m_timestamps.at(i);
+        data.m_open = d->m_opens.at(i);
+        data.m_high = d->m_highs.at(i);
+        data.m_low = d->m_lows.at(i);
+        data.m_close = d->m_closes.at(i);
+    }
 
-    for (int i = 0; i < m_series->count(); ++i) {
-        QCandlestickSet *set = m_series->sets().at(i);
-        Candlestick *item = m_candlesticks.value(set);
+    return layout;
+}
 
-        updateCandlestickGeometry(item, i);
-        updateCandlestickAppearance(item, set);
+int CandlestickChartItem::calculateAggregationLevel()
+{
+    const qreal aggregationWidth = m_series->aggregationWidth();
+    if (aggregationWidth <= 0.0 || m_timePeriod <= 0.0
+            || m_series->d_func()->m_timestamps.count() < 2) {
+        return 0;
+    }
 
-        item->updateGeometry(domain());
+    const qreal domainWidth = domain()->maxX() - domain()->minX();
+    if (domainWidth <= 0.0 || domain()->size().width() <= 0.0 || !updateAxisType()
+            || m_categoryAxis) {
+        return 0;
+    }
 
-        if (m_animation)
-            m_animation->addCandlestick(item);
+    // Double the period until a merged candlestick is at least aggregationWidth pixels wide
+    qreal periodWidth = m_timePeriod * domain()->size().width() / domainWidth;
+    int level = 0;
+    while (periodWidth < aggregationWidth && level < 30) {
+        periodWidth *= 2.0;
+        level++;
     }
 
-    handleDomainUpdated();
+    return level;
 }
 
-bool CandlestickChartItem::updateCandlestickGeometry(Candlestick *item, int index)
+void CandlestickChartItem::applyLayout(const QVector<CandlestickData> &layout,
+                                       bool changeAnimation)
 {
-    bool changed = false;
+    if (!m_animation || !presenter() || m_boundingRect.isEmpty()) {
+        setLayout(layout);
+        return;
+    }
 
-    QCandlestickSet *set = m_series->sets().at(index);
-    CandlestickData &data = item->m_data;
+    // Value changes animate from the current values, everything else grows from the
+    // middle of the bodies
+    QVector<CandlestickData> start;
+    if (changeAnimation && m_layout.count() == layout.count()) {
+        start = m_layout;
+    } else {
+        start = layout;
+        for (int i = 0; i < start.count(); ++i) {
+            CandlestickData &data = start[i];
+            const qreal median = (data.m_open + data.m_close) / 2;
+            data.m_open = median;
+            data.m_high = median;
+            data.m_low = median;
+            data.m_close = median;
+        }
+    }
+    m_animation->setup(start, layout);
+    presenter()->startAnimation(m_animation);
+}
 
-    if ((data.m_open != set->open())
-        || (data.m_high != set->high())
-        || (data.m_low != set->low())
-        || (data.m_close != set->close())) {
-        changed = true;
+bool CandlestickChartItem::calculateGeometry(int index, Geometry &geometry) const
+{
+    const CandlestickData &data = m_layout.at(index);
+
+    qreal columnWidth = 0.0;
+    qreal columnCenter = 0.0;
+    if (m_categoryAxis) {
+        columnWidth = 1.0 / qMax(m_seriesCount, 1);
+        columnCenter = index - 0.5 + m_seriesIndex * columnWidth + columnWidth / 2.0;
+    } else {
+        columnWidth = m_timePeriod * (1 << m_aggregationLevel);
+        columnCenter = data.m_timestamp;
     }
 
-    data.m_timestamp = set->timestamp();
-    data.m_open = set->open();
-    data.m_high = set->high();
-    data.m_low = set->low();
-    data.m_close = set->close();
-    data.m_index = index;
+    const qreal bodyWidth = m_series->bodyWidth() * columnWidth;
+    const qreal bodyLeft = columnCenter - (bodyWidth / 2.0);
+    const qreal bodyRight = bodyLeft + bodyWidth;
+
+    const qreal upperBody = qMax(data.m_open, data.m_close);
+    const qreal lowerBody = qMin(data.m_open, data.m_close);
+    const bool upperWickVisible = (data.m_high > upperBody);
+    const bool lowerWickVisible = (data.m_low < lowerBody);
+
+    bool validData;
+    const QPointF upperExtreme =
+            domain()->calculateGeometryPoint(QPointF(bodyLeft, data.m_high), validData);
+    if (!validData)
+        return false;
+    const QPointF bodyTopLeft =
+            domain()->calculateGeometryPoint(QPointF(bodyLeft, upperBody), validData);
+    if (!validData)
+        return false;
+    const QPointF bodyBottomRight =
+            domain()->calculateGeometryPoint(QPointF(bodyRight, lowerBody), validData);
+    if (!validData)
+        return false;
+    const QPointF lowerExtreme =
+            domain()->calculateGeometryPoint(QPointF(bodyRight, data.m_low), validData);
+    if (!validData)
+        return false;
+
+    // Real Body
+    QRectF &body = geometry.body;
+    body.setCoords(bodyTopLeft.x(), bodyTopLeft.y(), bodyBottomRight.x(), bodyBottomRight.y());
+    const qreal maximumColumnWidth = m_series->maximumColumnWidth();
+    if (maximumColumnWidth != -1.0) {
+        if (body.width() > maximumColumnWidth) {
+            qreal extra = (body.width() - maximumColumnWidth) / 2.0;
+            body.adjust(extra, 0.0, 0.0, 0.0);
+            body.setWidth(maximumColumnWidth);
+        }
+    }
+    const qreal minimumColumnWidth = m_series->minimumColumnWidth();
+    if (minimumColumnWidth != -1.0) {
+        if (body.width() < minimumColumnWidth) {
+            qreal extra = (minimumColumnWidth - body.width()) / 2.0;
+            body.adjust(-extra, 0.0, 0.0, 0.0);
+            body.setWidth(minimumColumnWidth);
+        }
+    }
 
-    data.m_maxX = domain()->maxX();
-    data.m_minX = domain()->minX();
-    data.m_maxY = domain()->maxY();
-    data.m_minY = domain()->minY();
+    const qreal capsExtra = (body.width() - (body.width() * m_series->capsWidth())) / 2.0;
+    const qreal capsLeft = body.left() + capsExtra;
+    const qreal capsRight = body.right() - capsExtra;
+    const qreal wickX = (capsLeft + capsRight) / 2.0;
+
+    // Upper Wick and Cap
+    if (upperWickVisible) {
+        geometry.upperCap.setLine(capsLeft, upperExtreme.y(), capsRight, upperExtreme.y());
+        geometry.upperWick.setLine(wickX, upperExtreme.y(), wickX, body.top());
+    } else {
+        geometry.upperCap = QLineF();
+        geometry.upperWick = QLineF();
+    }
+    // Lower Wick and Cap
+    if (lowerWickVisible) {
+        geometry.lowerCap.setLine(capsLeft, lowerExtreme.y(), capsRight, lowerExtreme.y());
+        geometry.lowerWick.setLine(wickX, body.bottom(), wickX, lowerExtreme.y());
+    } else {
+        geometry.lowerCap = QLineF();
+        geometry.lowerWick = QLineF();
+    }
 
-    data.m_series = m_series;
-    data.m_seriesIndex = m_seriesIndex;
-    data.m_seriesCount = m_seriesCount;
+    geometry.bounds.setCoords(body.left(), upperWickVisible ? upperExtreme.y() : body.top(),
+                              body.right(), lowerWickVisible ? lowerExtreme.y() : body.bottom());
+    const qreal extra = m_series->pen().widthF();
+    geometry.bounds.adjust(-extra, -extra, extra, extra);
 
-    return changed;
+    return true;
 }
 
-void CandlestickChartItem::updateCandlestickAppearance(Candlestick *item, QCandlestickSet *set)
+void CandlestickChartItem::updateGeometry()
 {
-    item->setTimePeriod(m_timePeriod);
-    item->setMaximumColumnWidth(m_series->maximumColumnWidth());
-    item->setMinimumColumnWidth(m_series->minimumColumnWidth());
-    item->setBodyWidth(m_series->bodyWidth());
-    item->setBodyOutlineVisible(m_series->bodyOutlineVisible());
-    item->setCapsWidth(m_series->capsWidth());
-    item->setCapsVisible(m_series->capsVisible());
-    item->setIncreasingColor(m_series->increasingColor());
-    item->setDecreasingColor(m_series->decreasingColor());
-
-    // Set the decorative issues for the candlestick so that
-    // the brush and pen already defined for the set are kept.
-    if (set->brush() == Qt::NoBrush)
-        item->setBrush(m_series->brush());
-    else
-        item->setBrush(set->brush());
+    m_increasingBodies.resize(0);
+    m_decreasingBodies.resize(0);
+    m_wicks.resize(0);
+    m_caps.resize(0);
+    m_customCandlesticks.resize(0);
+    m_candlestickRects.resize(0);
+    m_shape = QPainterPath();
+    m_shape.setFillRule(Qt::WindingFill);
+
+    if (!updateAxisType())
+        return;
 
-    if (set->pen() == Qt::NoPen)
-        item->setPen(m_series->pen());
-    else
-        item->setPen(set->pen());
-}
+    // Candlesticks added in bulk or merged have no set to report mouse events to
+    const QVector<QCandlestickSet *> &rowSets = m_series->d_func()->m_rowSets;
+    const bool hitTesting = !m_series->d_func()->m_sets.isEmpty() && m_aggregationLevel == 0;
+    const int count = m_layout.count();
+    if (hitTesting)
+        m_candlestickRects.fill(QRectF(), count);
 
-void CandlestickChartItem::addTimestamp(qreal timestamp)
-{
-    int index = 0;
-    for (int i = m_timestamps.count() - 1; i >= 0; --i) {
-        if (timestamp > m_timestamps.at(i)) {
-            index = i + 1;
-            break;
+    Geometry geometry;
+    for (int i = 0; i < count; ++i) {
+        if (!calculateGeometry(i, geometry))
+            continue;
+
+        const QCandlestickSet *set = (hitTesting && i < rowSets.count()) ? rowSets.at(i) : nullptr;
+        if (set) {
+            m_candlestickRects[i] = geometry.bounds;
+            m_shape.addRect(geometry.bounds.intersected(m_boundingRect));
+            if (hasCustomAppearance(set)) {
+                m_customCandlesticks.append(i);
+                continue;
+            }
+        }
+
+        const CandlestickData &data = m_layout.at(i);
+        if (data.m_open < data.m_close)
+            m_increasingBodies.append(geometry.body);
+        else
+            m_decreasingBodies.append(geometry.body);
+        if (!geometry.upperWick.isNull()) {
+            m_wicks.append(geometry.upperWick);
+            m_caps.append(geometry.upperCap);
+        }
+        if (!geometry.lowerWick.isNull()) {
+            m_wicks.append(geometry.lowerWick);
+            m_caps.append(geometry.lowerCap);
         }
     }
-    m_timestamps.insert(index, timestamp);
 }
 
-void CandlestickChartItem::removeTimestamp(qreal timestamp)
+bool CandlestickChartItem::updateAxisType()
 {
-    m_timestamps.removeOne(timestamp);
+    if (!m_series->chart())
+        return false;
+
+    QList<QAbstractAxis *> axes = m_series->chart()->axes(Qt::Horizontal, m_series);
+    if (axes.isEmpty())
+        return false;
+
+    switch (axes.first()->type()) {
+    case QAbstractAxis::AxisTypeBarCategory:
+        m_categoryAxis = true;
+        break;
+    case QAbstractAxis::AxisTypeDateTime:
+    case QAbstractAxis::AxisTypeValue:
+        m_categoryAxis = false;
+        break;
+    default:
+        qWarning() << "Unexpected axis type";
+        return false;
+    }
+
+    return true;
 }
 
 void CandlestickChartItem::updateTimePeriod()
 {
-    if (m_timestamps.count() == 0) {
+    const QCandlestickSeriesPrivate *d = m_series->d_func();
+
+    if (d->m_timestamps.count() == 0) {
         m_timePeriod = 0;
         return;
     }
 
-    if (m_timestamps.count() == 1) {
+    if (d->m_timestamps.count() == 1) {
         m_timePeriod = qAbs(domain()->maxX() - domain()->minX());
         return;
     }
 
-    qreal timePeriod = qAbs(m_timestamps.at(1) - m_timestamps.at(0));
-    for (int i = 1; i < m_timestamps.count(); ++i) {
-        timePeriod = qMin(timePeriod, qAbs(m_timestamps.at(i) - m_timestamps.at(i - 1)));
+    m_timePeriod = d->minimumTimePeriod();
+}
+
+bool CandlestickChartItem::hasCustomAppearance(const QCandlestickSet *set) const
+{
+    return set->brush() != Qt::NoBrush || set->pen() != Qt::NoPen;
+}
+
+int CandlestickChartItem::candlestickAt(const QPointF &pos) const
+{
+    if (!m_boundingRect.contains(pos))
+        return -1;
+
+    // Later candlesticks are drawn on top of the earlier ones
+    for (int i = m_candlestickRects.count() - 1; i >= 0; --i) {
+        if (m_candlestickRects.at(i).contains(pos))
+            return (i < m_series->d_func()->m_rowSets.count() && m_series->d_func()->setAt(i)) ? i : -1;
+    }
+
+    return -1;
+}
+
+void CandlestickChartItem::setHoveredSet(QCandlestickSet *set)
+{
+    if (set == m_hoveredSet)
+        return;
+
+    if (m_hoveredSet) {
+        emit m_series->hovered(false, m_hoveredSet);
+        emit m_hoveredSet->hovered(false);
+    }
+    m_hoveredSet = set;
+    if (m_hoveredSet) {
+        emit m_series->hovered(true, m_hoveredSet);
+        emit m_hoveredSet->hovered(true);
     }
-    m_timePeriod = timePeriod;
 }
 
 #include "moc_candlestickchartitem_p.cpp"
@@ -40,11 +40,12 @@
 #define CANDLESTICKCHARTITEM_P_H
 
 #include <private/chartitem_p.h>
+#include <private/candlestickdata_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
+#include <QtGui/QPainterPath>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-class Candlestick;
 class CandlestickAnimation;
 class QCandlestickSeries;
 class QCandlestickSet;
@@ -58,9 +59,13 @@ public:
     ~CandlestickChartItem();
 
     void setAnimation(CandlestickAnimation *animation);
+    ChartAnimation *animation() const;
+    void setLayout(const QVector<CandlestickData> &layout);
 
     QRectF boundingRect() const;
+    QPainterPath shape() const;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
+    bool contains(const QPointF &point) const;
 
 public Q_SLOTS:
     void handleDomainUpdated();
@@ -69,27 +74,58 @@ public Q_SLOTS:
     void handleCandlestickSeriesChange();
 
 private Q_SLOTS:
-    void handleCandlestickSetsAdd(const QList<QCandlestickSet *> &sets);
-    void handleCandlestickSetsRemove(const QList<QCandlestickSet *> &sets);
     void handleDataStructureChanged();
 
-private:
-    bool updateCandlestickGeometry(Candlestick *item, int index);
-    void updateCandlestickAppearance(Candlestick *item, QCandlestickSet *set);
+protected:
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
 
-    void addTimestamp(qreal timestamp);
-    void removeTimestamp(qreal timestamp);
+private:
+    struct Geometry {
+        QRectF body;
+        QRectF bounds;
+        QLineF upperWick;
+        QLineF lowerWick;
+        QLineF upperCap;
+        QLineF lowerCap;
+    };
+
+    QVector<CandlestickData> calculateLayout();
+    int calculateAggregationLevel();
+    bool updateAxisType();
+    void applyLayout(const QVector<CandlestickData> &layout, bool changeAnimation);
+    bool calculateGeometry(int index, Geometry &geometry) const;
+    void updateGeometry();
     void updateTimePeriod();
+    bool hasCustomAppearance(const QCandlestickSet *set) const;
+    int candlestickAt(const QPointF &pos) const;
+    void setHoveredSet(QCandlestickSet *set);
 
 protected:
     QRectF m_boundingRect;
     QCandlestickSeries *m_series; // Not owned.
     int m_seriesIndex;
     int m_seriesCount;
-    QHash<QCandlestickSet *, Candlestick *> m_candlesticks;
-    QList<qreal> m_timestamps;
     qreal m_timePeriod;
+    int m_aggregationLevel; // Candlesticks are merged into periods of 2^level * m_timePeriod
     CandlestickAnimation *m_animation;
+    QVector<CandlestickData> m_layout; // Values shown, interpolated while animating
+    // Geometry is batched by pen and brush, sets with their own pen or brush are drawn one by one
+    QVector<QRectF> m_increasingBodies;
+    QVector<QRectF> m_decreasingBodies;
+    QVector<QLineF> m_wicks;
+    QVector<QLineF> m_caps;
+    QVector<int> m_customCandlesticks;
+    bool m_categoryAxis;
+    // Hit areas of the candlesticks backed by sets, empty when the series has no sets
+    QVector<QRectF> m_candlestickRects;
+    QPainterPath m_shape; // Union of m_candlestickRects, used by the scene for hit testing
+    QCandlestickSet *m_hoveredSet;
+    QCandlestickSet *m_pressedSet;
 };
 
 QT_CHARTS_END_NAMESPACE
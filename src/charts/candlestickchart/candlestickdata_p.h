@@ -39,11 +39,12 @@
 #ifndef CANDLESTICKDATA_P_H
 #define CANDLESTICKDATA_P_H
 
-#include <QtCharts/QCandlestickSeries>
+#include <QtCharts/QChartGlobal>
 #include <QtCharts/private/qchartglobal_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// The values of one candlestick as shown by the chart item, interpolated while animating
 class QT_CHARTS_PRIVATE_EXPORT CandlestickData
 {
 public:
@@ -52,38 +53,19 @@ public:
         m_open(0.0),
         m_high(0.0),
         m_low(0.0),
-        m_close(0.0),
-        m_index(0),
-        m_maxX(0.0),
-        m_minX(0.0),
-        m_maxY(0.0),
-        m_minY(0.0),
-        m_series(nullptr),
-        m_seriesIndex(0),
-        m_seriesCount(0)
+        m_close(0.0)
     {
     }
 
-    // Candlestick related statistics
     qreal m_timestamp;
     qreal m_open;
     qreal m_high;
     qreal m_low;
     qreal m_close;
-    int m_index;
-
-    // Domain boundaries
-    qreal m_maxX;
-    qreal m_minX;
-    qreal m_maxY;
-    qreal m_minY;
-
-    // Series related data
-    QCandlestickSeries *m_series;
-    int m_seriesIndex;
-    int m_seriesCount;
 };
 
 QT_CHARTS_END_NAMESPACE
 
+Q_DECLARE_TYPEINFO(QT_CHARTS_NAMESPACE::CandlestickData, Q_MOVABLE_TYPE);
+
 #endif // CANDLESTICKDATA_P_H
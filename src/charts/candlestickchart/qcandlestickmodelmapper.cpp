@@ -62,6 +62,13 @@ QT_CHARTS_BEGIN_NAMESPACE
     specified, the old series is disconnected (preserving its data).
 */
 
+/*!
+    \property QCandlestickModelMapper::dataRole
+    \brief The item data role that is used to read and write the values of the sets.
+
+    The default value is Qt::DisplayRole.
+*/
+
 /*!
     \fn Qt::Orientation QCandlestickModelMapper::orientation() const
     Returns the orientation that is used when QCandlestickModelMapper accesses the model. This
@@ -81,6 +88,12 @@ QT_CHARTS_BEGIN_NAMESPACE
     \sa series
 */
 
+/*!
+    \fn void QCandlestickModelMapper::dataRoleChanged()
+    \brief Emitted when the data role changes.
+    \sa dataRole
+*/
+
 /*!
     Constructs a model mapper object as a child of \a parent.
 */
@@ -163,6 +176,25 @@ QCandlestickSeries *QCandlestickModelMapper::series() const
     return d->m_series;
 }
 
+void QCandlestickModelMapper::setDataRole(int role)
+{
+    Q_D(QCandlestickModelMapper);
+
+    if (d->m_role == role)
+        return;
+
+    d->m_role = role;
+    emit dataRoleChanged();
+    d->initializeCandlestickFromModel();
+}
+
+int QCandlestickModelMapper::dataRole() const
+{
+    Q_D(const QCandlestickModelMapper);
+
+    return d->m_role;
+}
+
 /*!
     Sets the row/column of the model that contains the \a timestamp values of the sets in the
     series. Default value is -1 (invalid mapping).
@@ -379,6 +411,7 @@ QCandlestickModelMapperPrivate::QCandlestickModelMapperPrivate(QCandlestickModel
       m_close(-1),
       m_firstSetSection(-1),
       m_lastSetSection(-1),
+      m_role(Qt::DisplayRole),
       m_modelSignalsBlock(false),
       m_seriesSignalsBlock(false),
       q_ptr(q)
@@ -409,11 +442,11 @@ void QCandlestickModelMapperPrivate::initializeCandlestickFromModel()
             && lowIndex.isValid()
             && closeIndex.isValid()) {
             QCandlestickSet *set = new QCandlestickSet();
-            set->setTimestamp(m_model->data(timestampIndex, Qt::DisplayRole).toReal());
-            set->setOpen(m_model->data(openIndex, Qt::DisplayRole).toReal());
-            set->setHigh(m_model->data(highIndex, Qt::DisplayRole).toReal());
-            set->setLow(m_model->data(lowIndex, Qt::DisplayRole).toReal());
-            set->setClose(m_model->data(closeIndex, Qt::DisplayRole).toReal());
+            set->setTimestamp(m_model->data(timestampIndex, m_role).toReal());
+            set->setOpen(m_model->data(openIndex, m_role).toReal());
+            set->setHigh(m_model->data(highIndex, m_role).toReal());
+            set->setLow(m_model->data(lowIndex, m_role).toReal());
+            set->setClose(m_model->data(closeIndex, m_role).toReal());
 
             connect(set, SIGNAL(timestampChanged()), this, SLOT(candlestickSetChanged()));
             connect(set, SIGNAL(openChanged()), this, SLOT(candlestickSetChanged()));
@@ -450,15 +483,15 @@ void QCandlestickModelMapperPrivate::modelDataUpdated(QModelIndex topLeft, QMode
             if (set) {
                 int pos = (q->orientation() == Qt::Vertical) ? row : column;
                 if (pos == m_timestamp)
-                    set->setTimestamp(m_model->data(index).toReal());
+                    set->setTimestamp(m_model->data(index, m_role).toReal());
                 else if (pos == m_open)
-                    set->setOpen(m_model->data(index).toReal());
+                    set->setOpen(m_model->data(index, m_role).toReal());
                 else if (pos == m_high)
-                    set->setHigh(m_model->data(index).toReal());
+                    set->setHigh(m_model->data(index, m_role).toReal());
                 else if (pos == m_low)
-                    set->setLow(m_model->data(index).toReal());
+                    set->setLow(m_model->data(index, m_role).toReal());
                 else if (pos == m_close)
-                    set->setClose(m_model->data(index).toReal());
+                    set->setClose(m_model->data(index, m_role).toReal());
             }
         }
     }
@@ -570,11 +603,11 @@ void QCandlestickModelMapperPrivate::candlestickSetsAdded(const QList<QCandlesti
 
     for (int i = 0; i < sets.count(); ++i) {
         int section = i + firstIndex + m_firstSetSection;
-        m_model->setData(candlestickModelIndex(section, m_timestamp), sets.at(i)->timestamp());
-        m_model->setData(candlestickModelIndex(section, m_open), sets.at(i)->open());
-        m_model->setData(candlestickModelIndex(section, m_high), sets.at(i)->high());
-        m_model->setData(candlestickModelIndex(section, m_low), sets.at(i)->low());
-        m_model->setData(candlestickModelIndex(section, m_close), sets.at(i)->close());
+        m_model->setData(candlestickModelIndex(section, m_timestamp), sets.at(i)->timestamp(), m_role);
+        m_model->setData(candlestickModelIndex(section, m_open), sets.at(i)->open(), m_role);
+        m_model->setData(candlestickModelIndex(section, m_high), sets.at(i)->high(), m_role);
+        m_model->setData(candlestickModelIndex(section, m_low), sets.at(i)->low(), m_role);
+        m_model->setData(candlestickModelIndex(section, m_close), sets.at(i)->close(), m_role);
     }
     blockModelSignals(false);
     initializeCandlestickFromModel();
@@ -624,11 +657,11 @@ void QCandlestickModelMapperPrivate::candlestickSetChanged()
     section += m_firstSetSection;
 
     blockModelSignals();
-    m_model->setData(candlestickModelIndex(section, m_timestamp), set->timestamp());
-    m_model->setData(candlestickModelIndex(section, m_open), set->open());
-    m_model->setData(candlestickModelIndex(section, m_high), set->high());
-    m_model->setData(candlestickModelIndex(section, m_low), set->low());
-    m_model->setData(candlestickModelIndex(section, m_close), set->close());
+    m_model->setData(candlestickModelIndex(section, m_timestamp), set->timestamp(), m_role);
+    m_model->setData(candlestickModelIndex(section, m_open), set->open(), m_role);
+    m_model->setData(candlestickModelIndex(section, m_high), set->high(), m_role);
+    m_model->setData(candlestickModelIndex(section, m_low), set->low(), m_role);
+    m_model->setData(candlestickModelIndex(section, m_close), set->close(), m_role);
     blockModelSignals(false);
 }
 
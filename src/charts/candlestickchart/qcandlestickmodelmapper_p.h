@@ -103,6 +103,7 @@ private:
     int m_close;
     int m_firstSetSection;
     int m_lastSetSection;
+    int m_role;
     QList<QCandlestickSet *> m_sets;
     bool m_modelSignalsBlock;
     bool m_seriesSignalsBlock;
@@ -33,6 +33,7 @@
 #include <QtCharts/QCandlestickSet>
 #include <QtCharts/QValueAxis>
 #include <QtCore/QDateTime>
+#include <QtCore/QtMath>
 #include <private/candlestickanimation_p.h>
 #include <private/candlestickchartitem_p.h>
 #include <private/chartdataset_p.h>
@@ -40,6 +41,7 @@
 #include <private/qcandlestickseries_p.h>
 #include <private/qcandlestickset_p.h>
 #include <private/qchart_p.h>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -59,6 +61,13 @@ QT_CHARTS_BEGIN_NAMESPACE
     drawn to the same category. When using QValueAxis or QDateTimeAxis, candlestick items sharing a
     timestamp will overlap each other.
 
+    The values of the candlestick items are stored by the series column by column. Large amounts
+    of data can be appended or replaced in bulk with the overloads of append() and replace() that
+    take the timestamp, open, high, low, and close columns. Candlestick items added in bulk are
+    not backed by a QCandlestickSet, so they are drawn with the pen and brush of the series and
+    do not emit the mouse signals. QCandlestickSet items added to the series mirror their values
+    into the columns and are best suited for small series.
+
     See the \l {Candlestick Chart Example} {candlestick chart example} to learn how to create
     a candlestick chart.
     \image examples_candlestickchart.png
@@ -275,6 +284,30 @@ QT_CHARTS_BEGIN_NAMESPACE
     \brief The pen used to draw the lines of the candlestick items.
 */
 
+/*!
+    \property QCandlestickSeries::aggregationWidth
+    \brief The minimum width of a candlestick period in pixels before neighboring candlesticks
+    are merged.
+
+    When the series is shown on a value or date-time axis and the shortest period between two
+    candlesticks is narrower than this width, the candlesticks are merged into periods of two,
+    four, eight, and so on times the shortest period until the merged period is at least this
+    wide. A merged candlestick takes the open value of its first candlestick, the highest high
+    value, the lowest low value, and the close value of its last candlestick. Merged
+    candlesticks are drawn with the pen and brush of the series and do not emit mouse signals.
+
+    The merged candlesticks are cached for each period, and candlesticks appended in time order
+    extend the cache instead of rebuilding it. Setting a negative value disables merging. All
+    negative values are converted to -1.0, which is the default.
+*/
+
+/*!
+    \qmlproperty real CandlestickSeries::aggregationWidth
+    The minimum width of a candlestick period in pixels before neighboring candlesticks are
+    merged. Setting a negative value disables merging. All negative values are converted
+    to -1.0, which is the default.
+*/
+
 /*!
     \qmlproperty string CandlestickSeries::brushFilename
     The name of the file used as a brush image for the series.
@@ -453,6 +486,13 @@ QT_CHARTS_BEGIN_NAMESPACE
     \sa pen
 */
 
+/*!
+    \fn void QCandlestickSeries::aggregationWidthChanged()
+    This signal is emitted when the aggregation width of the series changes.
+
+    \sa aggregationWidth
+*/
+
 /*!
     \qmlmethod CandlestickSeries::at(int index)
     Returns the candlestick item at the position specified by \a index. Returns
@@ -573,6 +613,8 @@ bool QCandlestickSeries::remove(const QList<QCandlestickSet *> &sets)
     position specified by \a index. Takes ownership of the item. If the
     item is null or already belongs to the series, it is not inserted.
     Returns \c true if inserting succeeded, \c false otherwise.
+    \note The position counts all candlestick items, including the ones that are not backed by
+    a QCandlestickSet.
 */
 bool QCandlestickSeries::insert(int index, QCandlestickSet *set)
 {
@@ -623,15 +665,114 @@ void QCandlestickSeries::clear()
 {
     Q_D(QCandlestickSeries);
 
-    QList<QCandlestickSet *> sets = this->sets();
+    if (d->m_timestamps.isEmpty())
+        return;
 
-    bool success = d->remove(sets);
-    if (success) {
+    QList<QCandlestickSet *> sets = this->sets();
+    d->replaceRows(QVector<qreal>(), QVector<qreal>(), QVector<qreal>(), QVector<qreal>(),
+                   QVector<qreal>());
+    if (!sets.isEmpty())
         emit candlestickSetsRemoved(sets);
+    emit countChanged();
+    foreach (QCandlestickSet *set, sets)
+        set->deleteLater();
+}
+
+/*!
+    Appends candlestick items with the values specified by \a timestamps, \a opens, \a highs,
+    \a lows, and \a closes to the series. The items are not backed by QCandlestickSet objects.
+    If the lists are not of the same length, nothing is appended.
+    Returns \c true if appending succeeded, \c false otherwise.
+*/
+bool QCandlestickSeries::append(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                                const QVector<qreal> &highs, const QVector<qreal> &lows,
+                                const QVector<qreal> &closes)
+{
+    Q_D(QCandlestickSeries);
+
+    bool success = d->appendRows(timestamps, opens, highs, lows, closes);
+    if (success && !timestamps.isEmpty())
         emit countChanged();
+
+    return success;
+}
+
+/*!
+    Replaces all candlestick items of the series with items that have the values specified by
+    \a timestamps, \a opens, \a highs, \a lows, and \a closes. Candlestick items added as
+    QCandlestickSet objects are removed from the series and permanently deleted. If the lists
+    are not of the same length, nothing is replaced.
+    Returns \c true if replacing succeeded, \c false otherwise.
+*/
+bool QCandlestickSeries::replace(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                                 const QVector<qreal> &highs, const QVector<qreal> &lows,
+                                 const QVector<qreal> &closes)
+{
+    Q_D(QCandlestickSeries);
+
+    const QList<QCandlestickSet *> sets = this->sets();
+    const int oldCount = count();
+    bool success = d->replaceRows(timestamps, opens, highs, lows, closes);
+    if (success) {
+        if (!sets.isEmpty())
+            emit candlestickSetsRemoved(sets);
+        if (count() != oldCount)
+            emit countChanged();
         foreach (QCandlestickSet *set, sets)
             set->deleteLater();
     }
+
+    return success;
+}
+
+/*!
+    Returns the timestamp of the candlestick item at the position specified by \a index.
+*/
+qreal QCandlestickSeries::timestampAt(int index) const
+{
+    Q_D(const QCandlestickSeries);
+
+    return d->m_timestamps.at(index);
+}
+
+/*!
+    Returns the open value of the candlestick item at the position specified by \a index.
+*/
+qreal QCandlestickSeries::openAt(int index) const
+{
+    Q_D(const QCandlestickSeries);
+
+    return d->m_opens.at(index);
+}
+
+/*!
+    Returns the high value of the candlestick item at the position specified by \a index.
+*/
+qreal QCandlestickSeries::highAt(int index) const
+{
+    Q_D(const QCandlestickSeries);
+
+    return d->m_highs.at(index);
+}
+
+/*!
+    Returns the low value of the candlestick item at the position specified by \a index.
+*/
+qreal QCandlestickSeries::lowAt(int index) const
+{
+    Q_D(const QCandlestickSeries);
+
+    return d->m_lows.at(index);
+}
+
+/*!
+    Returns the close value of the candlestick item at the position specified by \a index.
+*/
+qreal QCandlestickSeries::closeAt(int index) const
+{
+    Q_D(const QCandlestickSeries);
+
+    return d->m_closes.at(index);
 }
 
 /*!
@@ -646,11 +787,14 @@ QList<QCandlestickSet *> QCandlestickSeries::sets() const
 }
 
 /*!
-    Returns the number of the candlestick items in the series.
+    Returns the number of the candlestick items in the series, including the items that are not
+    backed by a QCandlestickSet.
 */
 int QCandlestickSeries::count() const
 {
-    return sets().count();
+    Q_D(const QCandlestickSeries);
+
+    return d->m_timestamps.count();
 }
 
 /*!
@@ -908,6 +1052,29 @@ QPen QCandlestickSeries::pen() const
     return d->m_pen;
 }
 
+void QCandlestickSeries::setAggregationWidth(qreal aggregationWidth)
+{
+    Q_D(QCandlestickSeries);
+
+    if (aggregationWidth < 0.0 && aggregationWidth != -1.0)
+        aggregationWidth = -1.0;
+
+    if (d->m_aggregationWidth == aggregationWidth)
+        return;
+
+    d->m_aggregationWidth = aggregationWidth;
+
+    emit d->updatedLayout();
+    emit aggregationWidthChanged();
+}
+
+qreal QCandlestickSeries::aggregationWidth() const
+{
+    Q_D(const QCandlestickSeries);
+
+    return d->m_aggregationWidth;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QCandlestickSeriesPrivate::QCandlestickSeriesPrivate(QCandlestickSeries *q)
@@ -924,7 +1091,8 @@ QCandlestickSeriesPrivate::QCandlestickSeriesPrivate(QCandlestickSeries *q)
       m_customDecreasingColor(false),
       m_brush(QChartPrivate::defaultBrush()),
       m_pen(QChartPrivate::defaultPen()),
-      m_animation(nullptr)
+      m_animation(nullptr),
+      m_aggregationWidth(-1.0)
 {
 }
 
@@ -940,20 +1108,19 @@ void QCandlestickSeriesPrivate::initializeDomain()
     qreal minY(domain()->minY());
     qreal maxY(domain()->maxY());
 
-    if (m_sets.count()) {
-        QCandlestickSet *set = m_sets.first();
-        minX = set->timestamp();
-        maxX = set->timestamp();
-        minY = set->low();
-        maxY = set->high();
-        for (int i = 1; i < m_sets.count(); ++i) {
-            set = m_sets.at(i);
-            minX = qMin(minX, qreal(set->timestamp()));
-            maxX = qMax(maxX, qreal(set->timestamp()));
-            minY = qMin(minY, set->low());
-            maxY = qMax(maxY, set->high());
+    const int count = m_timestamps.count();
+    if (count) {
+        minX = m_timestamps.first();
+        maxX = m_timestamps.first();
+        minY = m_lows.first();
+        maxY = m_highs.first();
+        for (int i = 1; i < count; ++i) {
+            minX = qMin(minX, m_timestamps.at(i));
+            maxX = qMax(maxX, m_timestamps.at(i));
+            minY = qMin(minY, m_lows.at(i));
+            maxY = qMax(maxY, m_highs.at(i));
         }
-        qreal extra = (maxX - minX) / m_sets.count() / 2;
+        qreal extra = (maxX - minX) / count / 2;
         minX = minX - extra;
         maxX = maxX + extra;
     }
@@ -1067,12 +1234,14 @@ bool QCandlestickSeriesPrivate::append(const QList<QCandlestickSet *> &sets)
             return false; // Also fail if the same set occurs more than once in the given list.
     }
 
+    const int index = m_timestamps.count();
     foreach (QCandlestickSet *set, sets) {
         m_sets.append(set);
-        connect(set->d_func(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
-        connect(set->d_func(), SIGNAL(updatedCandlestick()), this, SIGNAL(updatedCandlesticks()));
-        set->d_ptr->m_series = this;
+        insertRow(m_timestamps.count(), set);
+        attachSet(set);
     }
+    emit appendedCandlesticks(index, sets.count());
+    emit restructuredCandlesticks();
 
     return true;
 }
@@ -1090,11 +1259,19 @@ bool QCandlestickSeriesPrivate::remove(const QList<QCandlestickSet *> &sets)
     }
 
     foreach (QCandlestickSet *set, sets) {
-        set->d_ptr->m_series = nullptr;
+        const int row = m_rowSets.indexOf(set);
+        removeTimestamp(m_timestamps.at(row));
+        m_timestamps.remove(row);
+        m_opens.remove(row);
+        m_highs.remove(row);
+        m_lows.remove(row);
+        m_closes.remove(row);
+        m_rowSets.remove(row);
         m_sets.removeOne(set);
-        disconnect(set->d_func(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
-        disconnect(set->d_func(), SIGNAL(updatedCandlestick()),this, SIGNAL(updatedCandlesticks()));
+        detachSet(set);
     }
+    invalidateAggregations();
+    emit restructuredCandlesticks();
 
     return true;
 }
@@ -1104,12 +1281,271 @@ bool QCandlestickSeriesPrivate::insert(int index, QCandlestickSet *set)
     if ((m_sets.contains(set)) || (set == 0) || set->d_ptr->m_series)
         return false; // Fail if set is already in list or set is null.
 
-    m_sets.insert(index, set);
-    connect(set->d_func(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
+    // The index is a candlestick index, which only matches the set index when
+    // no candlesticks were appended in bulk
+    int setIndex = 0;
+    for (int row = 0; row < index; ++row) {
+        if (m_rowSets.at(row))
+            setIndex++;
+    }
+    m_sets.insert(setIndex, set);
+    insertRow(index, set);
+    attachSet(set);
+    if (index < m_timestamps.count() - 1)
+        invalidateAggregations();
+    emit restructuredCandlesticks();
+
+    return true;
+}
+
+bool QCandlestickSeriesPrivate::appendRows(const QVector<qreal> &timestamps,
+                                           const QVector<qreal> &opens,
+                                           const QVector<qreal> &highs,
+                                           const QVector<qreal> &lows,
+                                           const QVector<qreal> &closes)
+{
+    const int count = timestamps.count();
+    if (opens.count() != count || highs.count() != count || lows.count() != count
+            || closes.count() != count) {
+        return false;
+    }
+    if (count == 0)
+        return true;
+
+    foreach (qreal timestamp, timestamps)
+        addTimestamp(timestamp);
+    m_timestamps += timestamps;
+    m_opens += opens;
+    m_highs += highs;
+    m_lows += lows;
+    m_closes += closes;
+    m_rowSets.resize(m_timestamps.count());
+    emit appendedCandlesticks(m_timestamps.count() - count, count);
+    emit restructuredCandlesticks();
+
+    return true;
+}
+
+bool QCandlestickSeriesPrivate::replaceRows(const QVector<qreal> &timestamps,
+                                            const QVector<qreal> &opens,
+                                            const QVector<qreal> &highs,
+                                            const QVector<qreal> &lows,
+                                            const QVector<qreal> &closes)
+{
+    const int count = timestamps.count();
+    if (opens.count() != count || highs.count() != count || lows.count() != count
+            || closes.count() != count) {
+        return false;
+    }
+
+    foreach (QCandlestickSet *set, m_sets)
+        detachSet(set);
+    m_sets.clear();
+
+    // The columns share the data of the given vectors until either side is modified
+    m_timestamps = timestamps;
+    m_opens = opens;
+    m_highs = highs;
+    m_lows = lows;
+    m_closes = closes;
+    m_rowSets.fill(nullptr, count);
+    resetTimestamps();
+    invalidateAggregations();
+    emit restructuredCandlesticks();
+
+    return true;
+}
+
+void QCandlestickSeriesPrivate::attachSet(QCandlestickSet *set)
+{
+    connect(set->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleSetLayoutChange()));
     connect(set->d_func(), SIGNAL(updatedCandlestick()), this, SIGNAL(updatedCandlesticks()));
     set->d_ptr->m_series = this;
+}
 
-    return true;
+void QCandlestickSeriesPrivate::detachSet(QCandlestickSet *set)
+{
+    set->d_ptr->m_series = nullptr;
+    disconnect(set->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleSetLayoutChange()));
+    disconnect(set->d_func(), SIGNAL(updatedCandlestick()), this, SIGNAL(updatedCandlesticks()));
+}
+
+void QCandlestickSeriesPrivate::insertRow(int index, QCandlestickSet *set)
+{
+    addTimestamp(set->timestamp());
+    m_timestamps.insert(index, set->timestamp());
+    m_opens.insert(index, set->open());
+    m_highs.insert(index, set->high());
+    m_lows.insert(index, set->low());
+    m_closes.insert(index, set->close());
+    m_rowSets.insert(index, set);
+}
+
+qreal QCandlestickSeriesPrivate::minimumTimePeriod() const
+{
+    if (m_timestampGaps.isEmpty())
+        return 0.0;
+
+    return m_timestampGaps.firstKey();
+}
+
+void QCandlestickSeriesPrivate::addTimestamp(qreal timestamp)
+{
+    // Keeps the gaps between sorted neighbors up to date, duplicates are a gap of zero
+    QMap<qreal, int>::iterator it = m_sortedTimestamps.find(timestamp);
+    if (it != m_sortedTimestamps.end()) {
+        ++it.value();
+        ++m_timestampGaps[0.0];
+        return;
+    }
+
+    it = m_sortedTimestamps.insert(timestamp, 1);
+    const bool hasPrevious = (it != m_sortedTimestamps.begin());
+    const bool hasNext = (it + 1 != m_sortedTimestamps.end());
+    if (hasPrevious && hasNext)
+        removeGap((it + 1).key() - (it - 1).key());
+    if (hasPrevious)
+        ++m_timestampGaps[timestamp - (it - 1).key()];
+    if (hasNext)
+        ++m_timestampGaps[(it + 1).key() - timestamp];
+}
+
+void QCandlestickSeriesPrivate::removeTimestamp(qreal timestamp)
+{
+    QMap<qreal, int>::iterator it = m_sortedTimestamps.find(timestamp);
+    if (it == m_sortedTimestamps.end())
+        return;
+
+    if (it.value() > 1) {
+        --it.value();
+        removeGap(0.0);
+        return;
+    }
+
+    const bool hasPrevious = (it != m_sortedTimestamps.begin());
+    const bool hasNext = (it + 1 != m_sortedTimestamps.end());
+    if (hasPrevious)
+        removeGap(timestamp - (it - 1).key());
+    if (hasNext)
+        removeGap((it + 1).key() - timestamp);
+    if (hasPrevious && hasNext)
+        ++m_timestampGaps[(it + 1).key() - (it - 1).key()];
+    m_sortedTimestamps.erase(it);
+}
+
+void QCandlestickSeriesPrivate::removeGap(qreal gap)
+{
+    QMap<qreal, int>::iterator it = m_timestampGaps.find(gap);
+    if (it != m_timestampGaps.end() && --it.value() == 0)
+        m_timestampGaps.erase(it);
+}
+
+void QCandlestickSeriesPrivate::resetTimestamps()
+{
+    m_sortedTimestamps.clear();
+    m_timestampGaps.clear();
+
+    QVector<qreal> timestamps = m_timestamps;
+    std::sort(timestamps.begin(), timestamps.end());
+    for (int i = 0; i < timestamps.count(); ++i) {
+        if (i == 0 || timestamps.at(i) != timestamps.at(i - 1))
+            m_sortedTimestamps.insert(m_sortedTimestamps.cend(), timestamps.at(i), 1);
+        else
+            ++m_sortedTimestamps[timestamps.at(i)];
+        if (i > 0)
+            ++m_timestampGaps[timestamps.at(i) - timestamps.at(i - 1)];
+    }
+}
+
+void QCandlestickSeriesPrivate::invalidateAggregations()
+{
+    m_aggregations.clear();
+}
+
+void QCandlestickSeriesPrivate::aggregate(Aggregation &aggregation, int row) const
+{
+    const qreal timestamp = m_timestamps.at(row);
+    const int bucket = qFloor((timestamp - aggregation.origin) / aggregation.period);
+
+    if (!aggregation.candlesticks.isEmpty() && bucket == aggregation.lastBucket) {
+        CandlestickData &data = aggregation.candlesticks.last();
+        data.m_high = qMax(data.m_high, m_highs.at(row));
+        data.m_low = qMin(data.m_low, m_lows.at(row));
+        data.m_close = m_closes.at(row);
+    } else {
+        CandlestickData data;
+        data.m_timestamp = aggregation.origin + (bucket + 0.5) * aggregation.period;
+        data.m_open = m_opens.at(row);
+        data.m_high = m_highs.at(row);
+        data.m_low = m_lows.at(row);
+        data.m_close = m_closes.at(row);
+        aggregation.candlesticks.append(data);
+        aggregation.lastBucket = bucket;
+    }
+    aggregation.lastTimestamp = timestamp;
+}
+
+void QCandlestickSeriesPrivate::handleSetLayoutChange()
+{
+    QCandlestickSetPrivate *setPrivate = qobject_cast<QCandlestickSetPrivate *>(sender());
+    const int row = m_rowSets.indexOf(setPrivate->q_ptr);
+    if (row < 0)
+        return;
+
+    if (m_timestamps.at(row) != setPrivate->m_timestamp) {
+        removeTimestamp(m_timestamps.at(row));
+        addTimestamp(setPrivate->m_timestamp);
+    }
+    m_timestamps[row] = setPrivate->m_timestamp;
+    m_opens[row] = setPrivate->m_open;
+    m_highs[row] = setPrivate->m_high;
+    m_lows[row] = setPrivate->m_low;
+    m_closes[row] = setPrivate->m_close;
+    invalidateAggregations();
+    emit updatedLayout();
+}
+
+QVector<CandlestickData> QCandlestickSeriesPrivate::aggregatedCandlesticks(int level, qreal period)
+{
+    if (m_aggregations.count() <= level)
+        m_aggregations.resize(level + 1);
+
+    Aggregation &aggregation = m_aggregations[level];
+    const int count = m_timestamps.count();
+    const qreal aggregationPeriod = period * (1 << level);
+
+    bool rebuild = (aggregation.period != aggregationPeriod) || (aggregation.sourceCount > count);
+    // Appended candlesticks extend the cached ones as long as they come in time order
+    qreal lastTimestamp = aggregation.lastTimestamp;
+    for (int row = aggregation.sourceCount; row < count && !rebuild; ++row) {
+        if (m_timestamps.at(row) < lastTimestamp)
+            rebuild = true;
+        lastTimestamp = m_timestamps.at(row);
+    }
+
+    if (rebuild) {
+        aggregation = Aggregation();
+        aggregation.period = aggregationPeriod;
+
+        QVector<int> rows(count);
+        for (int row = 0; row < count; ++row)
+            rows[row] = row;
+        std::stable_sort(rows.begin(), rows.end(), [this](int left, int right) {
+            return m_timestamps.at(left) < m_timestamps.at(right);
+        });
+
+        // Align the merged periods so that the shortest period is centered on the timestamps
+        if (count > 0)
+            aggregation.origin = m_timestamps.at(rows.first()) - period / 2.0;
+        foreach (int row, rows)
+            aggregate(aggregation, row);
+    } else {
+        for (int row = aggregation.sourceCount; row < count; ++row)
+            aggregate(aggregation, row);
+    }
+    aggregation.sourceCount = count;
+
+    return aggregation.candlesticks;
 }
 
 void QCandlestickSeriesPrivate::handleSeriesChange(QAbstractSeries *series)
@@ -1130,7 +1566,7 @@ void QCandlestickSeriesPrivate::handleSeriesRemove(QAbstractSeries *series)
     QCandlestickSeries *removedSeries = static_cast<QCandlestickSeries *>(series);
 
     if (q == removedSeries && m_animation) {
-        m_animation->stopAll();
+        m_animation->stop();
         disconnect(m_chart->d_ptr->m_dataset, 0, removedSeries->d_func(), 0);
     }
 
@@ -1145,9 +1581,9 @@ void QCandlestickSeriesPrivate::populateBarCategories(QBarCategoryAxis *axis)
 {
     if (axis->categories().isEmpty()) {
         QStringList categories;
-        for (int i = 0; i < m_sets.count(); ++i) {
-            const qint64 timestamp = qRound64(m_sets.at(i)->timestamp());
-            const QString timestampFormat = m_chart->locale().dateTimeFormat(QLocale::ShortFormat);
+        const QString timestampFormat = m_chart->locale().dateTimeFormat(QLocale::ShortFormat);
+        for (int i = 0; i < m_timestamps.count(); ++i) {
+            const qint64 timestamp = qRound64(m_timestamps.at(i));
             categories << QDateTime::fromMSecsSinceEpoch(timestamp).toString(timestampFormat);
         }
         axis->append(categories);
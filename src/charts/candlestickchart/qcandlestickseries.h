@@ -51,6 +51,7 @@ class QT_CHARTS_EXPORT QCandlestickSeries : public QAbstractSeries
     Q_PROPERTY(QColor decreasingColor READ decreasingColor WRITE setDecreasingColor NOTIFY decreasingColorChanged)
     Q_PROPERTY(QBrush brush READ brush WRITE setBrush NOTIFY brushChanged)
     Q_PROPERTY(QPen pen READ pen WRITE setPen NOTIFY penChanged)
+    Q_PROPERTY(qreal aggregationWidth READ aggregationWidth WRITE setAggregationWidth NOTIFY aggregationWidthChanged)
 
 public:
     explicit QCandlestickSeries(QObject *parent = nullptr);
@@ -64,6 +65,18 @@ public:
     bool take(QCandlestickSet *set);
     void clear();
 
+    bool append(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                const QVector<qreal> &highs, const QVector<qreal> &lows,
+                const QVector<qreal> &closes);
+    bool replace(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                 const QVector<qreal> &highs, const QVector<qreal> &lows,
+                 const QVector<qreal> &closes);
+    qreal timestampAt(int index) const;
+    qreal openAt(int index) const;
+    qreal highAt(int index) const;
+    qreal lowAt(int index) const;
+    qreal closeAt(int index) const;
+
     QList<QCandlestickSet *> sets() const;
     int count() const;
 
@@ -99,6 +112,9 @@ public:
     void setPen(const QPen &pen);
     QPen pen() const;
 
+    void setAggregationWidth(qreal aggregationWidth);
+    qreal aggregationWidth() const;
+
 Q_SIGNALS:
     void clicked(QCandlestickSet *set);
     void hovered(bool status, QCandlestickSet *set);
@@ -118,12 +134,14 @@ Q_SIGNALS:
     void decreasingColorChanged();
     void brushChanged();
     void penChanged();
+    void aggregationWidthChanged();
 
 private:
     Q_DISABLE_COPY(QCandlestickSeries)
     Q_DECLARE_PRIVATE(QCandlestickSeries)
     friend class CandlestickChartItem;
     friend class QCandlestickLegendMarkerPrivate;
+    friend class QMovingAverageSeriesPrivate;
 };
 
 QT_CHARTS_END_NAMESPACE
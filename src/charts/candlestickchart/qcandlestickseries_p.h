@@ -39,8 +39,10 @@
 #ifndef QCANDLESTICKSERIES_P_H
 #define QCANDLESTICKSERIES_P_H
 
+#include <private/candlestickdata_p.h>
 #include <private/qabstractseries_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QMap>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -72,6 +74,15 @@ public:
     bool append(const QList<QCandlestickSet *> &sets);
     bool remove(const QList<QCandlestickSet *> &sets);
     bool insert(int index, QCandlestickSet *set);
+    bool appendRows(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                    const QVector<qreal> &highs, const QVector<qreal> &lows,
+                    const QVector<qreal> &closes);
+    bool replaceRows(const QVector<qreal> &timestamps, const QVector<qreal> &opens,
+                     const QVector<qreal> &highs, const QVector<qreal> &lows,
+                     const QVector<qreal> &closes);
+    QCandlestickSet *setAt(int index) const { return m_rowSets.at(index); }
+    QVector<CandlestickData> aggregatedCandlesticks(int level, qreal period);
+    qreal minimumTimePeriod() const;
 
 Q_SIGNALS:
     void clicked(int index, QCandlestickSet *set);
@@ -81,16 +92,49 @@ Q_SIGNALS:
     void updated();
     void updatedLayout();
     void updatedCandlesticks();
+    void restructuredCandlesticks();
+    void appendedCandlesticks(int index, int count);
 
 private Q_SLOTS:
+    void handleSetLayoutChange();
     void handleSeriesChange(QAbstractSeries *series);
     void handleSeriesRemove(QAbstractSeries *series);
 
 private:
     void populateBarCategories(QBarCategoryAxis *axis);
+    void attachSet(QCandlestickSet *set);
+    void detachSet(QCandlestickSet *set);
+    void insertRow(int index, QCandlestickSet *set);
+    void invalidateAggregations();
+    void addTimestamp(qreal timestamp);
+    void removeTimestamp(qreal timestamp);
+    void resetTimestamps();
+    void removeGap(qreal gap);
+
+    struct Aggregation {
+        Aggregation() : period(0.0), origin(0.0), sourceCount(0), lastBucket(0),
+            lastTimestamp(0.0) {}
+        qreal period;
+        qreal origin;
+        int sourceCount; // Rows already merged into the candlesticks
+        int lastBucket;
+        qreal lastTimestamp;
+        QVector<CandlestickData> candlesticks;
+    };
+    void aggregate(Aggregation &aggregation, int row) const;
 
 protected:
     QList<QCandlestickSet *> m_sets;
+    // Candlestick values are stored column by column, sets only mirror their own row
+    QVector<qreal> m_timestamps;
+    QVector<qreal> m_opens;
+    QVector<qreal> m_highs;
+    QVector<qreal> m_lows;
+    QVector<qreal> m_closes;
+    QVector<QCandlestickSet *> m_rowSets; // Null for candlesticks appended in bulk
+    // Sorted timestamps and the gaps between neighbors, both with their number of occurrences
+    QMap<qreal, int> m_sortedTimestamps;
+    QMap<qreal, int> m_timestampGaps;
     qreal m_maximumColumnWidth;
     qreal m_minimumColumnWidth;
     qreal m_bodyWidth;
@@ -104,9 +148,13 @@ protected:
     QBrush m_brush;
     QPen m_pen;
     CandlestickAnimation *m_animation;
+    qreal m_aggregationWidth;
+    // Candlesticks merged into periods of 2^level times the shortest period, by level
+    QVector<Aggregation> m_aggregations;
 
 private:
     Q_DECLARE_PUBLIC(QCandlestickSeries)
+    friend class CandlestickChartItem;
 };
 
 QT_CHARTS_END_NAMESPACE
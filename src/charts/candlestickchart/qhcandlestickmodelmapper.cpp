@@ -113,6 +113,12 @@ QT_CHARTS_BEGIN_NAMESPACE
     specified, the old series is disconnected (preserving its data).
 */
 
+/*!
+    \qmlproperty int HCandlestickModelMapper::dataRole
+    The item data role that is used to read and write the values of the sets.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \property QHCandlestickModelMapper::timestampColumn
     \brief The column of the model that contains the timestamp values of the
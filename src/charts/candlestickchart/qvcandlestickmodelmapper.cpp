@@ -113,6 +113,12 @@ QT_CHARTS_BEGIN_NAMESPACE
     specified, the old series is disconnected (but it preserves its data).
 */
 
+/*!
+    \qmlproperty int VCandlestickModelMapper::dataRole
+    The item data role that is used to read and write the values of the sets.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \property QVCandlestickModelMapper::timestampRow
     \brief The row of the model that contains the timestamp values of the
@@ -0,0 +1,89 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/chartlayercache_p.h>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QThread>
+#include <QtGui/QPainter>
+#include <QtGui/QPaintEngine>
+#include <QtGui/QPixmapCache>
+
+#ifndef QT_NO_GRAPHICSEFFECT
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// A chart has several layers, each cached in the global QPixmapCache. A layer larger than this
+// share of the cache would evict the others on every frame, so that each frame would pay for
+// offscreen renders on top of the blits.
+static const int layerCacheShare = 8;
+
+ChartLayerCache::ChartLayerCache(QObject *parent)
+    : QGraphicsEffect(parent)
+{
+}
+
+void ChartLayerCache::draw(QPainter *painter)
+{
+    // Vector targets such as printers and pictures get the layer drawn directly, and so
+    // do high dpi devices, which the device coordinate source pixmap would blur. Pixmaps
+    // can't be used outside the GUI thread either.
+    const QPaintEngine *engine = painter->paintEngine();
+    const bool rasterTarget = engine && (engine->type() == QPaintEngine::Raster
+                                         || engine->type() == QPaintEngine::OpenGL2);
+    if (!rasterTarget || painter->device()->devicePixelRatioF() != 1.0
+            || QThread::currentThread() != QCoreApplication::instance()->thread()) {
+        drawSource(painter);
+        return;
+    }
+
+    const QRect deviceRect = sourceBoundingRect(Qt::DeviceCoordinates).toAlignedRect();
+    const qint64 layerBytes = qint64(deviceRect.width()) * deviceRect.height() * 4;
+    if (layerBytes > qint64(QPixmapCache::cacheLimit()) * 1024 / layerCacheShare) {
+        drawSource(painter);
+        return;
+    }
+
+    // The effect source keeps the pixmap until the layer or its transform changes.
+    QPoint offset;
+    const QPixmap pixmap = sourcePixmap(Qt::DeviceCoordinates, &offset, QGraphicsEffect::NoPad);
+    if (pixmap.isNull())
+        return;
+
+    painter->save();
+    painter->setWorldTransform(QTransform());
+    painter->drawPixmap(offset, pixmap);
+    painter->restore();
+}
+
+#include "moc_chartlayercache_p.cpp"
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QT_NO_GRAPHICSEFFECT
@@ -27,6 +27,7 @@
 **
 ****************************************************************************/
 
+
 //  W A R N I N G
 //  -------------
 //
@@ -36,43 +37,30 @@
 //
 // We mean it.
 
-#ifndef CANDLESTICKBODYWICKSANIMATION_P_H
-#define CANDLESTICKBODYWICKSANIMATION_P_H
+#ifndef CHARTLAYERCACHE_P_H
+#define CHARTLAYERCACHE_P_H
 
-#include <private/candlestickdata_p.h>
-#include <private/chartanimation_p.h>
-#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCharts/QChartGlobal>
+#include <QtWidgets/QGraphicsEffect>
 
-QT_CHARTS_BEGIN_NAMESPACE
+#ifndef QT_NO_GRAPHICSEFFECT
 
-class Candlestick;
-class CandlestickAnimation;
+QT_CHARTS_BEGIN_NAMESPACE
 
-class QT_CHARTS_PRIVATE_EXPORT CandlestickBodyWicksAnimation : public ChartAnimation
+// Paints a layer of static chart elements, i.e. an item and its children, from a pixmap
+// that is only rendered again when something in the layer changes.
+class ChartLayerCache : public QGraphicsEffect
 {
     Q_OBJECT
-
 public:
-    CandlestickBodyWicksAnimation(Candlestick *candlestick, CandlestickAnimation *animation,
-                                  int duration, QEasingCurve &curve);
-    ~CandlestickBodyWicksAnimation();
-
-    void setup(const CandlestickData &startData, const CandlestickData &endData);
-    void setStartData(const CandlestickData &startData);
-    void setEndData(const CandlestickData &endData);
-
-    // from QVariantAnimation
-    virtual void updateCurrentValue(const QVariant &value);
-    virtual QVariant interpolated(const QVariant &from, const QVariant &to, qreal progress) const;
+    explicit ChartLayerCache(QObject *parent = 0);
 
 protected:
-    Candlestick *m_candlestick;
-    CandlestickAnimation *m_candlestickAnimation;
-    bool m_changeAnimation;
-
-    friend class CandlestickAnimation;
+    void draw(QPainter *painter);
 };
 
 QT_CHARTS_END_NAMESPACE
 
-#endif // CANDLESTICKBODYWICKSANIMATION_P_H
+#endif // QT_NO_GRAPHICSEFFECT
+
+#endif // CHARTLAYERCACHE_P_H
@@ -41,7 +41,9 @@
 #include <private/cartesianchartlayout_p.h>
 #include <private/polarchartlayout_p.h>
 #include <private/charttitle_p.h>
+#include <private/chartlayercache_p.h>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QThreadStorage>
 #include <QtCore/QTimer>
 #include <QtGui/QTextDocument>
 #include <QtWidgets/QGraphicsScene>
@@ -59,7 +61,8 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
       m_background(0),
       m_plotAreaBackground(0),
       m_title(0),
-      m_localizeNumbers(false)
+      m_localizeNumbers(false),
+      m_layerCaching(false)
 #ifndef QT_NO_OPENGL
       , m_glWidget(0)
       , m_glUseWidget(true)
@@ -107,6 +110,7 @@ void ChartPresenter::handleAxisAdded(QAbstractAxis *axis)
     ChartAxisElement *item = axis->d_ptr->axisItem();
     item->setPresenter(this);
     item->setThemeManager(m_chart->d_ptr->m_themeManager);
+    cacheAxisLayers(item);
     m_axisItems<<item;
     m_axes<<axis;
     m_layout->invalidate();
@@ -217,6 +221,7 @@ void ChartPresenter::createBackgroundItem()
         m_background->setPen(Qt::NoPen); // Theme doesn't touch pen so don't use default
         m_background->setBrush(QChartPrivate::defaultBrush());
         m_background->setZValue(ChartPresenter::BackgroundZValue);
+        cacheLayer(m_background);
     }
 }
 
@@ -233,6 +238,7 @@ void ChartPresenter::createPlotAreaBackgroundItem()
         m_plotAreaBackground->setBrush(Qt::NoBrush);
         m_plotAreaBackground->setZValue(ChartPresenter::PlotAreaZValue);
         m_plotAreaBackground->setVisible(false);
+        cacheLayer(m_plotAreaBackground);
     }
 }
 
@@ -241,6 +247,7 @@ void ChartPresenter::createTitleItem()
     if (!m_title) {
         m_title = new ChartTitle(rootItem());
         m_title->setZValue(ChartPresenter::BackgroundZValue);
+        cacheLayer(m_title);
     }
 }
 
@@ -393,6 +400,8 @@ void ChartPresenter::setBackgroundDropShadowEnabled(bool enabled)
 {
     createBackgroundItem();
     m_background->setDropShadowEnabled(enabled);
+    // The drop shadow replaces the layer cache of the background
+    cacheLayer(m_background);
 }
 
 bool ChartPresenter::isBackgroundDropShadowEnabled() const
@@ -454,18 +463,62 @@ ChartTitle *ChartPresenter::titleElement()
     return m_title;
 }
 
+void ChartPresenter::setLayerCachingEnabled(bool enabled)
+{
+    if (m_layerCaching == enabled)
+        return;
+    m_layerCaching = enabled;
+    cacheLayer(m_background);
+    cacheLayer(m_plotAreaBackground);
+    cacheLayer(m_title);
+    cacheLayer(m_chart->legend());
+    foreach (ChartAxisElement *item, m_axisItems)
+        cacheAxisLayers(item);
+}
+
+void ChartPresenter::cacheLayer(QGraphicsItem *item)
+{
+#ifdef QT_NO_GRAPHICSEFFECT
+    Q_UNUSED(item)
+#else
+    if (!item)
+        return;
+    // Static elements are composited from a cached pixmap under the series, so that
+    // series updates don't repaint them. Items with an effect of their own are left as is.
+    if (m_layerCaching) {
+        if (!item->graphicsEffect())
+            item->setGraphicsEffect(new ChartLayerCache());
+    } else if (qobject_cast<ChartLayerCache *>(item->graphicsEffect())) {
+        item->setGraphicsEffect(0);
+    }
+#endif
+}
+
+void ChartPresenter::cacheAxisLayers(ChartAxisElement *item)
+{
+    cacheLayer(item->gridGroup());
+    cacheLayer(item->minorGridGroup());
+    cacheLayer(item->shadeGroup());
+    cacheLayer(item->arrowGroup());
+    cacheLayer(item->minorArrowGroup());
+    cacheLayer(item->labelGroup());
+    cacheLayer(item->titleItem());
+}
+
 QRectF ChartPresenter::textBoundingRect(const QFont &font, const QString &text, qreal angle)
 {
-    static QGraphicsTextItem dummyTextItem;
-    static bool initMargin = true;
-    if (initMargin) {
-        dummyTextItem.document()->setDocumentMargin(textMargin());
-        initMargin = false;
+    // Each thread measures with its own item, so that charts can be laid out concurrently
+    static QThreadStorage<QGraphicsTextItem *> dummyTextItems;
+    if (!dummyTextItems.hasLocalData()) {
+        QGraphicsTextItem *item = new QGraphicsTextItem;
+        item->document()->setDocumentMargin(textMargin());
+        dummyTextItems.setLocalData(item);
     }
+    QGraphicsTextItem *dummyTextItem = dummyTextItems.localData();
 
-    dummyTextItem.setFont(font);
-    dummyTextItem.setHtml(text);
-    QRectF boundingRect = dummyTextItem.boundingRect();
+    dummyTextItem->setFont(font);
+    dummyTextItem->setHtml(text);
+    QRectF boundingRect = dummyTextItem->boundingRect();
 
     // Take rotation into account
     if (angle) {
@@ -110,6 +110,9 @@ public:
     QList<ChartItem *> chartItems() const;
 
     QLegend *legend();
+    void setLayerCachingEnabled(bool enabled);
+    bool isLayerCachingEnabled() const { return m_layerCaching; }
+    void cacheLayer(QGraphicsItem *item);
 
     void setBackgroundBrush(const QBrush &brush);
     QBrush backgroundBrush() const;
@@ -183,6 +186,7 @@ private:
     void createBackgroundItem();
     void createPlotAreaBackgroundItem();
     void createTitleItem();
+    void cacheAxisLayers(ChartAxisElement *item);
 
 public Q_SLOTS:
     void handleSeriesAdded(QAbstractSeries *series);
@@ -210,6 +214,7 @@ private:
     ChartTitle *m_title;
     QRectF m_rect;
     bool m_localizeNumbers;
+    bool m_layerCaching;
     QLocale m_locale;
 #ifndef QT_NO_OPENGL
     QPointer<GLWidget> m_glWidget;
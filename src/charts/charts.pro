@@ -25,7 +25,11 @@ SOURCES += \
     $$PWD/chartitem.cpp \
     $$PWD/scroller.cpp \
     $$PWD/charttitle.cpp \
-    $$PWD/qpolarchart.cpp
+    $$PWD/chartlayercache.cpp \
+    $$PWD/qpolarchart.cpp \
+    $$PWD/qchartmodelcolumns.cpp \
+    $$PWD/qchartrenderer.cpp \
+    $$PWD/qseriesloader.cpp
 
 contains(QT_CONFIG, opengl): SOURCES += $$PWD/glwidget.cpp
 
@@ -42,7 +46,10 @@ PRIVATE_HEADERS += \
     $$PWD/scroller_p.h \
     $$PWD/qabstractseries_p.h \
     $$PWD/charttitle_p.h \
+    $$PWD/chartlayercache_p.h \
     $$PWD/charthelpers_p.h \
+    $$PWD/qchartrenderer_p.h \
+    $$PWD/qseriesloader_p.h \
     $$PWD/qchartglobal_p.h
 
 contains(QT_CONFIG, opengl): PRIVATE_HEADERS += $$PWD/glwidget_p.h
@@ -53,7 +60,10 @@ PUBLIC_HEADERS += \
     $$PWD/qabstractseries.h \
     $$PWD/qchartview.h \
     $$PWD/chartsnamespace.h \
-    $$PWD/qpolarchart.h
+    $$PWD/qpolarchart.h \
+    $$PWD/qchartmodelcolumns.h \
+    $$PWD/qchartrenderer.h \
+    $$PWD/qseriesloader.h
 
 include($$PWD/animations/animations.pri)
 include($$PWD/areachart/areachart.pri)
@@ -47,7 +47,8 @@ AbstractDomain::AbstractDomain(QObject *parent)
       m_zoomResetMinY(0),
       m_zoomResetMaxY(0),
       m_reverseX(false),
-      m_reverseY(false)
+      m_reverseY(false),
+      m_translating(false)
 
 {
 }
@@ -94,6 +94,10 @@ public:
     void storeZoomReset();
     bool isZoomed() { return m_zoomed; }
 
+    // True while updated() is emitted for a pan that only shifted the geometry by translation().
+    bool isTranslating() const { return m_translating; }
+    QPointF translation() const { return m_translation; }
+
     friend bool Q_AUTOTEST_EXPORT operator== (const AbstractDomain &domain1, const AbstractDomain &domain2);
     friend bool Q_AUTOTEST_EXPORT operator!= (const AbstractDomain &domain1, const AbstractDomain &domain2);
     friend QDebug Q_AUTOTEST_EXPORT operator<<(QDebug dbg, const AbstractDomain &domain);
@@ -146,6 +150,8 @@ protected:
     qreal m_zoomResetMaxY;
     bool m_reverseX;
     bool m_reverseY;
+    bool m_translating;
+    QPointF m_translation;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -128,6 +128,10 @@ void XYDomain::zoomOut(const QRectF &rect)
 
 void XYDomain::move(qreal dx, qreal dy)
 {
+    // On a linear domain a pan moves every geometry point by the same pixel offset,
+    // regardless of axis reversal, so let the items shift their cached geometry.
+    m_translation = QPointF(-dx, dy);
+
     if (m_reverseX)
         dx = -dx;
     if (m_reverseY)
@@ -149,7 +153,9 @@ void XYDomain::move(qreal dx, qreal dy)
         minY = minY + y * dy;
         maxY = maxY + y * dy;
     }
+    m_translating = true;
     setRange(minX, maxX, minY, maxY);
+    m_translating = false;
 }
 
 QPointF XYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) const
@@ -2,11 +2,14 @@ INCLUDEPATH += $$PWD
 
 SOURCES += \
     $$PWD/linechartitem.cpp \
-    $$PWD/qlineseries.cpp 
+    $$PWD/qlineseries.cpp \
+    $$PWD/qmovingaverageseries.cpp
     
 PRIVATE_HEADERS += \
     $$PWD/linechartitem_p.h \
-    $$PWD/qlineseries_p.h
+    $$PWD/qlineseries_p.h \
+    $$PWD/qmovingaverageseries_p.h
     
 PUBLIC_HEADERS += \    
-    $$PWD/qlineseries.h  
\ No newline at end of file
+    $$PWD/qlineseries.h \
+    $$PWD/qmovingaverageseries.h
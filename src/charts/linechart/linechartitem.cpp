@@ -336,6 +336,26 @@ void LineChartItem::updateGeometry()
     }
 }
 
+void LineChartItem::translateChart(const QPointF &offset)
+{
+    // Animated panning still interpolates the points, everything else just moves
+    // the already stroked paths instead of rebuilding them.
+    if (m_animation) {
+        XYChart::translateChart(offset);
+        return;
+    }
+
+    for (int i = 0; i < m_points.size(); ++i)
+        m_points[i] += offset;
+    m_linePoints = m_points;
+
+    prepareGeometryChange();
+    m_linePath.translate(offset);
+    m_fullPath.translate(offset);
+    m_shapePath.translate(offset);
+    m_rect.translate(offset);
+}
+
 void LineChartItem::handleUpdated()
 {
     // If points visibility has changed, a geometry update is needed.
@@ -70,6 +70,7 @@ public Q_SLOTS:
 
 protected:
     void updateGeometry();
+    void translateChart(const QPointF &offset);
     void mousePressEvent(QGraphicsSceneMouseEvent *event);
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
     void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
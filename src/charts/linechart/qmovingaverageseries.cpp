@@ -0,0 +1,449 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QMovingAverageSeries>
+#include <QtCharts/QCandlestickSeries>
+#include <private/qmovingaverageseries_p.h>
+#include <private/qcandlestickseries_p.h>
+#include <QtCore/QtMath>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QMovingAverageSeries
+    \inmodule QtCharts
+    \brief The QMovingAverageSeries class presents windowed statistics of another series
+    as a line chart.
+
+    The series follows a source series and draws the mean of the last \l windowSize values
+    of the source at the x value of the newest one. The first point is drawn once the source
+    has enough values to fill a window. The source can be any QXYSeries, such as a
+    QLineSeries or QScatterSeries, or a QCandlestickSeries, whose close values and
+    timestamps are used.
+
+    The \l deviations and \l envelope properties move the line away from the mean, so that
+    bands can be drawn as two moving average series of the same source. For Bollinger bands,
+    set the deviations to 2 and -2. For a 5% envelope, set the envelope to 0.05 and -0.05.
+    The two series can also be used as the boundaries of a QAreaSeries.
+
+    The statistics are updated incrementally: appending a value to the source, or removing
+    values from its beginning, costs constant time regardless of the length of the series.
+    Replacing a value updates the points of the windows containing it. Other changes to the
+    source calculate all the points again.
+
+    The points of the series are owned by the series and should not be modified directly.
+
+    \sa QLineSeries
+*/
+
+/*!
+    \property QMovingAverageSeries::source
+    \brief The series whose values are averaged.
+
+    Only XY series and candlestick series are supported. The default value is null.
+*/
+
+/*!
+    \property QMovingAverageSeries::windowSize
+    \brief The number of source values in each average.
+
+    The value is at least 1. The default value is 20.
+*/
+
+/*!
+    \property QMovingAverageSeries::deviations
+    \brief The number of standard deviations of the window values added to the mean.
+
+    Negative values move the line below the mean. The default value is 0.
+*/
+
+/*!
+    \property QMovingAverageSeries::envelope
+    \brief The ratio of the mean added to the mean.
+
+    For example, a value of 0.05 draws the line 5% above the mean. The default value is 0.
+*/
+
+/*!
+    \fn void QMovingAverageSeries::sourceChanged(QAbstractSeries *source)
+    This signal is emitted when the source series changes to \a source.
+*/
+
+/*!
+    \fn void QMovingAverageSeries::windowSizeChanged(int windowSize)
+    This signal is emitted when the window size changes to \a windowSize.
+*/
+
+/*!
+    \fn void QMovingAverageSeries::deviationsChanged(qreal deviations)
+    This signal is emitted when the number of standard deviations changes to \a deviations.
+*/
+
+/*!
+    \fn void QMovingAverageSeries::envelopeChanged(qreal envelope)
+    This signal is emitted when the envelope ratio changes to \a envelope.
+*/
+
+/*!
+    Constructs an empty moving average series that is a QObject and a child of \a parent.
+*/
+QMovingAverageSeries::QMovingAverageSeries(QObject *parent)
+    : QLineSeries(*new QMovingAverageSeriesPrivate(this), parent)
+{
+}
+
+/*!
+    Constructs a moving average series of \a source with the window size \a windowSize.
+    The series is a QObject and a child of \a parent.
+*/
+QMovingAverageSeries::QMovingAverageSeries(QAbstractSeries *source, int windowSize,
+                                           QObject *parent)
+    : QLineSeries(*new QMovingAverageSeriesPrivate(this), parent)
+{
+    Q_D(QMovingAverageSeries);
+    d->m_windowSize = qMax(windowSize, 1);
+    setSource(source);
+}
+
+/*!
+    Destroys the moving average series.
+*/
+QMovingAverageSeries::~QMovingAverageSeries()
+{
+}
+
+void QMovingAverageSeries::setSource(QAbstractSeries *source)
+{
+    Q_D(QMovingAverageSeries);
+    if (d->m_source == source)
+        return;
+
+    d->detachSource();
+    d->attachSource(source);
+    d->recalculate();
+    emit sourceChanged(source);
+}
+
+QAbstractSeries *QMovingAverageSeries::source() const
+{
+    Q_D(const QMovingAverageSeries);
+    return d->m_source;
+}
+
+void QMovingAverageSeries::setWindowSize(int windowSize)
+{
+    Q_D(QMovingAverageSeries);
+    windowSize = qMax(windowSize, 1);
+    if (d->m_windowSize == windowSize)
+        return;
+
+    d->m_windowSize = windowSize;
+    d->recalculate();
+    emit windowSizeChanged(windowSize);
+}
+
+int QMovingAverageSeries::windowSize() const
+{
+    Q_D(const QMovingAverageSeries);
+    return d->m_windowSize;
+}
+
+void QMovingAverageSeries::setDeviations(qreal deviations)
+{
+    Q_D(QMovingAverageSeries);
+    if (d->m_deviations == deviations)
+        return;
+
+    d->m_deviations = deviations;
+    d->recalculate();
+    emit deviationsChanged(deviations);
+}
+
+qreal QMovingAverageSeries::deviations() const
+{
+    Q_D(const QMovingAverageSeries);
+    return d->m_deviations;
+}
+
+void QMovingAverageSeries::setEnvelope(qreal envelope)
+{
+    Q_D(QMovingAverageSeries);
+    if (d->m_envelope == envelope)
+        return;
+
+    d->m_envelope = envelope;
+    d->recalculate();
+    emit envelopeChanged(envelope);
+}
+
+qreal QMovingAverageSeries::envelope() const
+{
+    Q_D(const QMovingAverageSeries);
+    return d->m_envelope;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+QMovingAverageSeriesPrivate::QMovingAverageSeriesPrivate(QMovingAverageSeries *q)
+    : QLineSeriesPrivate(q),
+      m_xySource(nullptr),
+      m_candlestickSource(nullptr),
+      m_windowSize(20),
+      m_deviations(0.0),
+      m_envelope(0.0),
+      m_processedCount(0),
+      m_shift(0.0),
+      m_sum(0.0),
+      m_sumOfSquares(0.0),
+      m_candlesticksAppended(false)
+{
+}
+
+void QMovingAverageSeriesPrivate::attachSource(QAbstractSeries *source)
+{
+    m_source = source;
+    m_xySource = qobject_cast<QXYSeries *>(source);
+    m_candlestickSource = qobject_cast<QCandlestickSeries *>(source);
+
+    if (m_xySource) {
+        connect(m_xySource, SIGNAL(pointAdded(int)), this, SLOT(handleSourcePointAdded(int)));
+        connect(m_xySource, SIGNAL(pointReplaced(int)), this, SLOT(handleSourcePointReplaced(int)));
+        connect(m_xySource, SIGNAL(pointRemoved(int)), this, SLOT(handleSourcePointRemoved(int)));
+        connect(m_xySource, SIGNAL(pointsRemoved(int,int)),
+                this, SLOT(handleSourcePointsRemoved(int,int)));
+        connect(m_xySource, SIGNAL(pointsReplaced()), this, SLOT(recalculate()));
+    } else if (m_candlestickSource) {
+        QCandlestickSeriesPrivate *d = m_candlestickSource->d_func();
+        connect(d, SIGNAL(appendedCandlesticks(int,int)),
+                this, SLOT(handleCandlesticksAppended(int,int)));
+        connect(d, SIGNAL(restructuredCandlesticks()), this, SLOT(handleCandlesticksRestructured()));
+        connect(d, SIGNAL(updatedLayout()), this, SLOT(recalculate()));
+    } else if (source) {
+        qWarning("QMovingAverageSeries: Unsupported source series type");
+    }
+    if (source)
+        connect(source, SIGNAL(destroyed()), this, SLOT(handleSourceDestroyed()));
+}
+
+void QMovingAverageSeriesPrivate::detachSource()
+{
+    if (m_xySource)
+        m_xySource->disconnect(this);
+    if (m_candlestickSource)
+        m_candlestickSource->d_func()->disconnect(this);
+    if (m_source)
+        m_source->disconnect(this);
+    m_source = nullptr;
+    m_xySource = nullptr;
+    m_candlestickSource = nullptr;
+}
+
+int QMovingAverageSeriesPrivate::sourceCount() const
+{
+    if (!m_source)
+        return 0;
+    if (m_xySource)
+        return m_xySource->count();
+    if (m_candlestickSource)
+        return m_candlestickSource->count();
+    return 0;
+}
+
+QPointF QMovingAverageSeriesPrivate::sourcePoint(int index) const
+{
+    if (m_xySource)
+        return m_xySource->at(index);
+    return QPointF(m_candlestickSource->timestampAt(index), m_candlestickSource->closeAt(index));
+}
+
+QPointF QMovingAverageSeriesPrivate::statisticPoint(int index, qreal sum,
+                                                    qreal sumOfSquares) const
+{
+    const qreal mean = sum / m_windowSize;
+    const qreal variance = qMax(sumOfSquares / m_windowSize - mean * mean, qreal(0.0));
+    const qreal y = (mean + m_shift) * (1.0 + m_envelope) + m_deviations * qSqrt(variance);
+    return QPointF(sourcePoint(index).x(), y);
+}
+
+bool QMovingAverageSeriesPrivate::addSourcePoint(QPointF *point)
+{
+    const int index = m_processedCount++;
+    if (index == 0)
+        m_shift = sourcePoint(0).y();
+
+    const qreal value = sourceValue(index);
+    m_sum += value;
+    m_sumOfSquares += value * value;
+    if (index >= m_windowSize) {
+        const qreal oldValue = sourceValue(index - m_windowSize);
+        m_sum -= oldValue;
+        m_sumOfSquares -= oldValue * oldValue;
+    }
+
+    if (m_processedCount < m_windowSize)
+        return false;
+    *point = statisticPoint(index, m_sum, m_sumOfSquares);
+    return true;
+}
+
+void QMovingAverageSeriesPrivate::recalculate()
+{
+    Q_Q(QMovingAverageSeries);
+
+    m_processedCount = 0;
+    m_shift = 0.0;
+    m_sum = 0.0;
+    m_sumOfSquares = 0.0;
+
+    const int count = sourceCount();
+    QVector<QPointF> points;
+    points.reserve(qMax(count - m_windowSize + 1, 0));
+    QPointF point;
+    for (int i = 0; i < count; i++) {
+        if (addSourcePoint(&point))
+            points.append(point);
+    }
+    q->replace(points);
+}
+
+void QMovingAverageSeriesPrivate::handleSourcePointAdded(int index)
+{
+    Q_Q(QMovingAverageSeries);
+
+    if (index != m_processedCount || index != sourceCount() - 1) {
+        recalculate();
+        return;
+    }
+
+    QPointF point;
+    if (addSourcePoint(&point))
+        q->append(point);
+}
+
+void QMovingAverageSeriesPrivate::handleSourcePointReplaced(int index)
+{
+    Q_Q(QMovingAverageSeries);
+
+    if (index >= m_processedCount || m_processedCount < m_windowSize) {
+        recalculate();
+        return;
+    }
+
+    // Only the windows containing the value change
+    const int first = qMax(index, m_windowSize - 1);
+    const int last = qMin(index + m_windowSize - 1, m_processedCount - 1);
+    qreal sum = 0.0;
+    qreal sumOfSquares = 0.0;
+    for (int i = first - m_windowSize + 1; i <= first; i++) {
+        const qreal value = sourceValue(i);
+        sum += value;
+        sumOfSquares += value * value;
+    }
+    for (int i = first; i <= last; i++) {
+        if (i > first) {
+            const qreal value = sourceValue(i);
+            const qreal oldValue = sourceValue(i - m_windowSize);
+            sum += value - oldValue;
+            sumOfSquares += value * value - oldValue * oldValue;
+        }
+        q->replace(i - m_windowSize + 1, statisticPoint(i, sum, sumOfSquares));
+    }
+
+    if (last == m_processedCount - 1) {
+        m_sum = sum;
+        m_sumOfSquares = sumOfSquares;
+    }
+}
+
+void QMovingAverageSeriesPrivate::handleSourcePointRemoved(int index)
+{
+    handleSourcePointsRemoved(index, 1);
+}
+
+void QMovingAverageSeriesPrivate::handleSourcePointsRemoved(int index, int count)
+{
+    Q_Q(QMovingAverageSeries);
+
+    // Scrolling a stream drops values from the front, which only drops the oldest points
+    if (index != 0 || m_processedCount - count < m_windowSize
+            || m_processedCount - count != sourceCount()) {
+        recalculate();
+        return;
+    }
+
+    q->removePoints(0, count);
+    m_processedCount -= count;
+}
+
+void QMovingAverageSeriesPrivate::handleCandlesticksAppended(int index, int count)
+{
+    Q_Q(QMovingAverageSeries);
+
+    // The candlestick series announces every append with a restructure right after it
+    m_candlesticksAppended = true;
+    if (index != m_processedCount) {
+        recalculate();
+        return;
+    }
+
+    QList<QPointF> points;
+    QPointF point;
+    for (int i = 0; i < count; i++) {
+        if (addSourcePoint(&point))
+            points.append(point);
+    }
+    if (!points.isEmpty())
+        q->append(points);
+}
+
+void QMovingAverageSeriesPrivate::handleSourceDestroyed()
+{
+    Q_Q(QMovingAverageSeries);
+
+    m_source = nullptr;
+    m_xySource = nullptr;
+    m_candlestickSource = nullptr;
+    recalculate();
+    emit q->sourceChanged(nullptr);
+}
+
+void QMovingAverageSeriesPrivate::handleCandlesticksRestructured()
+{
+    // Only the tail of an append that was just processed leaves the averages valid, any other
+    // restructure, such as replacing the columns with as many rows, may have changed the values
+    const bool appended = m_candlesticksAppended;
+    m_candlesticksAppended = false;
+    if (!appended || m_processedCount != sourceCount())
+        recalculate();
+}
+
+#include "moc_qmovingaverageseries.cpp"
+#include "moc_qmovingaverageseries_p.cpp"
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,79 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QMOVINGAVERAGESERIES_H
+#define QMOVINGAVERAGESERIES_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/QLineSeries>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QMovingAverageSeriesPrivate;
+
+class QT_CHARTS_EXPORT QMovingAverageSeries : public QLineSeries
+{
+    Q_OBJECT
+    Q_PROPERTY(QAbstractSeries *source READ source WRITE setSource NOTIFY sourceChanged)
+    Q_PROPERTY(int windowSize READ windowSize WRITE setWindowSize NOTIFY windowSizeChanged)
+    Q_PROPERTY(qreal deviations READ deviations WRITE setDeviations NOTIFY deviationsChanged)
+    Q_PROPERTY(qreal envelope READ envelope WRITE setEnvelope NOTIFY envelopeChanged)
+
+public:
+    explicit QMovingAverageSeries(QObject *parent = nullptr);
+    explicit QMovingAverageSeries(QAbstractSeries *source, int windowSize = 20,
+                                  QObject *parent = nullptr);
+    ~QMovingAverageSeries();
+
+    void setSource(QAbstractSeries *source);
+    QAbstractSeries *source() const;
+
+    void setWindowSize(int windowSize);
+    int windowSize() const;
+
+    void setDeviations(qreal deviations);
+    qreal deviations() const;
+
+    void setEnvelope(qreal envelope);
+    qreal envelope() const;
+
+Q_SIGNALS:
+    void sourceChanged(QAbstractSeries *source);
+    void windowSizeChanged(int windowSize);
+    void deviationsChanged(qreal deviations);
+    void envelopeChanged(qreal envelope);
+
+private:
+    Q_DECLARE_PRIVATE(QMovingAverageSeries)
+    Q_DISABLE_COPY(QMovingAverageSeries)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QMOVINGAVERAGESERIES_H
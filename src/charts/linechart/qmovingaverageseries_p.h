@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+
+#ifndef QMOVINGAVERAGESERIES_P_H
+#define QMOVINGAVERAGESERIES_P_H
+
+#include <private/qlineseries_p.h>
+#include <QtCharts/QMovingAverageSeries>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QPointer>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QCandlestickSeries;
+
+class QT_CHARTS_PRIVATE_EXPORT QMovingAverageSeriesPrivate : public QLineSeriesPrivate
+{
+    Q_OBJECT
+
+public:
+    QMovingAverageSeriesPrivate(QMovingAverageSeries *q);
+
+    void attachSource(QAbstractSeries *source);
+    void detachSource();
+    int sourceCount() const;
+    QPointF sourcePoint(int index) const;
+    qreal sourceValue(int index) const { return sourcePoint(index).y() - m_shift; }
+    QPointF statisticPoint(int index, qreal sum, qreal sumOfSquares) const;
+    bool addSourcePoint(QPointF *point);
+
+public Q_SLOTS:
+    void recalculate();
+
+private Q_SLOTS:
+    void handleSourcePointAdded(int index);
+    void handleSourcePointReplaced(int index);
+    void handleSourcePointRemoved(int index);
+    void handleSourcePointsRemoved(int index, int count);
+    void handleCandlesticksAppended(int index, int count);
+    void handleCandlesticksRestructured();
+    void handleSourceDestroyed();
+
+protected:
+    QPointer<QAbstractSeries> m_source;
+    QXYSeries *m_xySource; // Null unless the source is an XY series
+    QCandlestickSeries *m_candlestickSource; // Null unless the source is a candlestick series
+    int m_windowSize;
+    qreal m_deviations;
+    qreal m_envelope;
+    // Running sums over the window ending at the last processed source point. The values are
+    // shifted by the first source value to keep the sum of squares precise.
+    int m_processedCount;
+    qreal m_shift;
+    qreal m_sum;
+    qreal m_sumOfSquares;
+    // Set while the restructure that follows an append of candlesticks is pending
+    bool m_candlesticksAppended;
+
+private:
+    Q_DECLARE_PUBLIC(QMovingAverageSeries)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QMOVINGAVERAGESERIES_P_H
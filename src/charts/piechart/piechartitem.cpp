@@ -44,6 +44,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 PieChartItem::PieChartItem(QPieSeries *series, QGraphicsItem* item)
     : ChartItem(series->d_func(),item),
       m_series(series),
+      m_otherSliceItem(0),
       m_animation(0)
 {
     Q_ASSERT(series);
@@ -57,6 +58,7 @@ PieChartItem::PieChartItem(QPieSeries *series, QGraphicsItem* item)
     connect(p, SIGNAL(verticalPositionChanged()), this, SLOT(updateLayout()));
     connect(p, SIGNAL(pieSizeChanged()), this, SLOT(updateLayout()));
     connect(p, SIGNAL(calculatedDataChanged()), this, SLOT(updateLayout()));
+    connect(p, SIGNAL(otherSliceChanged()), this, SLOT(updateLayout()));
 
     // Note: the following does not affect as long as the item does not have anything to paint
     setZValue(ChartPresenter::PieSeriesZValue);
@@ -121,6 +123,7 @@ void PieChartItem::cleanup()
         QPieSlicePrivate::fromSlice(slice)->disconnect(this);
     }
     m_sliceItems.clear();
+    m_otherSliceItem = 0;
 }
 
 void PieChartItem::handleDomainUpdated()
@@ -152,16 +155,80 @@ void PieChartItem::updateLayout()
     m_pieRadius *= m_series->pieSize();
     m_holeSize *= m_series->holeSize();
 
+    const QList<QPieSlice *> slices = m_series->slices();
+
+    // Slices spanning less than the threshold are drawn as one slice after the others
+    const qreal threshold = m_series->otherSliceThreshold();
+    QVector<bool> grouped;
+    int groupedCount = 0;
+    if (threshold > 0) {
+        grouped.fill(false, slices.count());
+        for (int i = 0; i < slices.count(); i++) {
+            if (qAbs(slices.at(i)->angleSpan()) < threshold) {
+                grouped[i] = true;
+                groupedCount++;
+            }
+        }
+        if (groupedCount < 2)
+            grouped.clear();
+    }
+
     // set layouts for existing slice items
-    foreach (QPieSlice *slice, m_series->slices()) {
+    qreal startAngle = m_series->pieStartAngle();
+    PieSliceData otherSliceData;
+    bool otherSliceStarted = false;
+    for (int i = 0; i < slices.count(); i++) {
+        QPieSlice *slice = slices.at(i);
         PieSliceItem *sliceItem = m_sliceItems.value(slice);
+        if (!grouped.isEmpty() && grouped.at(i)) {
+            if (!otherSliceStarted) {
+                // The grouped slice looks like the first slice in it
+                otherSliceData = QPieSlicePrivate::fromSlice(slice)->m_data;
+                otherSliceData.m_value = 0;
+                otherSliceData.m_percentage = 0;
+                otherSliceData.m_angleSpan = 0;
+                otherSliceStarted = true;
+            }
+            otherSliceData.m_value += slice->value();
+            otherSliceData.m_percentage += slice->percentage();
+            otherSliceData.m_angleSpan += slice->angleSpan();
+            if (sliceItem)
+                sliceItem->setVisible(false);
+            continue;
+        }
         if (sliceItem) {
             PieSliceData sliceData = updateSliceGeometry(slice);
-            if (m_animation)
-                presenter()->startAnimation(m_animation->updateValue(sliceItem, sliceData));
-            else
-                sliceItem->setLayout(sliceData);
+            if (!grouped.isEmpty()) {
+                sliceData.m_startAngle = startAngle;
+                sliceData.m_center = PieSliceItem::sliceCenter(m_pieCenter, m_pieRadius, sliceData);
+            }
+            sliceItem->setVisible(true);
+            setSliceLayout(sliceItem, sliceData);
+        }
+        startAngle += slice->angleSpan();
+    }
+
+    if (!grouped.isEmpty() && !m_sliceItems.isEmpty()) {
+        otherSliceData.m_labelText = m_series->otherSliceLabel();
+        otherSliceData.m_isExploded = false;
+        otherSliceData.m_startAngle = startAngle;
+        otherSliceData.m_center = m_pieCenter;
+        otherSliceData.m_radius = m_pieRadius;
+        otherSliceData.m_holeRadius = m_holeSize;
+        if (!m_otherSliceItem) {
+            m_otherSliceItem = new PieSliceItem(this);
+            if (m_animation) {
+                presenter()->startAnimation(m_animation->addSlice(m_otherSliceItem, otherSliceData,
+                                                                  false));
+            } else {
+                m_otherSliceItem->setLayout(otherSliceData);
+            }
+        } else {
+            m_otherSliceItem->setVisible(true);
+            setSliceLayout(m_otherSliceItem, otherSliceData);
         }
+    } else if (m_otherSliceItem) {
+        m_otherSliceItem->setVisible(false);
     }
 
     update();
@@ -208,6 +275,10 @@ void PieChartItem::handleSlicesAdded(QList<QPieSlice *> slices)
         else
             sliceItem->setLayout(sliceData);
     }
+
+    // The new slices may change which slices are grouped
+    if (m_series->otherSliceThreshold() > 0)
+        updateLayout();
 }
 
 void PieChartItem::handleSlicesRemoved(QList<QPieSlice *> slices)
@@ -231,6 +302,9 @@ void PieChartItem::handleSlicesRemoved(QList<QPieSlice *> slices)
         else
             delete sliceItem;
     }
+
+    if (m_series->otherSliceThreshold() > 0)
+        updateLayout();
 }
 
 void PieChartItem::handleSliceChanged()
@@ -242,12 +316,14 @@ void PieChartItem::handleSliceChanged()
     }
     Q_ASSERT(m_sliceItems.contains(slice));
 
+    // Grouped slices move the start angles of the slices drawn after them
+    if (isOtherSliceShown()) {
+        updateLayout();
+        return;
+    }
+
     PieSliceItem *sliceItem = m_sliceItems.value(slice);
-    PieSliceData sliceData = updateSliceGeometry(slice);
-    if (m_animation)
-        presenter()->startAnimation(m_animation->updateValue(sliceItem, sliceData));
-    else
-        sliceItem->setLayout(sliceData);
+    setSliceLayout(sliceItem, updateSliceGeometry(slice));
 
     update();
 }
@@ -265,12 +341,29 @@ void PieChartItem::handleOpacityChanged()
 PieSliceData PieChartItem::updateSliceGeometry(QPieSlice *slice)
 {
     PieSliceData &sliceData = QPieSlicePrivate::fromSlice(slice)->m_data;
-    sliceData.m_center = PieSliceItem::sliceCenter(m_pieCenter, m_pieRadius, slice);
+    sliceData.m_center = PieSliceItem::sliceCenter(m_pieCenter, m_pieRadius, sliceData);
     sliceData.m_radius = m_pieRadius;
     sliceData.m_holeRadius = m_holeSize;
     return sliceData;
 }
 
+void PieChartItem::setSliceLayout(PieSliceItem *sliceItem, const PieSliceData &sliceData)
+{
+    // Laying out a slice measures its label, so skip the slices that did not change
+    if (!(sliceItem->layout() != sliceData))
+        return;
+
+    if (m_animation)
+        presenter()->startAnimation(m_animation->updateValue(sliceItem, sliceData));
+    else
+        sliceItem->setLayout(sliceData);
+}
+
+bool PieChartItem::isOtherSliceShown() const
+{
+    return m_otherSliceItem && m_otherSliceItem->isVisible();
+}
+
 #include "moc_piechartitem_p.cpp"
 
 QT_CHARTS_END_NAMESPACE
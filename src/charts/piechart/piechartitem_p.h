@@ -91,9 +91,12 @@ public Q_SLOTS:
     void cleanup();
 private:
     PieSliceData updateSliceGeometry(QPieSlice *slice);
+    void setSliceLayout(PieSliceItem *sliceItem, const PieSliceData &sliceData);
+    bool isOtherSliceShown() const;
 
 private:
     QHash<QPieSlice *, PieSliceItem *> m_sliceItems;
+    PieSliceItem *m_otherSliceItem; // Draws the slices below the threshold as one slice
     QPointer<QPieSeries> m_series;
     QRectF m_rect;
     QPointF m_pieCenter;
@@ -115,7 +115,8 @@ public:
             m_center != other.m_center ||
             !qFuzzyIsNull(m_radius - other.m_radius) ||
             !qFuzzyIsNull(m_startAngle - other.m_startAngle) ||
-            !qFuzzyIsNull(m_angleSpan - other.m_angleSpan))
+            !qFuzzyIsNull(m_angleSpan - other.m_angleSpan) ||
+            !qFuzzyIsNull(m_holeRadius - other.m_holeRadius))
             return true;
 
         return false;
@@ -259,11 +259,11 @@ void PieSliceItem::updateGeometry()
     m_boundingRect = m_boundingRect.adjusted(-penWidth, -penWidth, penWidth, penWidth);
 }
 
-QPointF PieSliceItem::sliceCenter(QPointF point, qreal radius, QPieSlice *slice)
+QPointF PieSliceItem::sliceCenter(QPointF point, qreal radius, const PieSliceData &sliceData)
 {
-    if (slice->isExploded()) {
-        qreal centerAngle = slice->startAngle() + (slice->angleSpan() / 2);
-        qreal len = radius * slice->explodeDistanceFactor();
+    if (sliceData.m_isExploded) {
+        qreal centerAngle = sliceData.m_startAngle + (sliceData.m_angleSpan / 2);
+        qreal len = radius * sliceData.m_explodeDistanceFactor;
         point += offset(centerAngle, len);
     }
     return point;
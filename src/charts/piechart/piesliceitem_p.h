@@ -75,7 +75,8 @@ public:
     void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
 
     void setLayout(const PieSliceData &sliceData);
-    static QPointF sliceCenter(QPointF point, qreal radius, QPieSlice *slice);
+    const PieSliceData &layout() const { return m_data; }
+    static QPointF sliceCenter(QPointF point, qreal radius, const PieSliceData &sliceData);
 
 Q_SIGNALS:
     void clicked(Qt::MouseButtons buttons);
@@ -148,6 +148,19 @@ QT_CHARTS_BEGIN_NAMESPACE
     The default value is -1 (number limited by the number of columns in the model).
 */
 
+/*!
+    \property QHPieModelMapper::dataRole
+    \brief The item data role that is used to read and write the slice values.
+
+    The slice labels are always read and written with Qt::DisplayRole.
+    The default value is Qt::DisplayRole.
+*/
+/*!
+    \qmlproperty int HPieModelMapper::dataRole
+    The item data role that is used to read and write the slice values.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \fn void QHPieModelMapper::seriesReplaced()
     This signal is emitted when the series that the mapper is connected to changes.
@@ -178,6 +191,11 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the number of columns changes.
 */
 
+/*!
+    \fn void QHPieModelMapper::dataRoleChanged()
+    This signal is emitted when the data role changes.
+*/
+
 /*!
     Constructs a mapper object that is a child of \a parent.
 */
@@ -277,6 +295,19 @@ void QHPieModelMapper::setColumnCount(int columnCount)
     }
 }
 
+int QHPieModelMapper::dataRole() const
+{
+    return QPieModelMapper::dataRole();
+}
+
+void QHPieModelMapper::setDataRole(int role)
+{
+    if (role != QPieModelMapper::dataRole()) {
+        QPieModelMapper::setDataRole(role);
+        emit dataRoleChanged();
+    }
+}
+
 #include "moc_qhpiemodelmapper.cpp"
 
 QT_CHARTS_END_NAMESPACE
@@ -43,6 +43,7 @@ class QT_CHARTS_EXPORT QHPieModelMapper : public QPieModelMapper
     Q_PROPERTY(int labelsRow READ labelsRow WRITE setLabelsRow NOTIFY labelsRowChanged)
     Q_PROPERTY(int firstColumn READ firstColumn WRITE setFirstColumn NOTIFY firstColumnChanged)
     Q_PROPERTY(int columnCount READ columnCount WRITE setColumnCount NOTIFY columnCountChanged)
+    Q_PROPERTY(int dataRole READ dataRole WRITE setDataRole NOTIFY dataRoleChanged)
 
 public:
     explicit QHPieModelMapper(QObject *parent = nullptr);
@@ -65,6 +66,9 @@ public:
     int columnCount() const;
     void setColumnCount(int columnCount);
 
+    int dataRole() const;
+    void setDataRole(int role);
+
 Q_SIGNALS:
     void seriesReplaced();
     void modelReplaced();
@@ -72,6 +76,7 @@ Q_SIGNALS:
     void labelsRowChanged();
     void firstColumnChanged();
     void columnCountChanged();
+    void dataRoleChanged();
 };
 
 QT_CHARTS_END_NAMESPACE
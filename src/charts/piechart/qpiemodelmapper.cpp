@@ -198,6 +198,25 @@ void QPieModelMapper::setLabelsSection(int labelsSection)
     d->initializePieFromModel();
 }
 
+/*!
+    Returns the item data role that is used to read and write the slice values of the model.
+*/
+int QPieModelMapper::dataRole() const
+{
+    Q_D(const QPieModelMapper);
+    return d->m_role;
+}
+
+/*!
+    Sets the item data role that is used to read and write the slice values of the model to \a role.
+*/
+void QPieModelMapper::setDataRole(int role)
+{
+    Q_D(QPieModelMapper);
+    d->m_role = role;
+    d->initializePieFromModel();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QPieModelMapperPrivate::QPieModelMapperPrivate(QPieModelMapper *q) :
@@ -207,6 +226,7 @@ QPieModelMapperPrivate::QPieModelMapperPrivate(QPieModelMapper *q) :
     m_first(0),
     m_count(-1),
     m_orientation(Qt::Vertical),
+    m_role(Qt::DisplayRole),
     m_valuesSection(-1),
     m_labelsSection(-1),
     m_seriesSignalsBlock(false),
@@ -319,7 +339,7 @@ void QPieModelMapperPrivate::slicesAdded(QList<QPieSlice *> slices)
         m_model->insertColumns(firstIndex + m_first, slices.count());
 
     for (int i = firstIndex; i < firstIndex + slices.count(); i++) {
-        m_model->setData(valueModelIndex(i), slices.at(i - firstIndex)->value());
+        m_model->setData(valueModelIndex(i), slices.at(i - firstIndex)->value(), m_role);
         m_model->setData(labelModelIndex(i), slices.at(i - firstIndex)->label());
     }
     blockModelSignals(false);
@@ -369,7 +389,7 @@ void QPieModelMapperPrivate::sliceValueChanged()
 
     blockModelSignals();
     QPieSlice *slice = qobject_cast<QPieSlice *>(QObject::sender());
-    m_model->setData(valueModelIndex(m_series->slices().indexOf(slice)), slice->value());
+    m_model->setData(valueModelIndex(m_series->slices().indexOf(slice)), slice->value(), m_role);
     blockModelSignals(false);
 }
 
@@ -395,7 +415,7 @@ void QPieModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex botto
             slice = pieSlice(index);
             if (slice) {
                 if (isValueIndex(index))
-                    slice->setValue(m_model->data(index, Qt::DisplayRole).toReal());
+                    slice->setValue(m_model->data(index, m_role).toReal());
                 if (isLabelIndex(index))
                     slice->setLabel(m_model->data(index, Qt::DisplayRole).toString());
             }
@@ -484,7 +504,7 @@ void QPieModelMapperPrivate::insertData(int start, int end)
             QModelIndex labelIndex = labelModelIndex(i - m_first);
             if (valueIndex.isValid() && labelIndex.isValid()) {
                 QPieSlice *slice = new QPieSlice;
-                slice->setValue(m_model->data(valueIndex, Qt::DisplayRole).toDouble());
+                slice->setValue(m_model->data(valueIndex, m_role).toDouble());
                 slice->setLabel(m_model->data(labelIndex, Qt::DisplayRole).toString());
                 connect(slice, SIGNAL(labelChanged()), this, SLOT(sliceLabelChanged()));
                 connect(slice, SIGNAL(valueChanged()), this, SLOT(sliceValueChanged()));
@@ -533,7 +553,7 @@ void QPieModelMapperPrivate::removeData(int start, int end)
                     QModelIndex labelIndex = labelModelIndex(i - m_first);
                     if (valueIndex.isValid() && labelIndex.isValid()) {
                         QPieSlice *slice = new QPieSlice;
-                        slice->setValue(m_model->data(valueIndex, Qt::DisplayRole).toDouble());
+                        slice->setValue(m_model->data(valueIndex, m_role).toDouble());
                         slice->setLabel(m_model->data(labelIndex, Qt::DisplayRole).toString());
                         m_series->insert(i, slice);
                         m_slices.insert(i, slice);
@@ -560,7 +580,7 @@ void QPieModelMapperPrivate::initializePieFromModel()
     while (valueIndex.isValid() && labelIndex.isValid()) {
         QPieSlice *slice = new QPieSlice;
         slice->setLabel(m_model->data(labelIndex, Qt::DisplayRole).toString());
-        slice->setValue(m_model->data(valueIndex, Qt::DisplayRole).toDouble());
+        slice->setValue(m_model->data(valueIndex, m_role).toDouble());
         connect(slice, SIGNAL(labelChanged()), this, SLOT(sliceLabelChanged()));
         connect(slice, SIGNAL(valueChanged()), this, SLOT(sliceValueChanged()));
         m_series->append(slice);
@@ -70,6 +70,9 @@ protected:
     Qt::Orientation orientation() const;
     void setOrientation(Qt::Orientation orientation);
 
+    int dataRole() const;
+    void setDataRole(int role);
+
 protected:
     QPieModelMapperPrivate * const d_ptr;
     Q_DECLARE_PRIVATE(QPieModelMapper)
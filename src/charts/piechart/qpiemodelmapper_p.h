@@ -95,6 +95,7 @@ private:
     int m_first;
     int m_count;
     Qt::Orientation m_orientation;
+    int m_role;
     int m_valuesSection;
     int m_labelsSection;
     bool m_seriesSignalsBlock;
@@ -266,6 +266,41 @@ QT_CHARTS_BEGIN_NAMESPACE
     The default value is 360.
 */
 
+/*!
+    \property QPieSeries::otherSliceThreshold
+    \brief The angle below which slices are grouped into one slice.
+
+    When at least two slices span a smaller angle than this threshold, they are not drawn
+    individually. Instead, a single slice labeled with \l otherSliceLabel and spanning their
+    combined angle is drawn after the other slices. The grouped slices stay in the series and
+    keep their values, percentages, and angles. The grouped slice does not emit any signals.
+
+    The angle is given in degrees. Negative values are treated as 0. The default value is 0,
+    which disables grouping.
+*/
+
+/*!
+    \qmlproperty real PieSeries::otherSliceThreshold
+
+    The angle in degrees below which slices are drawn grouped into one slice labeled with
+    otherSliceLabel. The default value is 0, which disables grouping.
+*/
+
+/*!
+    \property QPieSeries::otherSliceLabel
+    \brief The label of the slice that groups the slices smaller than
+    \l otherSliceThreshold.
+
+    The default value is "Other".
+*/
+
+/*!
+    \qmlproperty string PieSeries::otherSliceLabel
+
+    The label of the slice that groups the slices smaller than otherSliceThreshold.
+    The default value is "Other".
+*/
+
 /*!
     \property QPieSeries::count
 
@@ -858,6 +893,37 @@ void QPieSeries::setLabelsPosition(QPieSlice::LabelPosition position)
         s->setLabelPosition(position);
 }
 
+void QPieSeries::setOtherSliceThreshold(qreal angle)
+{
+    Q_D(QPieSeries);
+    angle = qMax(angle, (qreal)0.0);
+    if (qFuzzyCompare(d->m_otherSliceThreshold, angle))
+        return;
+    d->m_otherSliceThreshold = angle;
+    emit d->otherSliceChanged();
+}
+
+qreal QPieSeries::otherSliceThreshold() const
+{
+    Q_D(const QPieSeries);
+    return d->m_otherSliceThreshold;
+}
+
+void QPieSeries::setOtherSliceLabel(const QString &label)
+{
+    Q_D(QPieSeries);
+    if (d->m_otherSliceLabel == label)
+        return;
+    d->m_otherSliceLabel = label;
+    emit d->otherSliceChanged();
+}
+
+QString QPieSeries::otherSliceLabel() const
+{
+    Q_D(const QPieSeries);
+    return d->m_otherSliceLabel;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -869,7 +935,9 @@ QPieSeriesPrivate::QPieSeriesPrivate(QPieSeries *parent) :
     m_pieStartAngle(0),
     m_pieEndAngle(360),
     m_sum(0),
-    m_holeRelativeSize(0.0)
+    m_holeRelativeSize(0.0),
+    m_otherSliceThreshold(0.0),
+    m_otherSliceLabel(QPieSeries::tr("Other"))
 {
 }
 
@@ -881,31 +949,37 @@ void QPieSeriesPrivate::updateDerivativeData()
 {
     // calculate sum of all slices
     qreal sum = 0;
-    foreach (QPieSlice *s, m_slices)
+    foreach (QPieSlice *s, m_slices) {
+        QPieSlicePrivate::fromSlice(s)->m_summedValue = s->value();
         sum += s->value();
+    }
 
     if (!qFuzzyCompare(m_sum, sum)) {
         m_sum = sum;
         emit q_func()->sumChanged();
     }
 
+    updateSliceAngles();
+}
+
+void QPieSeriesPrivate::updateSliceAngles()
+{
     // nothing to show..
     if (qFuzzyCompare(m_sum, 0))
         return;
 
-    // update slice attributes
-    qreal sliceAngle = m_pieStartAngle;
-    qreal pieSpan = m_pieEndAngle - m_pieStartAngle;
-    QVector<QPieSlice *> changed;
+    // Start angles come from the running sum of the values, so rounding errors
+    // do not accumulate over the slices
+    const qreal pieSpan = m_pieEndAngle - m_pieStartAngle;
+    qreal valueSum = 0;
     foreach (QPieSlice *s, m_slices) {
         QPieSlicePrivate *d = QPieSlicePrivate::fromSlice(s);
         d->setPercentage(s->value() / m_sum);
-        d->setStartAngle(sliceAngle);
+        d->setStartAngle(m_pieStartAngle + pieSpan * valueSum / m_sum);
         d->setAngleSpan(pieSpan * s->percentage());
-        sliceAngle += s->angleSpan();
+        valueSum += s->value();
     }
 
-
     emit calculatedDataChanged();
 }
 
@@ -934,8 +1008,19 @@ QPieSeriesPrivate *QPieSeriesPrivate::fromSeries(QPieSeries *series)
 
 void QPieSeriesPrivate::sliceValueChanged()
 {
-    Q_ASSERT(m_slices.contains(qobject_cast<QPieSlice *>(sender())));
-    updateDerivativeData();
+    QPieSlice *slice = qobject_cast<QPieSlice *>(sender());
+    Q_ASSERT(m_slices.contains(slice));
+
+    // Only the changed value needs to be summed again
+    QPieSlicePrivate *d = QPieSlicePrivate::fromSlice(slice);
+    const qreal sum = m_sum + slice->value() - d->m_summedValue;
+    d->m_summedValue = slice->value();
+    if (!qFuzzyCompare(m_sum, sum)) {
+        m_sum = sum;
+        emit q_func()->sumChanged();
+    }
+
+    updateSliceAngles();
 }
 
 void QPieSeriesPrivate::sliceClicked()
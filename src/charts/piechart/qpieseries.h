@@ -47,6 +47,8 @@ class QT_CHARTS_EXPORT QPieSeries : public QAbstractSeries
     Q_PROPERTY(int count READ count NOTIFY countChanged)
     Q_PROPERTY(qreal sum READ sum NOTIFY sumChanged)
     Q_PROPERTY(qreal holeSize READ holeSize WRITE setHoleSize)
+    Q_PROPERTY(qreal otherSliceThreshold READ otherSliceThreshold WRITE setOtherSliceThreshold)
+    Q_PROPERTY(QString otherSliceLabel READ otherSliceLabel WRITE setOtherSliceLabel)
 
 public:
     explicit QPieSeries(QObject *parent = nullptr);
@@ -90,6 +92,12 @@ public:
     void setPieEndAngle(qreal endAngle);
     qreal pieEndAngle() const;
 
+    void setOtherSliceThreshold(qreal angle);
+    qreal otherSliceThreshold() const;
+
+    void setOtherSliceLabel(const QString &label);
+    QString otherSliceLabel() const;
+
     void setLabelsVisible(bool visible = true);
     void setLabelsPosition(QPieSlice::LabelPosition position);
 
@@ -67,6 +67,7 @@ public:
     QAbstractAxis* createDefaultAxis(Qt::Orientation orientation) const;
 
     void updateDerivativeData();
+    void updateSliceAngles();
     void setSizes(qreal innerSize, qreal outerSize);
 
     static QPieSeriesPrivate *fromSeries(QPieSeries *series);
@@ -78,6 +79,7 @@ Q_SIGNALS:
     void pieEndAngleChanged();
     void horizontalPositionChanged();
     void verticalPositionChanged();
+    void otherSliceChanged();
 
 public Q_SLOTS:
     void sliceValueChanged();
@@ -96,6 +98,8 @@ private:
     qreal m_pieEndAngle;
     qreal m_sum;
     qreal m_holeRelativeSize;
+    qreal m_otherSliceThreshold;
+    QString m_otherSliceLabel;
 
 public:
     friend class QLegendPrivate;
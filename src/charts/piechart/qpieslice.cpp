@@ -740,7 +740,8 @@ QPieSeries *QPieSlice::series() const
 QPieSlicePrivate::QPieSlicePrivate(QPieSlice *parent)
     : QObject(parent),
       q_ptr(parent),
-      m_series(0)
+      m_series(0),
+      m_summedValue(0)
 {
 
 }
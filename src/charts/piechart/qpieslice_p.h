@@ -83,6 +83,7 @@ private:
 
     PieSliceData m_data;
     QPieSeries *m_series;
+    qreal m_summedValue; // The value included in the sum of the series
 };
 
 QT_CHARTS_END_NAMESPACE
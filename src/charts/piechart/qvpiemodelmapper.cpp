@@ -148,6 +148,19 @@ QT_CHARTS_BEGIN_NAMESPACE
     The default value is -1 (number limited by the number of rows in the model).
 */
 
+/*!
+    \property QVPieModelMapper::dataRole
+    \brief The item data role that is used to read and write the slice values.
+
+    The slice labels are always read and written with Qt::DisplayRole.
+    The default value is Qt::DisplayRole.
+*/
+/*!
+    \qmlproperty int VPieModelMapper::dataRole
+    The item data role that is used to read and write the slice values.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \fn void QVPieModelMapper::seriesReplaced()
 
@@ -182,6 +195,11 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the number of rows changes.
 */
 
+/*!
+    \fn void QVPieModelMapper::dataRoleChanged()
+    This signal is emitted when the data role changes.
+*/
+
 /*!
     Constructs a mapper object that is a child of \a parent.
 */
@@ -281,6 +299,19 @@ void QVPieModelMapper::setRowCount(int rowCount)
     }
 }
 
+int QVPieModelMapper::dataRole() const
+{
+    return QPieModelMapper::dataRole();
+}
+
+void QVPieModelMapper::setDataRole(int role)
+{
+    if (role != QPieModelMapper::dataRole()) {
+        QPieModelMapper::setDataRole(role);
+        emit dataRoleChanged();
+    }
+}
+
 #include "moc_qvpiemodelmapper.cpp"
 
 QT_CHARTS_END_NAMESPACE
@@ -219,6 +219,25 @@ QT_CHARTS_BEGIN_NAMESPACE
   \sa localizeNumbers
 */
 
+/*!
+  \property QChart::layerCachingEnabled
+  \brief Whether the static chart elements are painted from cached pixmaps.
+
+  When \c{true}, the background, plot area background, title, axes, and legend are each
+  painted from a pixmap that is only rendered again when the element changes, so that
+  updating series does not repaint them. This speeds up charts with frequently updated
+  series at the cost of the memory used by the pixmaps. The elements are painted directly
+  to printers and other vector targets and to devices with a device pixel ratio other
+  than 1.
+
+  The pixmaps are kept in QPixmapCache. An element whose pixmap would take more than an
+  eighth of QPixmapCache::cacheLimit() is painted directly, so that the pixmaps of the
+  elements do not evict each other. Large charts, such as full screen ones, need a larger
+  limit set with QPixmapCache::setCacheLimit() to benefit from the caching.
+
+  Defaults to \c{false}.
+*/
+
 /*!
   \property QChart::plotArea
   \brief The rectangle within which the chart is drawn.
@@ -653,6 +672,16 @@ QLocale QChart::locale() const
     return d_ptr->m_presenter->locale();
 }
 
+void QChart::setLayerCachingEnabled(bool enabled)
+{
+    d_ptr->m_presenter->setLayerCachingEnabled(enabled);
+}
+
+bool QChart::isLayerCachingEnabled() const
+{
+    return d_ptr->m_presenter->isLayerCachingEnabled();
+}
+
 void QChart::setAnimationOptions(AnimationOptions options)
 {
     d_ptr->m_presenter->setAnimationOptions(options);
@@ -859,20 +888,24 @@ QBrush &QChartPrivate::defaultBrush()
     return defaultBrush;
 }
 
+static QFont createDefaultFont()
+{
+    QFont font;
+    font.setPointSizeF(8.34563465);
+    return font;
+}
+
 QFont &QChartPrivate::defaultFont()
 {
-    static bool defaultFontInitialized(false);
-    static QFont defaultFont;
-    if (!defaultFontInitialized) {
-        defaultFont.setPointSizeF(8.34563465);
-        defaultFontInitialized = true;
-    }
+    // Initialized once, even when charts are created in several threads at the same time
+    static QFont defaultFont = createDefaultFont();
     return defaultFont;
 }
 
 void QChartPrivate::init()
 {
     m_legend = new LegendScroller(q_ptr);
+    m_presenter->cacheLayer(m_legend);
     q_ptr->setTheme(QChart::ChartThemeLight);
     q_ptr->setLayout(m_presenter->layout());
 }
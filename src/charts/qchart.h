@@ -64,6 +64,7 @@ class QT_CHARTS_EXPORT QChart : public QGraphicsWidget
     Q_PROPERTY(bool localizeNumbers READ localizeNumbers WRITE setLocalizeNumbers)
     Q_PROPERTY(QLocale locale READ locale WRITE setLocale)
     Q_PROPERTY(QRectF plotArea READ plotArea NOTIFY plotAreaChanged)
+    Q_PROPERTY(bool layerCachingEnabled READ isLayerCachingEnabled WRITE setLayerCachingEnabled)
     Q_ENUMS(ChartTheme)
     Q_ENUMS(AnimationOption)
     Q_ENUMS(ChartType)
@@ -172,6 +173,8 @@ public:
     bool localizeNumbers() const;
     void setLocale(const QLocale &locale);
     QLocale locale() const;
+    void setLayerCachingEnabled(bool enabled);
+    bool isLayerCachingEnabled() const;
 
     QPointF mapToValue(const QPointF &position, QAbstractSeries *series = nullptr);
     QPointF mapToPosition(const QPointF &value, QAbstractSeries *series = nullptr);
@@ -0,0 +1,93 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QChartModelColumns>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QChartModelColumns
+    \inmodule QtCharts
+    \brief The QChartModelColumns class is an interface through which a model
+    exposes its numeric data directly to the model mappers.
+
+    Model mappers normally read every cell of the mapped sections through
+    QAbstractItemModel::data() and convert the returned QVariant to a number.
+    A model that keeps a section in memory as consecutive \c qreal values can
+    inherit this interface, declare it with Q_INTERFACES(QtCharts::QChartModelColumns),
+    and return a pointer to the values from columnData() or rowData(). The mappers
+    then copy the values without going through QVariant.
+
+    The returned values must be the same ones that data() returns for the
+    requested role. The model still has to emit the usual change signals, and
+    the pointer is only used until the mapper returns from handling them.
+
+    \sa QVXYModelMapper, QHXYModelMapper
+*/
+
+/*!
+    Destroys the interface.
+*/
+QChartModelColumns::~QChartModelColumns()
+{
+}
+
+/*!
+    Returns a pointer to the value of \a column in the first row of the model
+    for \a role, or \c nullptr if the column is not available as contiguous data.
+    The distance, in \c qreal values, between the values of consecutive rows is
+    stored in \a stride.
+
+    The default implementation returns \c nullptr.
+*/
+const qreal *QChartModelColumns::columnData(int column, int role, int *stride) const
+{
+    Q_UNUSED(column)
+    Q_UNUSED(role)
+    Q_UNUSED(stride)
+    return nullptr;
+}
+
+/*!
+    Returns a pointer to the value of \a row in the first column of the model
+    for \a role, or \c nullptr if the row is not available as contiguous data.
+    The distance, in \c qreal values, between the values of consecutive columns
+    is stored in \a stride.
+
+    The default implementation returns \c nullptr.
+*/
+const qreal *QChartModelColumns::rowData(int row, int role, int *stride) const
+{
+    Q_UNUSED(row)
+    Q_UNUSED(role)
+    Q_UNUSED(stride)
+    return nullptr;
+}
+
+QT_CHARTS_END_NAMESPACE
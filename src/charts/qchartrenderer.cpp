@@ -0,0 +1,242 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtCharts/QChartRenderer>
+#include <private/qchartrenderer_p.h>
+#include <QtCharts/QChart>
+#include <QtCharts/QLegend>
+#include <QtCore/QMutex>
+#include <QtGui/QPainter>
+#include <QtWidgets/QGraphicsLayout>
+#include <QtWidgets/QGraphicsScene>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QChartRenderer
+    \inmodule QtCharts
+    \brief The QChartRenderer class renders a chart without a view.
+
+    QChartRenderer lays out a QChart at a given size and paints it into a
+    QImage or any other paint device, such as QPdfWriter or QSvgGenerator,
+    without creating a QChartView or any other widget. This makes it suitable
+    for generating chart images in batch jobs, for example with the
+    \c offscreen platform plugin.
+
+    A chart that is not in a graphics scene is placed in a scene owned by the
+    renderer for as long as the renderer renders it. A chart that is shown in
+    a QChartView is temporarily resized to the requested size and restored
+    after rendering.
+
+    \code
+    QChartRenderer renderer(chart);
+    renderer.toImage(QSize(800, 600)).save("chart.png");
+    \endcode
+
+    Charts can be rendered from threads other than the GUI thread, for example
+    from a QThreadPool, with the following restrictions:
+
+    \list
+    \li Each chart, together with its series, axes, legend, and renderer, must
+        be created, modified, and rendered in a single thread. A chart must not
+        be accessed from more than one thread, not even when rendering.
+    \li Application-wide state, such as the application font, palette, and
+        style, is read while rendering and is not protected. It must not be
+        changed while charts are rendered in other threads.
+    \li Animations should be disabled, as the chart is rendered in the state
+        it is in when rendering starts.
+    \li The background drop shadow is drawn through pixmaps, and can only be
+        used in the GUI thread.
+    \endlist
+
+    No other thread-safety guarantees are made for QChart and the classes it uses.
+
+    \sa QChart, QChartView
+*/
+
+// QGraphicsScene adds itself to and removes itself from an application wide list when it
+// is created and destroyed, so renderers in different threads must not do that at once.
+Q_GLOBAL_STATIC(QMutex, sceneMutex)
+
+/*!
+    Constructs a renderer for \a chart.
+*/
+QChartRenderer::QChartRenderer(QChart *chart)
+    : d_ptr(new QChartRendererPrivate())
+{
+    d_ptr->m_chart = chart;
+}
+
+/*!
+    Destroys the renderer. The chart is not destroyed.
+*/
+QChartRenderer::~QChartRenderer()
+{
+}
+
+/*!
+    Sets the chart to render to \a chart. The renderer does not take ownership
+    of the chart.
+*/
+void QChartRenderer::setChart(QChart *chart)
+{
+    if (d_ptr->m_chart == chart)
+        return;
+    d_ptr->releaseChart();
+    d_ptr->m_chart = chart;
+}
+
+/*!
+    Returns the chart that is rendered.
+*/
+QChart *QChartRenderer::chart() const
+{
+    return d_ptr->m_chart;
+}
+
+/*!
+    Renders the chart with \a painter into the \a target rectangle, in the
+    coordinates of the painter. The chart is laid out at \a size before it is
+    rendered and scaled to fill \a target. If \a size is empty, the size of
+    \a target is used.
+
+    The render hints of \a painter are used as is.
+*/
+void QChartRenderer::render(QPainter *painter, const QRectF &target, const QSizeF &size)
+{
+    QChart *chart = d_ptr->m_chart;
+    if (!chart || !painter)
+        return;
+
+    const bool sharedScene = chart->scene() && chart->scene() != d_ptr->m_scene;
+    const QSizeF oldSize = chart->size();
+    const QSizeF layoutSize = size.isEmpty() ? target.size() : size;
+    const QRectF source = d_ptr->layoutChart(layoutSize);
+    chart->scene()->render(painter, target, source, Qt::IgnoreAspectRatio);
+
+    // Give a chart shown in a view its size back
+    if (sharedScene && oldSize != chart->size())
+        d_ptr->layoutChart(oldSize);
+}
+
+/*!
+    Renders the chart on the whole area of \a device with antialiasing.
+    The chart is laid out in device independent pixels, so that it looks the
+    same on a high resolution device, such as a QPdfWriter, only sharper.
+
+    Returns \c true if the device could be painted on; otherwise returns \c false.
+*/
+bool QChartRenderer::render(QPaintDevice *device)
+{
+    if (!d_ptr->m_chart || !device)
+        return false;
+
+    QPainter painter(device);
+    if (!painter.isActive())
+        return false;
+    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing
+                           | QPainter::SmoothPixmapTransform);
+
+    const qreal ratio = device->devicePixelRatioF();
+    const QRectF target(0, 0, device->width() / ratio, device->height() / ratio);
+    const QSizeF size(target.width() * 96.0 / device->logicalDpiX(),
+                      target.height() * 96.0 / device->logicalDpiY());
+    render(&painter, target, size);
+    return true;
+}
+
+/*!
+    Returns an antialiased image of the chart laid out at \a size. The image
+    has the given \a devicePixelRatio, and its size in pixels is \a size
+    multiplied by it. Parts of the chart that are not covered by the chart
+    background are transparent.
+*/
+QImage QChartRenderer::toImage(const QSize &size, qreal devicePixelRatio)
+{
+    if (!d_ptr->m_chart || size.isEmpty())
+        return QImage();
+
+    QImage image(size * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    if (image.isNull())
+        return image;
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+
+    QPainter painter(&image);
+    painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing
+                           | QPainter::SmoothPixmapTransform);
+    render(&painter, QRectF(QPointF(), size), size);
+    return image;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+QChartRendererPrivate::QChartRendererPrivate()
+    : m_scene(0)
+{
+}
+
+QChartRendererPrivate::~QChartRendererPrivate()
+{
+    releaseChart();
+    QMutexLocker locker(sceneMutex());
+    delete m_scene;
+}
+
+void QChartRendererPrivate::releaseChart()
+{
+    // The scene would delete the chart with it
+    if (m_chart && m_scene && m_chart->scene() == m_scene)
+        m_scene->removeItem(m_chart);
+}
+
+QRectF QChartRendererPrivate::layoutChart(const QSizeF &size)
+{
+    if (!m_chart->scene()) {
+        if (!m_scene) {
+            QMutexLocker locker(sceneMutex());
+            m_scene = new QGraphicsScene();
+        }
+        m_scene->addItem(m_chart);
+    }
+
+    // Lay the chart out right away instead of waiting for the posted layout requests
+    if (!size.isEmpty())
+        m_chart->resize(size);
+    if (QGraphicsLayout *layout = m_chart->layout())
+        layout->activate();
+    QLegend *legend = m_chart->legend();
+    if (legend && legend->layout())
+        legend->layout()->activate();
+
+    return m_chart->sceneBoundingRect();
+}
+
+QT_CHARTS_END_NAMESPACE
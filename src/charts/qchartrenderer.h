@@ -0,0 +1,69 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QCHARTRENDERER_H
+#define QCHARTRENDERER_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCore/QRectF>
+#include <QtCore/QScopedPointer>
+#include <QtGui/QImage>
+
+QT_BEGIN_NAMESPACE
+class QPainter;
+class QPaintDevice;
+QT_END_NAMESPACE
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QChart;
+class QChartRendererPrivate;
+
+class QT_CHARTS_EXPORT QChartRenderer
+{
+public:
+    explicit QChartRenderer(QChart *chart = 0);
+    ~QChartRenderer();
+
+    void setChart(QChart *chart);
+    QChart *chart() const;
+
+    void render(QPainter *painter, const QRectF &target, const QSizeF &size = QSizeF());
+    bool render(QPaintDevice *device);
+    QImage toImage(const QSize &size, qreal devicePixelRatio = 1.0);
+
+private:
+    QScopedPointer<QChartRendererPrivate> d_ptr;
+    Q_DISABLE_COPY(QChartRenderer)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QCHARTRENDERER_H
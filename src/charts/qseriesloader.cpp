@@ -0,0 +1,811 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtCharts/QSeriesLoader>
+#include <private/qseriesloader_p.h>
+#include <QtCharts/QXYSeries>
+#include <QtCharts/QBarSet>
+#include <QtCharts/QCandlestickSeries>
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVarLengthArray>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QSeriesLoader
+    \inmodule QtCharts
+    \brief The QSeriesLoader class loads series data from delimited text and
+    binary files.
+
+    QSeriesLoader reads numeric columns from a file and replaces the data of
+    one or more XY series, bar sets, and candlestick series with them. The
+    file is memory-mapped, split into chunks at line or record boundaries,
+    and the chunks are parsed in parallel on the global QThreadPool. The
+    parser reads the numbers straight from the mapped file, without creating
+    strings for lines or fields. When all chunks have been parsed, each
+    target is filled with a single bulk replace, so that the chart is updated
+    once.
+
+    Columns are numbered from 0. Add the targets with addSeries(), addBarSet(),
+    and addCandlestickSeries() and call load(). Loading is asynchronous:
+    progressChanged() reports the parsed share of the file, and finished() is
+    emitted after the targets have been filled. A load can be stopped with
+    cancel(), in which case the targets are left as they are and canceled()
+    is emitted. A file with more rows than a series can hold, about 134 million,
+    leaves the targets as they are as well, and failed() is emitted.
+
+    \code
+    QSeriesLoader *loader = new QSeriesLoader(this);
+    loader->setHeaderRows(1);
+    loader->addSeries(temperatureSeries, 0, 1);
+    loader->addSeries(pressureSeries, 0, 2);
+    connect(loader, &QSeriesLoader::finished, this, &Window::showChart);
+    loader->load("measurements.csv");
+    \endcode
+
+    Text files contain one row per line, with fields separated by commas in
+    the \l Csv format and by tabs in the \l Tsv format. Numbers may be
+    surrounded by spaces and double quotes, but fields must not contain
+    delimiters or line breaks. Rows in which a column read by a target is
+    missing or is not a number are skipped, as are empty lines.
+
+    Binary files contain packed records of columnCount() native-endian
+    values of valueType(), starting at offset().
+
+    \sa QMappedXYDataProvider
+*/
+
+/*!
+    \enum QSeriesLoader::Format
+
+    This enum describes the format of the loaded file.
+
+    \value Csv Lines of comma-separated values.
+    \value Tsv Lines of tab-separated values.
+    \value Binary Packed records of binary values.
+*/
+
+/*!
+    \enum QSeriesLoader::ValueType
+
+    This enum describes the type of the values in a binary file.
+
+    \value Float The values are 32-bit floating point numbers.
+    \value Double The values are 64-bit floating point numbers.
+*/
+
+/*!
+    \property QSeriesLoader::format
+    \brief The format of the loaded file.
+
+    The default is \l Csv.
+*/
+
+/*!
+    \property QSeriesLoader::headerRows
+    \brief The number of lines at the start of a text file that are skipped.
+
+    The default is 0.
+*/
+
+/*!
+    \property QSeriesLoader::valueType
+    \brief The type of the values in a binary file.
+
+    The default is \l Double.
+*/
+
+/*!
+    \property QSeriesLoader::columnCount
+    \brief The number of values in each record of a binary file.
+
+    The default is 2.
+*/
+
+/*!
+    \property QSeriesLoader::offset
+    \brief The position of the first record in a binary file in bytes.
+
+    The default is 0.
+*/
+
+/*!
+    \property QSeriesLoader::loading
+    \brief Whether a file is being loaded.
+*/
+
+/*!
+    \fn void QSeriesLoader::progressChanged(qreal progress)
+    This signal is emitted when a part of the file has been parsed.
+    \a progress is the parsed share of the file, between 0 and 1.
+*/
+
+/*!
+    \fn void QSeriesLoader::finished()
+    This signal is emitted when the file has been loaded and the targets
+    have been filled.
+*/
+
+/*!
+    \fn void QSeriesLoader::canceled()
+    This signal is emitted when a canceled load has stopped.
+*/
+
+/*!
+    \fn void QSeriesLoader::failed()
+    This signal is emitted when the parsed file could not be loaded into the
+    targets. The targets are not changed, and errorString() describes the
+    error.
+*/
+
+// Bytes of the file that are parsed by one task
+static const qint64 chunkSize = 4 << 20;
+// The points of an XY series are held in one QVector, whose size in bytes must fit an int
+static const qint64 maxRowCount = (std::numeric_limits<int>::max() - qint64(sizeof(QArrayData)))
+        / qint64(sizeof(QPointF));
+
+static const double powersOf10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline const char *findByte(const char *begin, const char *end, char byte)
+{
+    const void *found = std::memchr(begin, byte, end - begin);
+    return found ? static_cast<const char *>(found) : end;
+}
+
+static inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Parses a decimal number without allocating. Numbers with up to 19 significant digits
+// whose mantissa and power of ten are exact doubles are computed directly, which covers
+// the usual data files. Others, and special values such as "nan", are left to QByteArray.
+static bool parseNumber(const char *begin, const char *end, qreal *value)
+{
+    while (begin < end && (*begin == ' ' || *begin == '"'))
+        ++begin;
+    while (end > begin && (end[-1] == ' ' || end[-1] == '"'))
+        --end;
+    if (begin == end)
+        return false;
+
+    const char *p = begin;
+    const bool negative = *p == '-';
+    if (*p == '-' || *p == '+')
+        ++p;
+
+    quint64 mantissa = 0;
+    int exponent = 0;
+    bool digits = false;
+    bool truncated = false;
+    for (; p < end && isDigit(*p); ++p) {
+        digits = true;
+        if (mantissa < Q_UINT64_C(1000000000000000000)) {
+            mantissa = mantissa * 10 + (*p - '0');
+        } else {
+            ++exponent;
+            truncated = true;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && isDigit(*p); ++p) {
+            digits = true;
+            if (mantissa < Q_UINT64_C(1000000000000000000)) {
+                mantissa = mantissa * 10 + (*p - '0');
+                --exponent;
+            } else {
+                truncated = true;
+            }
+        }
+    }
+    if (digits && p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        const bool negativeExponent = p < end && *p == '-';
+        if (p < end && (*p == '-' || *p == '+'))
+            ++p;
+        int explicitExponent = 0;
+        bool exponentDigits = false;
+        for (; p < end && isDigit(*p); ++p) {
+            exponentDigits = true;
+            if (explicitExponent < 10000)
+                explicitExponent = explicitExponent * 10 + (*p - '0');
+        }
+        if (!exponentDigits)
+            digits = false;
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    if (digits && p == end && !truncated && mantissa <= (Q_UINT64_C(1) << 53)
+            && exponent >= -22 && exponent <= 22) {
+        double result = double(mantissa);
+        result = exponent < 0 ? result / powersOf10[-exponent] : result * powersOf10[exponent];
+        *value = negative ? -result : result;
+        return true;
+    }
+
+    bool ok = false;
+    *value = QByteArray(begin, int(end - begin)).toDouble(&ok);
+    return ok;
+}
+
+class SeriesLoaderChunk : public QRunnable
+{
+public:
+    SeriesLoaderChunk(QSeriesLoaderPrivate *loader, int index, const char *begin,
+                      const char *end)
+        : m_rows(0),
+          m_loader(loader),
+          m_index(index),
+          m_begin(begin),
+          m_end(end),
+          m_format(loader->m_format),
+          m_valueType(loader->m_valueType),
+          m_columnCount(loader->m_columnCount),
+          m_columns(loader->m_columns),
+          m_columnSlots(loader->m_columnSlots)
+    {
+        setAutoDelete(false);
+    }
+
+    void run()
+    {
+        m_values.resize(m_columns.size());
+        if (!m_loader->m_canceled.load()) {
+            if (m_format == QSeriesLoader::Binary)
+                parseBinary();
+            else
+                parseText();
+        }
+        // Notify first, the loader may be destroyed as soon as the chunk is released
+        QMetaObject::invokeMethod(m_loader, "handleChunkParsed", Qt::QueuedConnection,
+                                  Q_ARG(int, m_index));
+        m_loader->m_chunksDone.release();
+    }
+
+    qint64 size() const { return m_end - m_begin; }
+
+    QVector<QVector<qreal> > m_values;
+    int m_rows;
+
+private:
+    void parseText();
+    void parseBinary();
+
+    QSeriesLoaderPrivate *m_loader;
+    int m_index;
+    const char *m_begin;
+    const char *m_end;
+    QSeriesLoader::Format m_format;
+    QSeriesLoader::ValueType m_valueType;
+    int m_columnCount;
+    QVector<int> m_columns;
+    QVector<int> m_columnSlots;
+};
+
+void SeriesLoaderChunk::parseText()
+{
+    const char delimiter = m_format == QSeriesLoader::Tsv ? '\t' : ',';
+    const int slotCount = m_columns.size();
+    const int lastColumn = m_columnSlots.size() - 1;
+    const int *columnSlots = m_columnSlots.constData();
+    QVarLengthArray<qreal, 16> row(slotCount);
+
+    int lines = 0;
+    const char *line = m_begin;
+    while (line < m_end) {
+        if ((++lines & 0xffff) == 0 && m_loader->m_canceled.load())
+            return;
+
+        const char *lineEnd = findByte(line, m_end, '\n');
+        const char *nextLine = lineEnd < m_end ? lineEnd + 1 : m_end;
+        if (lineEnd > line && lineEnd[-1] == '\r')
+            --lineEnd;
+
+        int found = 0;
+        const char *field = line;
+        for (int column = 0; column <= lastColumn; column++) {
+            const char *fieldEnd = findByte(field, lineEnd, delimiter);
+            const int slot = columnSlots[column];
+            if (slot >= 0) {
+                if (!parseNumber(field, fieldEnd, &row[slot]))
+                    break;
+                found++;
+            }
+            if (fieldEnd == lineEnd)
+                break;
+            field = fieldEnd + 1;
+        }
+
+        if (found == slotCount) {
+            for (int slot = 0; slot < slotCount; slot++)
+                m_values[slot].append(row[slot]);
+            m_rows++;
+        }
+        line = nextLine;
+    }
+}
+
+void SeriesLoaderChunk::parseBinary()
+{
+    const int valueSize = m_valueType == QSeriesLoader::Float ? sizeof(float) : sizeof(double);
+    const qint64 recordSize = qint64(m_columnCount) * valueSize;
+    const int slotCount = m_columns.size();
+    const int rows = int(size() / recordSize);
+    for (int slot = 0; slot < slotCount; slot++)
+        m_values[slot].resize(rows);
+
+    // The mapped values are not necessarily aligned
+    const char *record = m_begin;
+    for (int row = 0; row < rows; row++, record += recordSize) {
+        if ((row & 0xffff) == 0xffff && m_loader->m_canceled.load())
+            return;
+        for (int slot = 0; slot < slotCount; slot++) {
+            const char *data = record + qint64(m_columns.at(slot)) * valueSize;
+            if (m_valueType == QSeriesLoader::Float) {
+                float value;
+                std::memcpy(&value, data, sizeof(value));
+                m_values[slot][row] = value;
+            } else {
+                double value;
+                std::memcpy(&value, data, sizeof(value));
+                m_values[slot][row] = value;
+            }
+        }
+    }
+    m_rows = rows;
+}
+
+/*!
+    Constructs a loader with the parent \a parent.
+*/
+QSeriesLoader::QSeriesLoader(QObject *parent)
+    : QObject(parent),
+      d_ptr(new QSeriesLoaderPrivate(this))
+{
+}
+
+/*!
+    Destroys the loader. A load in progress is canceled and the destructor
+    waits for the worker threads to stop.
+*/
+QSeriesLoader::~QSeriesLoader()
+{
+}
+
+void QSeriesLoader::setFormat(Format format)
+{
+    d_ptr->m_format = format;
+}
+
+QSeriesLoader::Format QSeriesLoader::format() const
+{
+    return d_ptr->m_format;
+}
+
+void QSeriesLoader::setHeaderRows(int rows)
+{
+    d_ptr->m_headerRows = qMax(0, rows);
+}
+
+int QSeriesLoader::headerRows() const
+{
+    return d_ptr->m_headerRows;
+}
+
+void QSeriesLoader::setValueType(ValueType type)
+{
+    d_ptr->m_valueType = type;
+}
+
+QSeriesLoader::ValueType QSeriesLoader::valueType() const
+{
+    return d_ptr->m_valueType;
+}
+
+void QSeriesLoader::setColumnCount(int count)
+{
+    d_ptr->m_columnCount = qMax(1, count);
+}
+
+int QSeriesLoader::columnCount() const
+{
+    return d_ptr->m_columnCount;
+}
+
+void QSeriesLoader::setOffset(qint64 offset)
+{
+    d_ptr->m_offset = qMax(qint64(0), offset);
+}
+
+qint64 QSeriesLoader::offset() const
+{
+    return d_ptr->m_offset;
+}
+
+/*!
+    Adds \a series to the targets of the loader. Its points are replaced with
+    points whose x values are read from \a xColumn and y values from \a yColumn.
+*/
+void QSeriesLoader::addSeries(QXYSeries *series, int xColumn, int yColumn)
+{
+    if (!series || xColumn < 0 || yColumn < 0)
+        return;
+    QSeriesLoaderPrivate::XYTarget target = { series, xColumn, yColumn };
+    d_ptr->m_xyTargets.append(target);
+}
+
+/*!
+    Adds \a set to the targets of the loader. Its values are replaced with the
+    values in \a column.
+*/
+void QSeriesLoader::addBarSet(QBarSet *set, int column)
+{
+    if (!set || column < 0)
+        return;
+    QSeriesLoaderPrivate::BarTarget target = { set, column };
+    d_ptr->m_barTargets.append(target);
+}
+
+/*!
+    Adds \a series to the targets of the loader. Its candlesticks are replaced
+    with ones whose timestamp, open, high, low, and close values are read from
+    \a timestampColumn, \a openColumn, \a highColumn, \a lowColumn, and
+    \a closeColumn.
+*/
+void QSeriesLoader::addCandlestickSeries(QCandlestickSeries *series, int timestampColumn,
+                                         int openColumn, int highColumn, int lowColumn,
+                                         int closeColumn)
+{
+    if (!series || timestampColumn < 0 || openColumn < 0 || highColumn < 0 || lowColumn < 0
+            || closeColumn < 0) {
+        return;
+    }
+    QSeriesLoaderPrivate::CandlestickTarget target = {
+        series, { timestampColumn, openColumn, highColumn, lowColumn, closeColumn }
+    };
+    d_ptr->m_candlestickTargets.append(target);
+}
+
+/*!
+    Removes all targets from the loader. The targets of a load in progress are
+    still filled when it finishes.
+*/
+void QSeriesLoader::clearTargets()
+{
+    d_ptr->m_xyTargets.clear();
+    d_ptr->m_barTargets.clear();
+    d_ptr->m_candlestickTargets.clear();
+}
+
+/*!
+    Starts loading the file \a fileName into the targets. Returns \c true if
+    loading started. Returns \c false if a file is already being loaded, there
+    are no targets, or the file can't be read, and sets errorString().
+
+    \sa finished(), cancel()
+*/
+bool QSeriesLoader::load(const QString &fileName)
+{
+    Q_D(QSeriesLoader);
+    if (isLoading()) {
+        d->m_errorString = tr("A file is already being loaded.");
+        return false;
+    }
+    d->reset();
+    d->m_errorString.clear();
+    d->m_rowCount = 0;
+    d->m_canceled.store(0);
+
+    d->m_columns = d->targetColumns();
+    if (d->m_columns.isEmpty()) {
+        d->m_errorString = tr("There are no series to load into.");
+        return false;
+    }
+    d->m_columnSlots.fill(-1, d->m_columns.last() + 1);
+    for (int slot = 0; slot < d->m_columns.size(); slot++)
+        d->m_columnSlots[d->m_columns.at(slot)] = slot;
+
+    d->m_file.setFileName(fileName);
+    if (!d->m_file.open(QIODevice::ReadOnly)) {
+        d->m_errorString = d->m_file.errorString();
+        return false;
+    }
+    const qint64 size = d->m_file.size();
+    if (size > 0) {
+        d->m_data = d->m_file.map(0, size);
+        if (!d->m_data) {
+            d->m_errorString = d->m_file.errorString();
+            d->m_file.close();
+            return false;
+        }
+    }
+
+    const char *data = reinterpret_cast<const char *>(d->m_data);
+    const bool started = d->m_format == Binary ? d->startBinary(data, size)
+                                               : d->startText(data, size);
+    if (!started)
+        d->reset();
+    return started;
+}
+
+/*!
+    Cancels the load in progress. The targets are not changed, and canceled()
+    is emitted when the worker threads have stopped.
+*/
+void QSeriesLoader::cancel()
+{
+    if (isLoading())
+        d_ptr->m_canceled.store(1);
+}
+
+bool QSeriesLoader::isLoading() const
+{
+    return d_ptr->m_pendingChunks > 0;
+}
+
+/*!
+    Returns the number of rows that the last finished load read.
+*/
+int QSeriesLoader::rowCount() const
+{
+    return d_ptr->m_rowCount;
+}
+
+/*!
+    Returns a description of the last error.
+*/
+QString QSeriesLoader::errorString() const
+{
+    return d_ptr->m_errorString;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+QSeriesLoaderPrivate::QSeriesLoaderPrivate(QSeriesLoader *q)
+    : q_ptr(q),
+      m_format(QSeriesLoader::Csv),
+      m_headerRows(0),
+      m_valueType(QSeriesLoader::Double),
+      m_columnCount(2),
+      m_offset(0),
+      m_data(0),
+      m_pendingChunks(0),
+      m_parsedBytes(0),
+      m_totalBytes(0),
+      m_rowCount(0)
+{
+}
+
+QSeriesLoaderPrivate::~QSeriesLoaderPrivate()
+{
+    m_canceled.store(1);
+    m_chunksDone.acquire(m_pendingChunks);
+    m_pendingChunks = 0;
+    reset();
+}
+
+// Returns the sorted columns that the targets read
+QVector<int> QSeriesLoaderPrivate::targetColumns() const
+{
+    QVector<int> columns;
+    for (const XYTarget &target : m_xyTargets) {
+        if (target.series)
+            columns << target.xColumn << target.yColumn;
+    }
+    for (const BarTarget &target : m_barTargets) {
+        if (target.set)
+            columns << target.column;
+    }
+    for (const CandlestickTarget &target : m_candlestickTargets) {
+        if (target.series) {
+            for (int column : target.columns)
+                columns << column;
+        }
+    }
+    std::sort(columns.begin(), columns.end());
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    return columns;
+}
+
+bool QSeriesLoaderPrivate::startText(const char *data, qint64 size)
+{
+    const char *end = data + size;
+    const char *begin = data;
+    for (int row = 0; row < m_headerRows && begin < end; row++) {
+        begin = findByte(begin, end, '\n');
+        if (begin < end)
+            ++begin;
+    }
+
+    // Chunks end after a line break, so that every line is parsed by one task
+    m_totalBytes = end - begin;
+    do {
+        const char *chunkEnd = end - begin > chunkSize ? begin + chunkSize : end;
+        if (chunkEnd < end) {
+            chunkEnd = findByte(chunkEnd, end, '\n');
+            if (chunkEnd < end)
+                ++chunkEnd;
+        }
+        startChunk(new SeriesLoaderChunk(this, m_chunks.size(), begin, chunkEnd));
+        begin = chunkEnd;
+    } while (begin < end);
+    return true;
+}
+
+bool QSeriesLoaderPrivate::startBinary(const char *data, qint64 size)
+{
+    if (m_columns.last() >= m_columnCount) {
+        m_errorString = QSeriesLoader::tr("A column is outside of the binary records.");
+        return false;
+    }
+
+    const int valueSize = m_valueType == QSeriesLoader::Float ? sizeof(float) : sizeof(double);
+    const qint64 recordSize = qint64(m_columnCount) * valueSize;
+    const qint64 records = size > m_offset ? (size - m_offset) / recordSize : 0;
+    if (records > maxRowCount) {
+        m_errorString = QSeriesLoader::tr("The file has too many records.");
+        return false;
+    }
+
+    // Chunks hold whole records
+    const qint64 chunkRecords = qMax(qint64(1), chunkSize / recordSize);
+    const char *begin = data + qMin(size, m_offset);
+    const char *end = begin + records * recordSize;
+    m_totalBytes = end - begin;
+    do {
+        const char *chunkEnd = begin + qMin(end - begin, chunkRecords * recordSize);
+        startChunk(new SeriesLoaderChunk(this, m_chunks.size(), begin, chunkEnd));
+        begin = chunkEnd;
+    } while (begin < end);
+    return true;
+}
+
+void QSeriesLoaderPrivate::startChunk(SeriesLoaderChunk *chunk)
+{
+    m_chunks.append(chunk);
+    m_pendingChunks++;
+    QThreadPool::globalInstance()->start(chunk);
+}
+
+void QSeriesLoaderPrivate::handleChunkParsed(int index)
+{
+    Q_Q(QSeriesLoader);
+    m_chunksDone.acquire();
+    m_pendingChunks--;
+
+    if (m_canceled.load()) {
+        if (!m_pendingChunks) {
+            reset();
+            emit q->canceled();
+        }
+        return;
+    }
+
+    m_parsedBytes += m_chunks.at(index)->size();
+    emit q->progressChanged(m_totalBytes ? qreal(m_parsedBytes) / m_totalBytes : qreal(1));
+    if (!m_pendingChunks)
+        finish();
+}
+
+void QSeriesLoaderPrivate::finish()
+{
+    Q_Q(QSeriesLoader);
+
+    qint64 totalRows = 0;
+    for (const SeriesLoaderChunk *chunk : qAsConst(m_chunks))
+        totalRows += chunk->m_rows;
+    if (totalRows > maxRowCount) {
+        reset();
+        m_errorString = QSeriesLoader::tr("The file has too many rows.");
+        emit q->failed();
+        return;
+    }
+
+    const int rows = int(totalRows);
+    QVector<QVector<qreal> > values(m_columns.size());
+    for (int slot = 0; slot < values.size(); slot++) {
+        values[slot].reserve(rows);
+        for (SeriesLoaderChunk *chunk : qAsConst(m_chunks)) {
+            values[slot] += chunk->m_values.at(slot);
+            chunk->m_values[slot] = QVector<qreal>();
+        }
+    }
+    const QVector<int> columnSlots = m_columnSlots;
+    reset();
+    m_rowCount = rows;
+
+    // Targets removed or added during the load are skipped
+    for (const XYTarget &target : qAsConst(m_xyTargets)) {
+        if (!target.series || target.xColumn >= columnSlots.size()
+                || target.yColumn >= columnSlots.size()) {
+            continue;
+        }
+        const int xSlot = columnSlots.at(target.xColumn);
+        const int ySlot = columnSlots.at(target.yColumn);
+        if (xSlot < 0 || ySlot < 0)
+            continue;
+        const qreal *x = values.at(xSlot).constData();
+        const qreal *y = values.at(ySlot).constData();
+        QVector<QPointF> points(rows);
+        for (int i = 0; i < rows; i++)
+            points[i] = QPointF(x[i], y[i]);
+        target.series->replace(points);
+    }
+    for (const BarTarget &target : qAsConst(m_barTargets)) {
+        if (!target.set || target.column >= columnSlots.size()
+                || columnSlots.at(target.column) < 0) {
+            continue;
+        }
+        target.set->replace(values.at(columnSlots.at(target.column)));
+    }
+    for (const CandlestickTarget &target : qAsConst(m_candlestickTargets)) {
+        if (!target.series)
+            continue;
+        int targetSlots[5];
+        bool loaded = true;
+        for (int i = 0; i < 5; i++) {
+            const int column = target.columns[i];
+            targetSlots[i] = column < columnSlots.size() ? columnSlots.at(column) : -1;
+            loaded = loaded && targetSlots[i] >= 0;
+        }
+        if (loaded) {
+            target.series->replace(values.at(targetSlots[0]), values.at(targetSlots[1]),
+                                   values.at(targetSlots[2]), values.at(targetSlots[3]),
+                                   values.at(targetSlots[4]));
+        }
+    }
+
+    emit q->finished();
+}
+
+void QSeriesLoaderPrivate::reset()
+{
+    qDeleteAll(m_chunks);
+    m_chunks.clear();
+    if (m_data) {
+        m_file.unmap(m_data);
+        m_data = 0;
+    }
+    m_file.close();
+    m_parsedBytes = 0;
+    m_totalBytes = 0;
+}
+
+#include "moc_qseriesloader.cpp"
+#include "moc_qseriesloader_p.cpp"
+
+QT_CHARTS_END_NAMESPACE
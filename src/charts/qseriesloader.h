@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QSERIESLOADER_H
+#define QSERIESLOADER_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCore/QObject>
+#include <QtCore/QScopedPointer>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QSeriesLoaderPrivate;
+class QXYSeries;
+class QBarSet;
+class QCandlestickSeries;
+
+class QT_CHARTS_EXPORT QSeriesLoader : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(Format format READ format WRITE setFormat)
+    Q_PROPERTY(int headerRows READ headerRows WRITE setHeaderRows)
+    Q_PROPERTY(ValueType valueType READ valueType WRITE setValueType)
+    Q_PROPERTY(int columnCount READ columnCount WRITE setColumnCount)
+    Q_PROPERTY(qint64 offset READ offset WRITE setOffset)
+    Q_PROPERTY(bool loading READ isLoading)
+    Q_ENUMS(Format)
+    Q_ENUMS(ValueType)
+
+public:
+    enum Format {
+        Csv,
+        Tsv,
+        Binary
+    };
+
+    enum ValueType {
+        Float,
+        Double
+    };
+
+    explicit QSeriesLoader(QObject *parent = nullptr);
+    ~QSeriesLoader();
+
+    void setFormat(Format format);
+    Format format() const;
+
+    void setHeaderRows(int rows);
+    int headerRows() const;
+
+    void setValueType(ValueType type);
+    ValueType valueType() const;
+
+    void setColumnCount(int count);
+    int columnCount() const;
+
+    void setOffset(qint64 offset);
+    qint64 offset() const;
+
+    void addSeries(QXYSeries *series, int xColumn, int yColumn);
+    void addBarSet(QBarSet *set, int column);
+    void addCandlestickSeries(QCandlestickSeries *series, int timestampColumn, int openColumn,
+                              int highColumn, int lowColumn, int closeColumn);
+    void clearTargets();
+
+    bool load(const QString &fileName);
+    void cancel();
+    bool isLoading() const;
+    int rowCount() const;
+    QString errorString() const;
+
+Q_SIGNALS:
+    void progressChanged(qreal progress);
+    void finished();
+    void canceled();
+    void failed();
+
+private:
+    QScopedPointer<QSeriesLoaderPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(QSeriesLoader)
+    Q_DISABLE_COPY(QSeriesLoader)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QSERIESLOADER_H
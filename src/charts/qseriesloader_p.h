@@ -0,0 +1,117 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef QSERIESLOADER_P_H
+#define QSERIESLOADER_P_H
+
+#include <QtCharts/QSeriesLoader>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QFile>
+#include <QtCore/QPointer>
+#include <QtCore/QSemaphore>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class SeriesLoaderChunk;
+
+class QSeriesLoaderPrivate : public QObject
+{
+    Q_OBJECT
+
+public:
+    QSeriesLoaderPrivate(QSeriesLoader *q);
+    ~QSeriesLoaderPrivate();
+
+    QVector<int> targetColumns() const;
+    bool startText(const char *data, qint64 size);
+    bool startBinary(const char *data, qint64 size);
+    void startChunk(SeriesLoaderChunk *chunk);
+    void finish();
+    void reset();
+
+public Q_SLOTS:
+    void handleChunkParsed(int index);
+
+public:
+    struct XYTarget {
+        QPointer<QXYSeries> series;
+        int xColumn;
+        int yColumn;
+    };
+    struct BarTarget {
+        QPointer<QBarSet> set;
+        int column;
+    };
+    struct CandlestickTarget {
+        QPointer<QCandlestickSeries> series;
+        int columns[5];
+    };
+
+    QSeriesLoader *q_ptr;
+    QSeriesLoader::Format m_format;
+    int m_headerRows;
+    QSeriesLoader::ValueType m_valueType;
+    int m_columnCount;
+    qint64 m_offset;
+    QVector<XYTarget> m_xyTargets;
+    QVector<BarTarget> m_barTargets;
+    QVector<CandlestickTarget> m_candlestickTargets;
+
+    QFile m_file;
+    uchar *m_data;
+    // Columns the targets read, and the position of each in the parsed values
+    QVector<int> m_columns;
+    QVector<int> m_columnSlots;
+    QList<SeriesLoaderChunk *> m_chunks;
+    int m_pendingChunks;
+    qint64 m_parsedBytes;
+    qint64 m_totalBytes;
+    QAtomicInt m_canceled;
+    QSemaphore m_chunksDone;
+    int m_rowCount;
+    QString m_errorString;
+
+private:
+    Q_DECLARE_PUBLIC(QSeriesLoader)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QSERIESLOADER_P_H
@@ -146,6 +146,20 @@ QT_CHARTS_BEGIN_NAMESPACE
     the model).
 */
 
+/*!
+    \property QHXYModelMapper::dataRole
+    \brief The item data role that is used to read and write the data points.
+
+    The default value is Qt::DisplayRole.
+
+    \sa QChartModelColumns
+*/
+/*!
+    \qmlproperty int HXYModelMapper::dataRole
+    The item data role that is used to read and write the data points.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \fn void QHXYModelMapper::seriesReplaced()
 
@@ -184,6 +198,11 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the number of columns changes.
 */
 
+/*!
+    \fn void QHXYModelMapper::dataRoleChanged()
+    This signal is emitted when the data role changes.
+*/
+
 /*!
     Constructs a mapper object that is a child of \a parent.
 */
@@ -271,6 +290,19 @@ void QHXYModelMapper::setColumnCount(int columnCount)
     }
 }
 
+int QHXYModelMapper::dataRole() const
+{
+    return QXYModelMapper::dataRole();
+}
+
+void QHXYModelMapper::setDataRole(int role)
+{
+    if (role != QXYModelMapper::dataRole()) {
+        QXYModelMapper::setDataRole(role);
+        emit dataRoleChanged();
+    }
+}
+
 #include "moc_qhxymodelmapper.cpp"
 
 QT_CHARTS_END_NAMESPACE
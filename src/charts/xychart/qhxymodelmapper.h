@@ -43,6 +43,7 @@ class QT_CHARTS_EXPORT QHXYModelMapper : public QXYModelMapper
     Q_PROPERTY(int yRow READ yRow WRITE setYRow NOTIFY yRowChanged)
     Q_PROPERTY(int firstColumn READ firstColumn WRITE setFirstColumn NOTIFY firstColumnChanged)
     Q_PROPERTY(int columnCount READ columnCount WRITE setColumnCount NOTIFY columnCountChanged)
+    Q_PROPERTY(int dataRole READ dataRole WRITE setDataRole NOTIFY dataRoleChanged)
 
 public:
     explicit QHXYModelMapper(QObject *parent = nullptr);
@@ -65,6 +66,9 @@ public:
     int columnCount() const;
     void setColumnCount(int columnCount);
 
+    int dataRole() const;
+    void setDataRole(int role);
+
 Q_SIGNALS:
     void seriesReplaced();
     void modelReplaced();
@@ -72,6 +76,7 @@ Q_SIGNALS:
     void yRowChanged();
     void firstColumnChanged();
     void columnCountChanged();
+    void dataRoleChanged();
 };
 
 QT_CHARTS_END_NAMESPACE
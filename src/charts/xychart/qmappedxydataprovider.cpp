@@ -0,0 +1,327 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtCharts/QMappedXYDataProvider>
+#include <private/qmappedxydataprovider_p.h>
+#include <cstring>
+#include <limits>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QMappedXYDataProvider
+    \inmodule QtCharts
+    \brief The QMappedXYDataProvider class provides the points of an XY series
+    from a memory-mapped binary file.
+
+    The file is mapped into memory with QFile::map() and the points are read
+    from it on demand, so that a series can show a data set that is larger
+    than the available memory without copying it. Together with
+    QXYSeries::setDataProvider(), only the points needed for the visible part
+    of the chart are loaded into the series.
+
+    The file contains fixed-size records of native-endian \c float or
+    \c double values. The records start at offset() and are stride() bytes
+    apart. Within a record, the x value is at xOffset() and the y value at
+    yOffset(). By default the records are pairs of packed x and y values. A
+    file that holds the x values and the y values in two separate blocks can be
+    read by setting the stride to the size of one value and the y offset to
+    the start of the second block.
+
+    \code
+    QMappedXYDataProvider *provider = new QMappedXYDataProvider("capture.bin");
+    provider->setValueType(QMappedXYDataProvider::Float);
+    if (provider->open())
+        series->setDataProvider(provider);
+    \endcode
+
+    The x values must be in ascending order.
+
+    \sa QXYDataProvider, QXYSeries::setDataProvider()
+*/
+
+/*!
+    \enum QMappedXYDataProvider::ValueType
+
+    This enum describes the type of the values in the file.
+
+    \value Float The values are 32-bit floating point numbers.
+    \value Double The values are 64-bit floating point numbers.
+*/
+
+/*!
+    Constructs a provider for the file named \a fileName.
+    The file is not read until open() is called.
+*/
+QMappedXYDataProvider::QMappedXYDataProvider(const QString &fileName)
+    : d_ptr(new QMappedXYDataProviderPrivate())
+{
+    d_ptr->m_file.setFileName(fileName);
+}
+
+/*!
+    Destroys the provider and unmaps the file.
+*/
+QMappedXYDataProvider::~QMappedXYDataProvider()
+{
+    close();
+}
+
+/*!
+    Sets the name of the file to map to \a fileName. An open file is closed.
+*/
+void QMappedXYDataProvider::setFileName(const QString &fileName)
+{
+    close();
+    d_ptr->m_file.setFileName(fileName);
+}
+
+/*!
+    Returns the name of the mapped file.
+*/
+QString QMappedXYDataProvider::fileName() const
+{
+    return d_ptr->m_file.fileName();
+}
+
+/*!
+    Sets the type of the values to \a type. The default is \l Double.
+*/
+void QMappedXYDataProvider::setValueType(ValueType type)
+{
+    d_ptr->m_type = type;
+    d_ptr->updateCount();
+}
+
+/*!
+    Returns the type of the values.
+*/
+QMappedXYDataProvider::ValueType QMappedXYDataProvider::valueType() const
+{
+    return d_ptr->m_type;
+}
+
+/*!
+    Sets the position of the first record in the file to \a offset bytes,
+    for example to skip a header. The default is 0.
+*/
+void QMappedXYDataProvider::setOffset(qint64 offset)
+{
+    d_ptr->m_offset = qMax(qint64(0), offset);
+    d_ptr->updateCount();
+}
+
+/*!
+    Returns the position of the first record in bytes.
+*/
+qint64 QMappedXYDataProvider::offset() const
+{
+    return d_ptr->m_offset;
+}
+
+/*!
+    Sets the distance between the starts of consecutive records to \a stride
+    bytes. If \a stride is 0, which is the default, the records are packed
+    pairs of values and the stride is twice the size of a value.
+*/
+void QMappedXYDataProvider::setStride(qint64 stride)
+{
+    d_ptr->m_stride = qMax(qint64(0), stride);
+    d_ptr->updateCount();
+}
+
+/*!
+    Returns the distance between consecutive records in bytes.
+*/
+qint64 QMappedXYDataProvider::stride() const
+{
+    return d_ptr->stride();
+}
+
+/*!
+    Sets the position of the x value in each record to \a offset bytes.
+    The default is 0.
+*/
+void QMappedXYDataProvider::setXOffset(qint64 offset)
+{
+    d_ptr->m_xOffset = qMax(qint64(0), offset);
+    d_ptr->updateCount();
+}
+
+/*!
+    Returns the position of the x value in each record in bytes.
+*/
+qint64 QMappedXYDataProvider::xOffset() const
+{
+    return d_ptr->m_xOffset;
+}
+
+/*!
+    Sets the position of the y value in each record to \a offset bytes.
+    If \a offset is negative, which is the default, the y value directly
+    follows an x value at the start of the record.
+*/
+void QMappedXYDataProvider::setYOffset(qint64 offset)
+{
+    d_ptr->m_yOffset = qMax(qint64(-1), offset);
+    d_ptr->updateCount();
+}
+
+/*!
+    Returns the position of the y value in each record in bytes.
+*/
+qint64 QMappedXYDataProvider::yOffset() const
+{
+    return d_ptr->yOffset();
+}
+
+/*!
+    Opens and maps the file. Returns \c true on success; otherwise returns
+    \c false and errorString() describes the error.
+*/
+bool QMappedXYDataProvider::open()
+{
+    close();
+    if (!d_ptr->m_file.open(QIODevice::ReadOnly))
+        return false;
+    d_ptr->m_data = d_ptr->m_file.map(0, d_ptr->m_file.size());
+    if (!d_ptr->m_data) {
+        d_ptr->m_file.close();
+        return false;
+    }
+    d_ptr->updateCount();
+    return true;
+}
+
+/*!
+    Unmaps and closes the file. Series that use the provider must not read it
+    after this, so set another provider on them first.
+*/
+void QMappedXYDataProvider::close()
+{
+    if (d_ptr->m_data) {
+        d_ptr->m_file.unmap(d_ptr->m_data);
+        d_ptr->m_data = 0;
+    }
+    d_ptr->m_file.close();
+    d_ptr->m_count = 0;
+}
+
+/*!
+    Returns \c true if the file is mapped.
+*/
+bool QMappedXYDataProvider::isOpen() const
+{
+    return d_ptr->m_data;
+}
+
+/*!
+    Returns a description of the last error that occurred while opening the file.
+*/
+QString QMappedXYDataProvider::errorString() const
+{
+    return d_ptr->m_file.errorString();
+}
+
+/*!
+    Returns the number of complete records in the mapped file.
+*/
+int QMappedXYDataProvider::count() const
+{
+    return d_ptr->m_count;
+}
+
+/*!
+    Returns the point stored in the record at \a index.
+*/
+QPointF QMappedXYDataProvider::at(int index) const
+{
+    Q_ASSERT(index >= 0 && index < d_ptr->m_count);
+    const uchar *record = d_ptr->m_data + d_ptr->m_offset + index * d_ptr->stride();
+    return QPointF(d_ptr->value(record + d_ptr->m_xOffset), d_ptr->value(record + d_ptr->yOffset()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+QMappedXYDataProviderPrivate::QMappedXYDataProviderPrivate()
+    : m_data(0),
+      m_type(QMappedXYDataProvider::Double),
+      m_offset(0),
+      m_stride(0),
+      m_xOffset(0),
+      m_yOffset(-1),
+      m_count(0)
+{
+}
+
+qint64 QMappedXYDataProviderPrivate::valueSize() const
+{
+    return m_type == QMappedXYDataProvider::Float ? sizeof(float) : sizeof(double);
+}
+
+qint64 QMappedXYDataProviderPrivate::stride() const
+{
+    return m_stride > 0 ? m_stride : 2 * valueSize();
+}
+
+qint64 QMappedXYDataProviderPrivate::yOffset() const
+{
+    return m_yOffset >= 0 ? m_yOffset : m_xOffset + valueSize();
+}
+
+void QMappedXYDataProviderPrivate::updateCount()
+{
+    m_count = 0;
+    if (!m_data)
+        return;
+
+    // Only records whose both values are inside the file are counted
+    const qint64 available = m_file.size() - m_offset;
+    const qint64 recordEnd = qMax(m_xOffset, yOffset()) + valueSize();
+    if (available < recordEnd)
+        return;
+    const qint64 count = (available - recordEnd) / stride() + 1;
+    m_count = int(qMin(count, qint64(std::numeric_limits<int>::max())));
+}
+
+qreal QMappedXYDataProviderPrivate::value(const uchar *data) const
+{
+    // The mapped values are not necessarily aligned
+    if (m_type == QMappedXYDataProvider::Float) {
+        float value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+    double value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+QT_CHARTS_END_NAMESPACE
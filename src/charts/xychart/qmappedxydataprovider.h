@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QMAPPEDXYDATAPROVIDER_H
+#define QMAPPEDXYDATAPROVIDER_H
+
+#include <QtCharts/QXYDataProvider>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QString>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QMappedXYDataProviderPrivate;
+
+class QT_CHARTS_EXPORT QMappedXYDataProvider : public QXYDataProvider
+{
+public:
+    enum ValueType {
+        Float,
+        Double
+    };
+
+    explicit QMappedXYDataProvider(const QString &fileName = QString());
+    ~QMappedXYDataProvider();
+
+    void setFileName(const QString &fileName);
+    QString fileName() const;
+
+    void setValueType(ValueType type);
+    ValueType valueType() const;
+
+    void setOffset(qint64 offset);
+    qint64 offset() const;
+
+    void setStride(qint64 stride);
+    qint64 stride() const;
+
+    void setXOffset(qint64 offset);
+    qint64 xOffset() const;
+
+    void setYOffset(qint64 offset);
+    qint64 yOffset() const;
+
+    bool open();
+    void close();
+    bool isOpen() const;
+    QString errorString() const;
+
+    int count() const;
+    QPointF at(int index) const;
+
+private:
+    QScopedPointer<QMappedXYDataProviderPrivate> d_ptr;
+    Q_DISABLE_COPY(QMappedXYDataProvider)
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QMAPPEDXYDATAPROVIDER_H
@@ -0,0 +1,71 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef QMAPPEDXYDATAPROVIDER_P_H
+#define QMAPPEDXYDATAPROVIDER_P_H
+
+#include <QtCharts/QMappedXYDataProvider>
+#include <QtCore/QFile>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class QMappedXYDataProviderPrivate
+{
+public:
+    QMappedXYDataProviderPrivate();
+
+    qint64 valueSize() const;
+    qint64 stride() const;
+    qint64 yOffset() const;
+    void updateCount();
+    qreal value(const uchar *data) const;
+
+    QFile m_file;
+    uchar *m_data;
+    QMappedXYDataProvider::ValueType m_type;
+    qint64 m_offset;
+    qint64 m_stride;
+    qint64 m_xOffset;
+    qint64 m_yOffset;
+    int m_count;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // QMAPPEDXYDATAPROVIDER_P_H
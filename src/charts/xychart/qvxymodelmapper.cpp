@@ -145,6 +145,20 @@ QT_CHARTS_BEGIN_NAMESPACE
     -1 (the number is limited by the number of rows in the model).
 */
 
+/*!
+    \property QVXYModelMapper::dataRole
+    \brief The item data role that is used to read and write the data points.
+
+    The default value is Qt::DisplayRole.
+
+    \sa QChartModelColumns
+*/
+/*!
+    \qmlproperty int VXYModelMapper::dataRole
+    The item data role that is used to read and write the data points.
+    The default value is \c Qt.DisplayRole.
+*/
+
 /*!
     \fn void QVXYModelMapper::seriesReplaced()
 
@@ -181,6 +195,11 @@ QT_CHARTS_BEGIN_NAMESPACE
     This signal is emitted when the number of rows changes.
 */
 
+/*!
+    \fn void QVXYModelMapper::dataRoleChanged()
+    This signal is emitted when the data role changes.
+*/
+
 /*!
     Constructs a mapper object that is a child of \a parent.
 */
@@ -268,6 +287,19 @@ void QVXYModelMapper::setRowCount(int rowCount)
     }
 }
 
+int QVXYModelMapper::dataRole() const
+{
+    return QXYModelMapper::dataRole();
+}
+
+void QVXYModelMapper::setDataRole(int role)
+{
+    if (role != QXYModelMapper::dataRole()) {
+        QXYModelMapper::setDataRole(role);
+        emit dataRoleChanged();
+    }
+}
+
 #include "moc_qvxymodelmapper.cpp"
 
 QT_CHARTS_END_NAMESPACE
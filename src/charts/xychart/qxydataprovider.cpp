@@ -0,0 +1,68 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtCharts/QXYDataProvider>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QXYDataProvider
+    \inmodule QtCharts
+    \brief The QXYDataProvider class is an interface through which an XY series
+    reads points that it does not store itself.
+
+    A provider gives read-only access to a data set that is too large to be
+    copied into a series, for example a memory-mapped file. When a provider is
+    set with QXYSeries::setDataProvider(), the series only loads the points
+    that are needed to draw the visible part of the chart. The x values of the
+    points must be in ascending order.
+
+    \sa QMappedXYDataProvider, QXYSeries::setDataProvider()
+*/
+
+/*!
+    Destroys the provider.
+*/
+QXYDataProvider::~QXYDataProvider()
+{
+}
+
+/*!
+    \fn int QXYDataProvider::count() const
+    Returns the number of points the provider holds.
+*/
+
+/*!
+    \fn QPointF QXYDataProvider::at(int index) const
+    Returns the point at the position specified by \a index.
+    The index is always between 0 and count() - 1.
+*/
+
+QT_CHARTS_END_NAMESPACE
@@ -29,10 +29,13 @@
 
 #include <QtCharts/QXYModelMapper>
 #include <private/qxymodelmapper_p.h>
+#include <private/charthelpers_p.h>
 #include <QtCharts/QXYSeries>
+#include <QtCharts/QChartModelColumns>
 #include <QtCore/QAbstractItemModel>
 #include <QtCore/QDateTime>
 #include <QtCore/QDebug>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -211,6 +214,25 @@ void QXYModelMapper::setYSection(int ySection)
     d->initializeXYFromModel();
 }
 
+/*!
+    Returns the item data role that is used to read and write the values of the model.
+*/
+int QXYModelMapper::dataRole() const
+{
+    Q_D(const QXYModelMapper);
+    return d->m_role;
+}
+
+/*!
+    Sets the item data role that is used to read and write the values of the model to \a role.
+*/
+void QXYModelMapper::setDataRole(int role)
+{
+    Q_D(QXYModelMapper);
+    d->m_role = role;
+    d->initializeXYFromModel();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QXYModelMapperPrivate::QXYModelMapperPrivate(QXYModelMapper *q) :
@@ -222,6 +244,7 @@ QXYModelMapperPrivate::QXYModelMapperPrivate(QXYModelMapper *q) :
     m_orientation(Qt::Vertical),
     m_xSection(-1),
     m_ySection(-1),
+    m_role(Qt::DisplayRole),
     m_seriesSignalsBlock(false),
     m_modelSignalsBlock(false),
     q_ptr(q)
@@ -262,7 +285,7 @@ QModelIndex QXYModelMapperPrivate::yModelIndex(int yPos)
 
 qreal QXYModelMapperPrivate::valueFromModel(QModelIndex index)
 {
-    QVariant value = m_model->data(index, Qt::DisplayRole);
+    QVariant value = m_model->data(index, m_role);
     switch (value.type()) {
     case QVariant::DateTime:
         return value.toDateTime().toMSecsSinceEpoch();
@@ -275,16 +298,100 @@ qreal QXYModelMapperPrivate::valueFromModel(QModelIndex index)
 
 void QXYModelMapperPrivate::setValueToModel(QModelIndex index, qreal value)
 {
-    QVariant oldValue = m_model->data(index, Qt::DisplayRole);
+    QVariant oldValue = m_model->data(index, m_role);
     switch (oldValue.type()) {
     case QVariant::DateTime:
-        m_model->setData(index, QDateTime::fromMSecsSinceEpoch(value));
+        m_model->setData(index, QDateTime::fromMSecsSinceEpoch(value), m_role);
         break;
     case QVariant::Date:
-        m_model->setData(index, QDateTime::fromMSecsSinceEpoch(value).date());
+        m_model->setData(index, QDateTime::fromMSecsSinceEpoch(value).date(), m_role);
         break;
     default:
-        m_model->setData(index, value);
+        m_model->setData(index, value, m_role);
+    }
+}
+
+// Returns true if any section between first and last is mapped to x or y.
+bool QXYModelMapperPrivate::sectionChanged(int first, int last) const
+{
+    return (m_xSection >= first && m_xSection <= last) || (m_ySection >= first && m_ySection <= last);
+}
+
+// Reads up to count points starting from pointPos, or all available points if count is -1.
+// Reading stops at the first invalid model index, points with invalid values are skipped
+// just like the series would skip them.
+QVector<QPointF> QXYModelMapperPrivate::pointsFromModel(int pointPos, int count)
+{
+    QVector<QPointF> points;
+    if (!xModelIndex(pointPos).isValid() || !yModelIndex(pointPos).isValid())
+        return points;
+
+    // Copy the values directly if the model exposes both sections as arrays.
+    if (QChartModelColumns *columns = qobject_cast<QChartModelColumns *>(m_model)) {
+        int xStride = 1;
+        int yStride = 1;
+        const qreal *x = sectionData(columns, m_xSection, &xStride);
+        const qreal *y = sectionData(columns, m_ySection, &yStride);
+        if (x && y) {
+            int available = (m_orientation == Qt::Vertical ? m_model->rowCount() : m_model->columnCount())
+                    - m_first - pointPos;
+            if (m_count != -1)
+                available = qMin(available, m_count - pointPos);
+            if (count != -1)
+                available = qMin(available, count);
+            x += (m_first + pointPos) * xStride;
+            y += (m_first + pointPos) * yStride;
+            points.reserve(available);
+            for (int i = 0; i < available; i++) {
+                const QPointF point(x[i * xStride], y[i * yStride]);
+                if (isValidValue(point))
+                    points.append(point);
+            }
+            return points;
+        }
+    }
+
+    if (count > 0)
+        points.reserve(count);
+    for (int i = pointPos; count == -1 || i < pointPos + count; i++) {
+        QModelIndex xIndex = xModelIndex(i);
+        QModelIndex yIndex = yModelIndex(i);
+        if (!xIndex.isValid() || !yIndex.isValid())
+            break;
+        const QPointF point(valueFromModel(xIndex), valueFromModel(yIndex));
+        if (isValidValue(point))
+            points.append(point);
+    }
+    return points;
+}
+
+const qreal *QXYModelMapperPrivate::sectionData(QChartModelColumns *columns, int section, int *stride) const
+{
+    if (m_orientation == Qt::Vertical)
+        return columns->columnData(section, m_role, stride);
+    else
+        return columns->rowData(section, m_role, stride);
+}
+
+// Inserts points to the series at pointPos and drops the points above m_count.
+// More than one point is applied with a single pointsReplaced notification.
+void QXYModelMapperPrivate::insertPoints(int pointPos, const QVector<QPointF> &points)
+{
+    if (points.isEmpty())
+        return;
+
+    if (points.size() == 1) {
+        m_series->insert(pointPos, points.first());
+        if (m_count != -1 && m_series->count() > m_count)
+            m_series->removePoints(m_count, m_series->count() - m_count);
+    } else {
+        QVector<QPointF> newPoints = m_series->pointsVector();
+        pointPos = qBound(0, pointPos, newPoints.size());
+        newPoints.insert(pointPos, points.size(), QPointF());
+        std::copy(points.constBegin(), points.constEnd(), newPoints.begin() + pointPos);
+        if (m_count != -1 && newPoints.size() > m_count)
+            newPoints.resize(m_count);
+        m_series->replace(newPoints);
     }
 }
 
@@ -302,8 +409,8 @@ void QXYModelMapperPrivate::handlePointAdded(int pointPos)
     else
         m_model->insertColumns(pointPos + m_first, 1);
 
-    setValueToModel(xModelIndex(pointPos), m_series->points().at(pointPos).x());
-    setValueToModel(yModelIndex(pointPos), m_series->points().at(pointPos).y());
+    setValueToModel(xModelIndex(pointPos), m_series->at(pointPos).x());
+    setValueToModel(yModelIndex(pointPos), m_series->at(pointPos).y());
     blockModelSignals(false);
 }
 
@@ -347,8 +454,8 @@ void QXYModelMapperPrivate::handlePointReplaced(int pointPos)
         return;
 
     blockModelSignals();
-    setValueToModel(xModelIndex(pointPos), m_series->points().at(pointPos).x());
-    setValueToModel(yModelIndex(pointPos), m_series->points().at(pointPos).y());
+    setValueToModel(xModelIndex(pointPos), m_series->at(pointPos).x());
+    setValueToModel(yModelIndex(pointPos), m_series->at(pointPos).y());
     blockModelSignals(false);
 }
 
@@ -365,37 +472,52 @@ void QXYModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex bottom
     if (m_modelSignalsBlock)
         return;
 
+    // Find the range of points touched by the changed cells, if any.
+    int first;
+    int last;
+    if (m_orientation == Qt::Vertical) {
+        if (!sectionChanged(topLeft.column(), bottomRight.column()))
+            return;
+        first = topLeft.row() - m_first;
+        last = bottomRight.row() - m_first;
+    } else {
+        if (!sectionChanged(topLeft.row(), bottomRight.row()))
+            return;
+        first = topLeft.column() - m_first;
+        last = bottomRight.column() - m_first;
+    }
+    first = qMax(first, 0);
+    last = qMin(last, m_series->count() - 1);
+    if (m_count != -1)
+        last = qMin(last, m_count - 1);
+    if (first > last)
+        return;
+
     blockSeriesSignals();
-    QModelIndex index;
-    QPointF oldPoint;
-    QPointF newPoint;
-    for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
-        for (int column = topLeft.column(); column <= bottomRight.column(); column++) {
-            index = topLeft.sibling(row, column);
-            if (m_orientation == Qt::Vertical && (index.column() == m_xSection || index.column() == m_ySection)) {
-                if (index.row() >= m_first && (m_count == - 1 || index.row() < m_first + m_count)) {
-                    QModelIndex xIndex = xModelIndex(index.row() - m_first);
-                    QModelIndex yIndex = yModelIndex(index.row() - m_first);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        oldPoint = m_series->points().at(index.row() - m_first);
-                        newPoint.setX(valueFromModel(xIndex));
-                        newPoint.setY(valueFromModel(yIndex));
-                        m_series->replace(index.row() - m_first, newPoint);
-                    }
-                }
-            } else if (m_orientation == Qt::Horizontal && (index.row() == m_xSection || index.row() == m_ySection)) {
-                if (index.column() >= m_first && (m_count == - 1 || index.column() < m_first + m_count)) {
-                    QModelIndex xIndex = xModelIndex(index.column() - m_first);
-                    QModelIndex yIndex = yModelIndex(index.column() - m_first);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        oldPoint = m_series->points().at(index.column() - m_first);
-                        newPoint.setX(valueFromModel(xIndex));
-                        newPoint.setY(valueFromModel(yIndex));
-                        m_series->replace(index.column() - m_first, newPoint);
-                    }
+    if (first == last) {
+        const QVector<QPointF> points = pointsFromModel(first, 1);
+        if (!points.isEmpty())
+            m_series->replace(first, points.first());
+    } else {
+        // Read the whole range into the current points and hand it to the series at once,
+        // so that a large dataChanged causes a single pointsReplaced notification.
+        QVector<QPointF> points = m_series->pointsVector();
+        const QVector<QPointF> changed = pointsFromModel(first, last - first + 1);
+        if (changed.size() == last - first + 1) {
+            std::copy(changed.constBegin(), changed.constEnd(), points.begin() + first);
+        } else {
+            // Some values were invalid, keep the old points for them.
+            for (int i = first; i <= last; i++) {
+                QModelIndex xIndex = xModelIndex(i);
+                QModelIndex yIndex = yModelIndex(i);
+                if (xIndex.isValid() && yIndex.isValid()) {
+                    const QPointF point(valueFromModel(xIndex), valueFromModel(yIndex));
+                    if (isValidValue(point))
+                        points[i] = point;
                 }
             }
         }
+        m_series->replace(points);
     }
     blockSeriesSignals(false);
 }
@@ -474,22 +596,7 @@ void QXYModelMapperPrivate::insertData(int start, int end)
             addedCount = m_count;
         int first = qMax(start, m_first);
         int last = qMin(first + addedCount - 1, m_orientation == Qt::Vertical ? m_model->rowCount() - 1 : m_model->columnCount() - 1);
-        for (int i = first; i <= last; i++) {
-            QPointF point;
-            QModelIndex xIndex = xModelIndex(i - m_first);
-            QModelIndex yIndex = yModelIndex(i - m_first);
-            if (xIndex.isValid() && yIndex.isValid()) {
-                point.setX(valueFromModel(xIndex));
-                point.setY(valueFromModel(yIndex));
-                m_series->insert(i - m_first, point);
-            }
-        }
-
-        // remove excess of points (above m_count)
-        if (m_count != -1 && m_series->points().size() > m_count)
-            for (int i = m_series->points().size() - 1; i >= m_count; i--) {
-                m_series->remove(m_series->points().at(i));
-            }
+        insertPoints(first - m_first, pointsFromModel(first - m_first, last - first + 1));
     }
 }
 
@@ -505,9 +612,8 @@ void QXYModelMapperPrivate::removeData(int start, int end)
         int toRemove = qMin(m_series->count(), removedCount);     // first find how many items can actually be removed
         int first = qMax(start, m_first);    // get the index of the first item that will be removed.
         int last = qMin(first + toRemove - 1, m_series->count() + m_first - 1);    // get the index of the last item that will be removed.
-        for (int i = last; i >= first; i--) {
-            m_series->remove(m_series->points().at(i - m_first));
-        }
+        if (last >= first)
+            m_series->removePoints(first - m_first, last - first + 1);
 
         if (m_count != -1) {
             int itemsAvailable;     // check how many are available to be added
@@ -516,18 +622,8 @@ void QXYModelMapperPrivate::removeData(int start, int end)
             else
                 itemsAvailable = m_model->columnCount() - m_first - m_series->count();
             int toBeAdded = qMin(itemsAvailable, m_count - m_series->count());     // add not more items than there is space left to be filled.
-            int currentSize = m_series->count();
             if (toBeAdded > 0)
-                for (int i = m_series->count(); i < currentSize + toBeAdded; i++) {
-                    QPointF point;
-                    QModelIndex xIndex = xModelIndex(i);
-                    QModelIndex yIndex = yModelIndex(i);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        point.setX(valueFromModel(xIndex));
-                        point.setY(valueFromModel(yIndex));
-                        m_series->insert(i, point);
-                    }
-                }
+                insertPoints(m_series->count(), pointsFromModel(m_series->count(), toBeAdded));
         }
     }
 }
@@ -538,34 +634,18 @@ void QXYModelMapperPrivate::initializeXYFromModel()
         return;
 
     blockSeriesSignals();
-    // clear current content
-    m_series->clear();
-
-    // create the initial points set
-    int pointPos = 0;
-    QModelIndex xIndex = xModelIndex(pointPos);
-    QModelIndex yIndex = yModelIndex(pointPos);
-
-    if (xIndex.isValid() && yIndex.isValid()) {
-        while (xIndex.isValid() && yIndex.isValid()) {
-            QPointF point;
-            point.setX(valueFromModel(xIndex));
-            point.setY(valueFromModel(yIndex));
-            m_series->append(point);
-            pointPos++;
-            xIndex = xModelIndex(pointPos);
-            yIndex = yModelIndex(pointPos);
-            // Don't warn about invalid index after the first, those are valid and used to
-            // determine when we should end looping.
-        }
-    } else {
+    // Replace the current content with the initial points set in one go.
+    const QVector<QPointF> points = pointsFromModel(0, -1);
+    m_series->replace(points);
+
+    if (points.isEmpty()) {
         // Invalid index right off the bat means series will be left empty, so output a warning,
         // unless model is also empty
         int count = m_orientation == Qt::Vertical ? m_model->rowCount() : m_model->columnCount();
         if (count > 0) {
-            if (!xIndex.isValid())
+            if (!xModelIndex(0).isValid())
                 qWarning() << __FUNCTION__ << QStringLiteral("Invalid X coordinate index in model mapper.");
-            else if (!yIndex.isValid())
+            else if (!yModelIndex(0).isValid())
                 qWarning() << __FUNCTION__ << QStringLiteral("Invalid Y coordinate index in model mapper.");
         }
     }
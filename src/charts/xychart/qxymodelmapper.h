@@ -70,6 +70,9 @@ protected:
     int ySection() const;
     void setYSection(int ySection);
 
+    int dataRole() const;
+    void setDataRole(int role);
+
 protected:
     QXYModelMapperPrivate *const d_ptr;
     Q_DECLARE_PRIVATE(QXYModelMapper)
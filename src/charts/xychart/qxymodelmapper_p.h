@@ -42,16 +42,18 @@
 #include <QtCharts/QXYModelMapper>
 #include <QtCharts/private/qchartglobal_p.h>
 #include <QtCore/QObject>
+#include <QtCore/QVector>
+#include <QtCore/QPointF>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
 class QAbstractItemModel;
-class QPointF;
 QT_END_NAMESPACE
 
 QT_CHARTS_BEGIN_NAMESPACE
 
 class QXYModelMapper;
+class QChartModelColumns;
 class QXYSeries;
 
 class QT_CHARTS_PRIVATE_EXPORT QXYModelMapperPrivate : public QObject
@@ -84,6 +86,10 @@ private:
     QModelIndex yModelIndex(int yPos);
     void insertData(int start, int end);
     void removeData(int start, int end);
+    bool sectionChanged(int first, int last) const;
+    QVector<QPointF> pointsFromModel(int pointPos, int count);
+    const qreal *sectionData(QChartModelColumns *columns, int section, int *stride) const;
+    void insertPoints(int pointPos, const QVector<QPointF> &points);
     void blockModelSignals(bool block = true);
     void blockSeriesSignals(bool block = true);
     qreal valueFromModel(QModelIndex index);
@@ -97,6 +103,7 @@ private:
     Qt::Orientation m_orientation;
     int m_xSection;
     int m_ySection;
+    int m_role;
     bool m_seriesSignalsBlock;
     bool m_modelSignalsBlock;
 
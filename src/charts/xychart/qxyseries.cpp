@@ -35,6 +35,8 @@
 #include <QtCharts/QXYLegendMarker>
 #include <private/charthelpers_p.h>
 #include <private/qchart_p.h>
+#include <QtCharts/QXYDataProvider>
+#include <QtCore/QtMath>
 #include <QtGui/QPainter>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -476,6 +478,22 @@ QT_CHARTS_BEGIN_NAMESPACE
     at the position specified by \a index.
 */
 
+/*!
+    \qmlmethod XYSeries::appendPoints(values xValues, values yValues)
+    Appends several points to the series with a single pointsReplaced notification.
+    The coordinates can be given as JavaScript arrays, typed arrays such as
+    \c Float64Array, or an \c ArrayBuffer holding 64-bit floating point values.
+    This is much faster than appending the points one by one.
+    If \a yValues is omitted, \a xValues holds interleaved x and y coordinates.
+    Points with invalid coordinates are skipped.
+*/
+
+/*!
+    \qmlmethod XYSeries::replacePoints(values xValues, values yValues)
+    Replaces all the points of the series with a single pointsReplaced notification.
+    The coordinates are given in the same way as for appendPoints().
+*/
+
 /*!
     \qmlmethod XYSeries::insert(int index, real x, real y)
     Inserts a point with the coordinates \a x and \a y to the position specified
@@ -703,6 +721,47 @@ QList<QPointF> QXYSeries::points() const
     return d->m_points.toList();
 }
 
+/*!
+    Sets the provider from which the series reads its points to \a provider.
+    The series does not take ownership of the provider, which must stay valid
+    until another provider is set or the series is destroyed.
+
+    Instead of copying all points of the provider, the series holds only the
+    points needed to draw the visible x range at the resolution of the plot
+    area. Where there are more points than pixels, the first, last, lowest and
+    highest point of each group of points that share a pixel column are kept.
+    The points are loaded again whenever the visible range or the size of the
+    plot area changes, replacing any points added to the series directly. The
+    x values of the provider must be in ascending order.
+
+    Setting a provider again reloads the points, which is needed after the data
+    of the provider changes. Setting a null provider keeps the points last loaded.
+
+    \sa QXYDataProvider, QMappedXYDataProvider, pointsReplaced()
+*/
+void QXYSeries::setDataProvider(QXYDataProvider *provider)
+{
+    Q_D(QXYSeries);
+    d->m_dataProvider = provider;
+    d->m_providerFirst = -1;
+    d->m_providerLast = -1;
+    d->m_providerBuckets = 0;
+    if (provider)
+        d->loadProviderPoints();
+}
+
+/*!
+    Returns the provider from which the series reads its points, or \c nullptr
+    if the series holds its own points.
+
+    \sa setDataProvider()
+*/
+QXYDataProvider *QXYSeries::dataProvider() const
+{
+    Q_D(const QXYSeries);
+    return d->m_dataProvider;
+}
+
 /*!
     Returns the points in the series as a vector.
     This is more efficient than calling points().
@@ -925,8 +984,138 @@ QXYSeriesPrivate::QXYSeriesPrivate(QXYSeries *q)
       m_pointLabelsVisible(false),
       m_pointLabelsFont(QChartPrivate::defaultFont()),
       m_pointLabelsColor(QChartPrivate::defaultPen().color()),
-      m_pointLabelsClipping(true)
+      m_pointLabelsClipping(true),
+      m_dataProvider(0),
+      m_providerFirst(-1),
+      m_providerLast(-1),
+      m_providerBuckets(0)
+{
+    QObject::connect(m_domain.data(), SIGNAL(updated()), this, SLOT(handleDomainUpdated()));
+}
+
+void QXYSeriesPrivate::setDomain(AbstractDomain *domain)
+{
+    // Connect before the chart item, so that the item draws the points of the new range
+    if (m_domain.data() != domain) {
+        QObject::disconnect(m_domain.data(), SIGNAL(updated()), this, SLOT(handleDomainUpdated()));
+        QObject::connect(domain, SIGNAL(updated()), this, SLOT(handleDomainUpdated()));
+    }
+    QAbstractSeriesPrivate::setDomain(domain);
+}
+
+void QXYSeriesPrivate::handleDomainUpdated()
+{
+    if (m_dataProvider)
+        loadProviderPoints();
+}
+
+void QXYSeriesPrivate::loadProviderPoints()
+{
+    Q_Q(QXYSeries);
+
+    // Until the chart is laid out the whole data set is loaded at a default resolution.
+    // Afterwards only the visible points and their neighbors are, at about a pixel per bucket.
+    const int count = m_dataProvider->count();
+    int first = 0;
+    int last = count;
+    int buckets = 1024;
+    const AbstractDomain *domain = m_domain.data();
+    if (!domain->isEmpty()) {
+        first = qMax(0, providerLowerBound(domain->minX()) - 1);
+        last = qMin(count, providerUpperBound(domain->maxX()) + 1);
+        buckets = qMax(1, qCeil(domain->size().width()));
+    }
+    if (first == m_providerFirst && last == m_providerLast && buckets == m_providerBuckets)
+        return;
+
+    m_providerFirst = first;
+    m_providerLast = last;
+    m_providerBuckets = buckets;
+    q->replace(providerPoints(first, last, buckets));
+}
+
+QVector<QPointF> QXYSeriesPrivate::providerPoints(int first, int last, int buckets) const
+{
+    QVector<QPointF> points;
+    const int count = last - first;
+    if (count <= 4 * buckets) {
+        points.reserve(count);
+        for (int i = first; i < last; i++)
+            points.append(m_dataProvider->at(i));
+        return points;
+    }
+
+    // Keep the first, last, lowest and highest point of each bucket, so that a line through
+    // the kept points covers the same pixels as a line through all of them.
+    points.reserve(4 * buckets);
+    for (int bucket = 0; bucket < buckets; bucket++) {
+        const int begin = first + int(qint64(count) * bucket / buckets);
+        const int end = first + int(qint64(count) * (bucket + 1) / buckets);
+        const QPointF firstPoint = m_dataProvider->at(begin);
+        QPointF lastPoint = firstPoint;
+        QPointF minPoint = firstPoint;
+        QPointF maxPoint = firstPoint;
+        int minIndex = begin;
+        int maxIndex = begin;
+        for (int i = begin + 1; i < end; i++) {
+            lastPoint = m_dataProvider->at(i);
+            if (lastPoint.y() < minPoint.y()) {
+                minPoint = lastPoint;
+                minIndex = i;
+            } else if (lastPoint.y() > maxPoint.y()) {
+                maxPoint = lastPoint;
+                maxIndex = i;
+            }
+        }
+
+        points.append(firstPoint);
+        if (minIndex < maxIndex) {
+            if (minIndex != begin)
+                points.append(minPoint);
+            if (maxIndex != end - 1)
+                points.append(maxPoint);
+        } else if (maxIndex < minIndex) {
+            if (maxIndex != begin)
+                points.append(maxPoint);
+            if (minIndex != end - 1)
+                points.append(minPoint);
+        }
+        if (end - 1 != begin)
+            points.append(lastPoint);
+    }
+    return points;
+}
+
+int QXYSeriesPrivate::providerLowerBound(qreal x) const
 {
+    int first = 0;
+    int count = m_dataProvider->count();
+    while (count > 0) {
+        const int step = count / 2;
+        if (m_dataProvider->at(first + step).x() < x) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+int QXYSeriesPrivate::providerUpperBound(qreal x) const
+{
+    int first = 0;
+    int count = m_dataProvider->count();
+    while (count > 0) {
+        const int step = count / 2;
+        if (!(x < m_dataProvider->at(first + step).x())) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
 }
 
 void QXYSeriesPrivate::initializeDomain()
@@ -43,6 +43,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 
 class QXYSeriesPrivate;
 class QXYModelMapper;
+class QXYDataProvider;
 
 class QT_CHARTS_EXPORT QXYSeries : public QAbstractSeries
 {
@@ -112,6 +113,9 @@ public:
     void replace(QList<QPointF> points);
     void replace(QVector<QPointF> points);
 
+    void setDataProvider(QXYDataProvider *provider);
+    QXYDataProvider *dataProvider() const;
+
 Q_SIGNALS:
     void clicked(const QPointF &point);
     void hovered(const QPointF &point, bool state);
@@ -46,6 +46,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 
 class QXYSeries;
 class QAbstractAxis;
+class QXYDataProvider;
 
 class QT_CHARTS_PRIVATE_EXPORT QXYSeriesPrivate: public QAbstractSeriesPrivate
 {
@@ -67,6 +68,15 @@ public:
     void drawSeriesPointLabels(QPainter *painter, const QVector<QPointF> &points,
                                const int offset = 0);
 
+    void setDomain(AbstractDomain *domain);
+    void loadProviderPoints();
+    QVector<QPointF> providerPoints(int first, int last, int buckets) const;
+    int providerLowerBound(qreal x) const;
+    int providerUpperBound(qreal x) const;
+
+private Q_SLOTS:
+    void handleDomainUpdated();
+
 Q_SIGNALS:
     void updated();
 
@@ -80,6 +90,11 @@ protected:
     QFont m_pointLabelsFont;
     QColor m_pointLabelsColor;
     bool m_pointLabelsClipping;
+    QXYDataProvider *m_dataProvider;
+    // Range and resolution of the points last loaded from the data provider
+    int m_providerFirst;
+    int m_providerLast;
+    int m_providerBuckets;
 
 private:
     Q_DECLARE_PUBLIC(QXYSeries)
@@ -46,7 +46,8 @@ XYChart::XYChart(QXYSeries *series, QGraphicsItem *item):
       ChartItem(series->d_func(),item),
       m_series(series),
       m_animation(0),
-      m_dirty(true)
+      m_dirty(true),
+      m_replacedWhileTranslating(false)
 {
     QObject::connect(series, SIGNAL(pointReplaced(int)), this, SLOT(handlePointReplaced(int)));
     QObject::connect(series, SIGNAL(pointsReplaced()), this, SLOT(handlePointsReplaced()));
@@ -121,6 +122,16 @@ void XYChart::updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoin
     }
 }
 
+// Called instead of recalculating the geometry when the domain was only panned.
+// Subclasses that cache paths can translate them instead of rebuilding.
+void XYChart::translateChart(const QPointF &offset)
+{
+    QVector<QPointF> points = m_points;
+    for (int i = 0; i < points.size(); ++i)
+        points[i] += offset;
+    updateChart(m_points, points);
+}
+
 void XYChart::updateGlChart()
 {
     dataSet()->glXYSeriesDataManager()->setPoints(m_series, domain());
@@ -230,6 +241,9 @@ void XYChart::handlePointsReplaced()
         // All the points were replaced -> recalculate
         QVector<QPointF> points = domain()->calculateGeometryPoints(m_series->pointsVector());
         updateChart(m_points, points, -1);
+        // A series backed by a data provider reloads its points from the domain update that
+        // is being emitted, before this item gets it. The geometry is then already panned.
+        m_replacedWhileTranslating = domain()->isTranslating();
     }
 }
 
@@ -238,7 +252,17 @@ void XYChart::handleDomainUpdated()
     if (m_series->useOpenGL()) {
         updateGlChart();
     } else {
+        const bool replaced = m_replacedWhileTranslating;
+        m_replacedWhileTranslating = false;
         if (isEmpty()) return;
+        if (replaced && domain()->isTranslating())
+            return;
+        // Animations leave intermediate points in m_points, so only reuse settled geometry.
+        if (domain()->isTranslating() && m_points.size() == m_series->count()
+                && (!m_animation || m_animation->state() == QAbstractAnimation::Stopped)) {
+            translateChart(domain()->translation());
+            return;
+        }
         QVector<QPointF> points = domain()->calculateGeometryPoints(m_series->pointsVector());
         updateChart(m_points, points);
     }
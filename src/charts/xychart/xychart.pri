@@ -6,16 +6,21 @@ SOURCES += \
     $$PWD/qxymodelmapper.cpp \
     $$PWD/qvxymodelmapper.cpp \
     $$PWD/qhxymodelmapper.cpp  \
-    $$PWD/glxyseriesdata.cpp
+    $$PWD/glxyseriesdata.cpp \
+    $$PWD/qxydataprovider.cpp \
+    $$PWD/qmappedxydataprovider.cpp
 
 PRIVATE_HEADERS += \
     $$PWD/xychart_p.h \
     $$PWD/qxyseries_p.h \
     $$PWD/qxymodelmapper_p.h \
-    $$PWD/glxyseriesdata_p.h
+    $$PWD/glxyseriesdata_p.h \
+    $$PWD/qmappedxydataprovider_p.h
 
 PUBLIC_HEADERS += \
     $$PWD/qxyseries.h \
     $$PWD/qxymodelmapper.h \
     $$PWD/qvxymodelmapper.h \
-    $$PWD/qhxymodelmapper.h
+    $$PWD/qhxymodelmapper.h \
+    $$PWD/qxydataprovider.h \
+    $$PWD/qmappedxydataprovider.h
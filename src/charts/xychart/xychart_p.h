@@ -88,6 +88,7 @@ Q_SIGNALS:
 
 protected:
     virtual void updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index = -1);
+    virtual void translateChart(const QPointF &offset);
     virtual void updateGlChart();
     virtual void refreshGlChart();
 
@@ -99,6 +100,7 @@ protected:
     QVector<QPointF> m_points;
     XYAnimation *m_animation;
     bool m_dirty;
+    bool m_replacedWhileTranslating;
 
     friend class AreaChartItem;
 };
@@ -26,6 +26,7 @@ SOURCES += \
     declarativepolarchart.cpp \
     declarativeboxplotseries.cpp \
     declarativechartnode.cpp \
+    declarativechartrasterizer.cpp \
     declarativecandlestickseries.cpp
 
 PRIVATE_HEADERS += \
@@ -46,6 +47,7 @@ PRIVATE_HEADERS += \
     declarativecandlestickseries_p.h \
     declarativeabstractrendernode_p.h \
     declarativechartnode_p.h \
+    declarativechartrasterizer_p.h \
     declarativechartglobal_p.h
 
 contains(QT_CONFIG, opengl) {
@@ -350,6 +350,12 @@ public:
             QLatin1String("Trying to create uncreatable: CandlestickModelMapper."));
         qmlRegisterType<QHCandlestickModelMapper>(uri, 2, 2, "HCandlestickModelMapper");
         qmlRegisterType<QVCandlestickModelMapper>(uri, 2, 2, "VCandlestickModelMapper");
+
+        // QtCharts 2.3
+        qmlRegisterType<DeclarativeChart, 6>(uri, 2, 3, "ChartView");
+        qmlRegisterType<DeclarativeScatterSeries, 6>(uri, 2, 3, "ScatterSeries");
+        qmlRegisterType<DeclarativeLineSeries, 5>(uri, 2, 3, "LineSeries");
+        qmlRegisterType<DeclarativeSplineSeries, 5>(uri, 2, 3, "SplineSeries");
     }
 
 };
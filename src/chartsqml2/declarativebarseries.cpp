@@ -39,6 +39,7 @@ DeclarativeBarSet::DeclarativeBarSet(QObject *parent)
 {
     connect(this, SIGNAL(valuesAdded(int,int)), this, SLOT(handleCountChanged(int,int)));
     connect(this, SIGNAL(valuesRemoved(int,int)), this, SLOT(handleCountChanged(int,int)));
+    connect(this, SIGNAL(valuesReplaced()), this, SLOT(handleValuesReplaced()));
     connect(this, SIGNAL(brushChanged()), this, SLOT(handleBrushChanged()));
 }
 
@@ -49,6 +50,11 @@ void DeclarativeBarSet::handleCountChanged(int index, int count)
     emit countChanged(QBarSet::count());
 }
 
+void DeclarativeBarSet::handleValuesReplaced()
+{
+    emit countChanged(QBarSet::count());
+}
+
 qreal DeclarativeBarSet::borderWidth() const
 {
     return pen().widthF();
@@ -74,8 +80,7 @@ QVariantList DeclarativeBarSet::values()
 
 void DeclarativeBarSet::setValues(QVariantList values)
 {
-    while (count())
-        remove(count() - 1);
+    QVector<qreal> newValues;
 
     if (values.count() > 0 && values.at(0).canConvert(QVariant::Point)) {
         // Create list of values for appending if the first item is Qt.point
@@ -87,24 +92,22 @@ void DeclarativeBarSet::setValues(QVariantList values)
             }
         }
 
-        QVector<qreal> indexValueList;
-        indexValueList.resize(maxValue + 1);
+        newValues.resize(maxValue + 1);
 
         for (int i = 0; i < values.count(); i++) {
             if (values.at(i).canConvert(QVariant::Point)) {
-                indexValueList.replace(values.at(i).toPoint().x(), values.at(i).toPointF().y());
+                newValues.replace(values.at(i).toPoint().x(), values.at(i).toPointF().y());
             }
         }
-
-        for (int i = 0; i < indexValueList.count(); i++)
-            QBarSet::append(indexValueList.at(i));
-
     } else {
+        newValues.reserve(values.count());
         for (int i(0); i < values.count(); i++) {
             if (values.at(i).canConvert(QVariant::Double))
-                QBarSet::append(values[i].toDouble());
+                newValues.append(values[i].toDouble());
         }
     }
+
+    QBarSet::replace(std::move(newValues));
 }
 
 QString DeclarativeBarSet::brushFilename() const
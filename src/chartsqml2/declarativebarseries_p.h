@@ -86,6 +86,7 @@ Q_SIGNALS:
 
 private Q_SLOTS:
     void handleCountChanged(int index, int count);
+    void handleValuesReplaced();
     void handleBrushChanged();
 
 private:
@@ -157,8 +157,8 @@ bool DeclarativeCandlestickSeries::append(qreal open, qreal high, qreal low, qre
 
 bool DeclarativeCandlestickSeries::remove(qreal timestamp)
 {
-    for (int i = 0; i < count(); ++i) {
-        QCandlestickSet *set = sets().at(i);
+    const QList<QCandlestickSet *> sets = this->sets();
+    for (QCandlestickSet *set : sets) {
         if (set->timestamp() == timestamp)
             return QCandlestickSeries::remove(set);
     }
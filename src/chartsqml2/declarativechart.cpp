@@ -29,6 +29,7 @@
 
 #include "declarativechart_p.h"
 #include <QtGui/QPainter>
+#include <QtGui/QPicture>
 #include "declarativelineseries_p.h"
 #include "declarativeareaseries_p.h"
 #include "declarativebarseries_p.h"
@@ -38,6 +39,7 @@
 #include "declarativecandlestickseries_p.h"
 #include "declarativescatterseries_p.h"
 #include "declarativechartnode_p.h"
+#include "declarativechartrasterizer_p.h"
 #include "declarativeabstractrendernode_p.h"
 #include <QtCharts/QBarCategoryAxis>
 #include <QtCharts/QValueAxis>
@@ -207,6 +209,20 @@ QT_CHARTS_BEGIN_NAMESPACE
  \c false, it is disabled.
 */
 
+/*!
+  \qmlproperty bool ChartView::threadedRendering
+  \since QtCharts 2.3
+
+  Whether the chart is rasterized in a separate thread.
+
+  When \c true, the changed parts of the chart are recorded on the GUI thread
+  and painted into a second image in a render thread, so that rasterizing
+  heavy charts does not block animations and input handling. The finished
+  image is shown once it is ready, and changes made meanwhile are rendered
+  after it. While the background drop shadow is enabled, the chart is
+  rendered on the GUI thread. Defaults to \c{false}.
+*/
+
 /*!
   \qmlproperty rect ChartView::plotArea
   The rectangle within which the chart is drawn.
@@ -447,6 +463,10 @@ void DeclarativeChart::initChart(QChart::ChartType type)
     m_guiThreadId = QThread::currentThreadId();
     m_paintThreadId = 0;
     m_updatePending = false;
+    m_renderThread = 0;
+    m_rasterizer = 0;
+    m_backImage = 0;
+    m_frameInFlight = false;
 
     setFlag(ItemHasContents, true);
 
@@ -566,6 +586,7 @@ void DeclarativeChart::changeMargins(int top, int bottom, int left, int right)
 
 DeclarativeChart::~DeclarativeChart()
 {
+    stopRenderThread();
     delete m_chart;
     delete m_sceneImage;
 }
@@ -737,9 +758,10 @@ QSGNode *DeclarativeChart::updatePaintNode(QSGNode *oldNode, QQuickItem::UpdateP
 
     m_pendingRenderNodeMouseEvents.clear();
 
-    // Copy chart (if dirty) to chart node
+    // Copy the changed parts of the chart (if dirty) to chart node
     if (m_sceneImageDirty) {
-        node->createTextureFromImage(*m_sceneImage);
+        node->updateTextureFromImage(*m_sceneImage, m_textureDirtyRegion);
+        m_textureDirtyRegion = QRegion();
         m_sceneImageDirty = false;
     }
 
@@ -752,22 +774,28 @@ void DeclarativeChart::sceneChanged(QList<QRectF> region)
 {
     const int count = region.size();
     const qreal limitSize = 0.01;
-    if (count && !m_updatePending) {
+    if (count) {
         qreal totalSize = 0.0;
         for (int i = 0; i < count; i++) {
             const QRectF &reg = region.at(i);
             totalSize += (reg.height() * reg.width());
-            if (totalSize >= limitSize)
-                break;
         }
         // Ignore region updates that change less than small fraction of a pixel, as there is
         // little point regenerating the image in these cases. These are typically cases
         // where OpenGL series are drawn to otherwise static chart.
         if (totalSize >= limitSize) {
-            m_updatePending = true;
-            // Do async render to avoid some unnecessary renders.
-            emit needRender();
-        } else {
+            // Collect the changed areas even while a render is pending, only they are rendered.
+            // Antialiased edges can reach one pixel outside of the reported rectangles.
+            QRegion dirtyRegion;
+            for (int i = 0; i < count; i++)
+                dirtyRegion += region.at(i).toAlignedRect().adjusted(-1, -1, 1, 1);
+            addSceneDirtyRegion(dirtyRegion);
+            if (!m_updatePending) {
+                m_updatePending = true;
+                // Do async render to avoid some unnecessary renders.
+                emit needRender();
+            }
+        } else if (!m_updatePending) {
             // We do want to call update to trigger possible gl series updates.
             update();
         }
@@ -777,30 +805,115 @@ void DeclarativeChart::sceneChanged(QList<QRectF> region)
 void DeclarativeChart::renderScene()
 {
     m_updatePending = false;
-    m_sceneImageDirty = true;
+    // Changes made while a frame is rasterized are rendered once it has been received.
+    if (m_frameInFlight)
+        return;
+
     QSize chartSize = m_chart->size().toSize();
-    if (!m_sceneImage || chartSize != m_sceneImage->size()) {
+    QRect renderRect(QPoint(0, 0), chartSize);
+    qreal dpr = window() ? window()->devicePixelRatio() : 1.0;
+
+    // Effects are drawn through pixmaps, which can't be used outside the GUI thread.
+    if (m_rasterizer && !m_chart->isDropShadowEnabled()) {
+        if (m_sceneDirtyRegion.intersected(renderRect).isEmpty())
+            return;
+        bool clear = m_sceneImageNeedsClear;
+        if (!m_backImage || chartSize * dpr != m_backImage->size()) {
+            delete m_backImage;
+            m_backImage = new QImage(chartSize * dpr, QImage::Format_ARGB32);
+            m_backImage->setDevicePixelRatio(dpr);
+            m_backImageStaleRegion = renderRect;
+            clear = true;
+        }
+
+        // Record the stale parts of the back image on this thread and leave the
+        // rasterization to the render thread.
+        const QRegion dirtyRegion = m_backImageStaleRegion.intersected(renderRect);
+        m_backImageStaleRegion = QRegion();
+        QPicture picture;
+        QPainter painter(&picture);
+        const QRect sourceRect = dirtyRegion.boundingRect();
+        m_scene->render(&painter, sourceRect, sourceRect);
+        painter.end();
+        if (m_chart->backgroundBrush().color().alpha() == 0xff)
+            m_sceneImageNeedsClear = false;
+
+        m_frameInFlight = true;
+        m_rasterizer->setFrame(m_backImage, picture, dirtyRegion, clear, antialiasing());
+        QMetaObject::invokeMethod(m_rasterizer, "rasterize", Qt::QueuedConnection);
+        return;
+    }
+
+    if (!m_sceneImage || chartSize * dpr != m_sceneImage->size()) {
         delete m_sceneImage;
-        qreal dpr = window() ? window()->devicePixelRatio() : 1.0;
         m_sceneImage = new QImage(chartSize * dpr, QImage::Format_ARGB32);
         m_sceneImage->setDevicePixelRatio(dpr);
         m_sceneImageNeedsClear = true;
+        m_sceneDirtyRegion = renderRect;
+        m_textureDirtyRegion = QRegion();
     }
 
+    // Only the parts of the persistent image that changed in the scene are rendered again.
+    const QRegion dirtyRegion = m_sceneDirtyRegion.intersected(renderRect);
+    m_sceneDirtyRegion = QRegion();
+    if (dirtyRegion.isEmpty())
+        return;
+
+    QPainter painter(m_sceneImage);
     if (m_sceneImageNeedsClear) {
-        m_sceneImage->fill(Qt::transparent);
+        painter.setCompositionMode(QPainter::CompositionMode_Source);
+        for (const QRect &rect : dirtyRegion)
+            painter.fillRect(rect, Qt::transparent);
+        painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
         // Don't clear the flag if chart background has any transparent element to it
         if (m_chart->backgroundBrush().color().alpha() == 0xff && !m_chart->isDropShadowEnabled())
             m_sceneImageNeedsClear = false;
     }
-    QPainter painter(m_sceneImage);
     if (antialiasing()) {
         painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing
                                | QPainter::SmoothPixmapTransform);
     }
-    QRect renderRect(QPoint(0, 0), chartSize);
-    m_scene->render(&painter, renderRect, renderRect);
+    painter.setClipRegion(dirtyRegion);
+    const QRect sourceRect = dirtyRegion.boundingRect();
+    m_scene->render(&painter, sourceRect, sourceRect);
+
+    markTextureDirty(dirtyRegion);
+    update();
+}
+
+void DeclarativeChart::handleFrameRasterized()
+{
+    // Ignore frames of a render thread that has been stopped
+    if (!m_frameInFlight || sender() != m_rasterizer)
+        return;
+    m_frameInFlight = false;
+
+    // Show the finished image. Both images are up to date apart from their stale regions,
+    // so those are the only places where the texture can differ from the new image.
+    qSwap(m_sceneImage, m_backImage);
+    qSwap(m_sceneDirtyRegion, m_backImageStaleRegion);
+    markTextureDirty(m_sceneDirtyRegion + m_backImageStaleRegion);
     update();
+
+    if (!m_sceneDirtyRegion.isEmpty() && !m_updatePending) {
+        m_updatePending = true;
+        emit needRender();
+    }
+}
+
+// An empty texture region with a dirty image means the whole texture is recreated
+void DeclarativeChart::markTextureDirty(const QRegion &region)
+{
+    if (!m_sceneImageDirty || !m_textureDirtyRegion.isEmpty())
+        m_textureDirtyRegion += region;
+    m_sceneImageDirty = true;
+}
+
+void DeclarativeChart::addSceneDirtyRegion(const QRegion &region)
+{
+    m_sceneDirtyRegion += region;
+    if (m_backImage)
+        m_backImageStaleRegion += region;
 }
 
 void DeclarativeChart::mousePressEvent(QMouseEvent *event)
@@ -923,6 +1036,7 @@ void DeclarativeChart::mouseDoubleClickEvent(QMouseEvent *event)
 void DeclarativeChart::handleAntialiasingChanged(bool enable)
 {
     setAntialiasing(enable);
+    addSceneDirtyRegion(QRect(QPoint(0, 0), m_chart->size().toSize()));
     emit needRender();
 }
 
@@ -1100,6 +1214,52 @@ QLocale QtCharts::DeclarativeChart::locale() const
     return m_chart->locale();
 }
 
+bool DeclarativeChart::threadedRendering() const
+{
+    return m_rasterizer;
+}
+
+void DeclarativeChart::setThreadedRendering(bool enabled)
+{
+    if (enabled == threadedRendering())
+        return;
+
+    if (enabled) {
+        m_renderThread = new QThread(this);
+        m_rasterizer = new DeclarativeChartRasterizer;
+        m_rasterizer->moveToThread(m_renderThread);
+        connect(m_rasterizer, &DeclarativeChartRasterizer::rasterized,
+                this, &DeclarativeChart::handleFrameRasterized);
+        m_renderThread->start();
+    } else {
+        stopRenderThread();
+    }
+    emit threadedRenderingChanged(enabled);
+}
+
+void DeclarativeChart::stopRenderThread()
+{
+    if (!m_renderThread)
+        return;
+
+    // Waiting lets a frame in flight finish, after which the back image is unused.
+    m_renderThread->quit();
+    m_renderThread->wait();
+    delete m_rasterizer;
+    m_rasterizer = 0;
+    delete m_renderThread;
+    m_renderThread = 0;
+    delete m_backImage;
+    m_backImage = 0;
+    m_backImageStaleRegion = QRegion();
+    m_frameInFlight = false;
+
+    if (!m_sceneDirtyRegion.isEmpty() && !m_updatePending) {
+        m_updatePending = true;
+        emit needRender();
+    }
+}
+
 int DeclarativeChart::count()
 {
     return m_chart->series().count();
@@ -49,13 +49,17 @@
 
 #include <QtCharts/QChart>
 #include <QtCore/QLocale>
+#include <QtGui/QRegion>
 #include <QQmlComponent>
 
+QT_FORWARD_DECLARE_CLASS(QThread)
+
 QT_CHARTS_BEGIN_NAMESPACE
 
 class DeclarativeMargins;
 class Domain;
 class DeclarativeAxes;
+class DeclarativeChartRasterizer;
 
 class QT_QMLCHARTS_PRIVATE_EXPORT DeclarativeChart : public QQuickItem
 {
@@ -78,6 +82,7 @@ class QT_QMLCHARTS_PRIVATE_EXPORT DeclarativeChart : public QQuickItem
     Q_PROPERTY(QQmlListProperty<QAbstractAxis> axes READ axes REVISION 2)
     Q_PROPERTY(bool localizeNumbers READ localizeNumbers WRITE setLocalizeNumbers NOTIFY localizeNumbersChanged REVISION 4)
     Q_PROPERTY(QLocale locale READ locale WRITE setLocale NOTIFY localeChanged REVISION 4)
+    Q_PROPERTY(bool threadedRendering READ threadedRendering WRITE setThreadedRendering NOTIFY threadedRenderingChanged REVISION 6)
     Q_ENUMS(Animation)
     Q_ENUMS(Theme)
     Q_ENUMS(SeriesType)
@@ -136,6 +141,7 @@ private Q_SLOTS:
     void handleAntialiasingChanged(bool enable);
     void sceneChanged(QList<QRectF> region);
     void renderScene();
+    void handleFrameRasterized();
 
 public:
     void setTheme(DeclarativeChart::Theme theme);
@@ -161,6 +167,8 @@ public:
     bool localizeNumbers() const;
     void setLocale(const QLocale &locale);
     QLocale locale() const;
+    bool threadedRendering() const;
+    void setThreadedRendering(bool enabled);
 
     int count();
     void setDropShadowEnabled(bool enabled);
@@ -223,6 +231,7 @@ Q_SIGNALS:
     Q_REVISION(4) void localeChanged();
     Q_REVISION(5) void animationDurationChanged(int msecs);
     Q_REVISION(5) void animationEasingCurveChanged(QEasingCurve curve);
+    Q_REVISION(6) void threadedRenderingChanged(bool enabled);
     void needRender();
     void pendingRenderNodeMouseEventResponses();
 
@@ -245,6 +254,9 @@ private:
     void findMinMaxForSeries(QAbstractSeries *series,Qt::Orientations orientation,
                              qreal &min, qreal &max);
     void queueRendererMouseEvent(QMouseEvent *event);
+    void stopRenderThread();
+    void markTextureDirty(const QRegion &region);
+    void addSceneDirtyRegion(const QRegion &region);
 
     // Extending QChart with DeclarativeChart is not possible because QObject does not support
     // multi inheritance, so we now have a QChart as a member instead
@@ -264,6 +276,13 @@ private:
     DeclarativeMargins *m_margins;
     GLXYSeriesDataManager *m_glXYDataManager;
     bool m_sceneImageNeedsClear;
+    QRegion m_sceneDirtyRegion;
+    QRegion m_textureDirtyRegion;
+    QThread *m_renderThread;
+    DeclarativeChartRasterizer *m_rasterizer;
+    QImage *m_backImage;
+    QRegion m_backImageStaleRegion;
+    bool m_frameInFlight;
     QVector<QMouseEvent *> m_pendingRenderNodeMouseEvents;
     QVector<MouseEventResponse> m_pendingRenderNodeMouseEventResponses;
     QRectF m_adjustedPlotArea;
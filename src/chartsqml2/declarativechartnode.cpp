@@ -36,6 +36,8 @@
 
 #ifndef QT_NO_OPENGL
 # include "declarativeopenglrendernode_p.h"
+# include <QtGui/QOpenGLContext>
+# include <QtGui/QOpenGLFunctions>
 #endif
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -85,6 +87,41 @@ void DeclarativeChartNode::createTextureFromImage(const QImage &chartImage)
         m_imageNode->setRect(m_rect);
 }
 
+// Must be called on render thread and in context.
+// Updates only the given region, in logical image coordinates, of the existing texture if possible.
+// An empty region updates the whole texture.
+void DeclarativeChartNode::updateTextureFromImage(const QImage &chartImage, const QRegion &region)
+{
+#ifndef QT_NO_OPENGL
+    QSGTexture *texture = m_imageNode ? m_imageNode->texture() : nullptr;
+    QOpenGLContext *context = QOpenGLContext::currentContext();
+    if (texture && context && !region.isEmpty() && texture->textureSize() == chartImage.size()
+            && m_window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL) {
+        QOpenGLFunctions *functions = context->functions();
+        const qreal dpr = chartImage.devicePixelRatio();
+        // Binding also uploads the initial image if the texture has not been drawn yet
+        texture->bind();
+        for (const QRect &rect : region) {
+            const QRect pixelRect = QRectF(rect.x() * dpr, rect.y() * dpr,
+                                           rect.width() * dpr, rect.height() * dpr)
+                    .toAlignedRect().intersected(chartImage.rect());
+            if (pixelRect.isEmpty())
+                continue;
+            const QImage part = chartImage.copy(pixelRect)
+                    .convertToFormat(QImage::Format_RGBA8888_Premultiplied);
+            functions->glTexSubImage2D(GL_TEXTURE_2D, 0, pixelRect.x(), pixelRect.y(),
+                                       pixelRect.width(), pixelRect.height(),
+                                       GL_RGBA, GL_UNSIGNED_BYTE, part.constBits());
+        }
+        m_imageNode->markDirty(QSGNode::DirtyMaterial);
+        return;
+    }
+#else
+    Q_UNUSED(region)
+#endif
+    createTextureFromImage(chartImage);
+}
+
 void DeclarativeChartNode::setRect(const QRectF &rect)
 {
     m_rect = rect;
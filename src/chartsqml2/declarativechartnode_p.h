@@ -54,6 +54,7 @@ public:
     ~DeclarativeChartNode();
 
     void createTextureFromImage(const QImage &chartImage);
+    void updateTextureFromImage(const QImage &chartImage, const QRegion &region);
     DeclarativeAbstractRenderNode *renderNode() const { return m_renderNode; }
 
     void setRect(const QRectF &rect);
@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "declarativechartrasterizer_p.h"
+#include <QtGui/QPainter>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+DeclarativeChartRasterizer::DeclarativeChartRasterizer(QObject *parent)
+    : QObject(parent),
+      m_image(0),
+      m_clear(false),
+      m_antialiasing(false)
+{
+}
+
+// Called on the GUI thread while no frame is in flight. The image is not touched by the
+// GUI thread until rasterized() has been received.
+void DeclarativeChartRasterizer::setFrame(QImage *image, const QPicture &picture,
+                                          const QRegion &region, bool clear, bool antialiasing)
+{
+    QMutexLocker locker(&m_mutex);
+    m_image = image;
+    m_picture = picture;
+    m_region = region;
+    m_clear = clear;
+    m_antialiasing = antialiasing;
+}
+
+void DeclarativeChartRasterizer::rasterize()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_image) {
+            QPainter painter(m_image);
+            if (m_clear) {
+                painter.setCompositionMode(QPainter::CompositionMode_Source);
+                for (const QRect &rect : m_region)
+                    painter.fillRect(rect, Qt::transparent);
+                painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+            }
+            if (m_antialiasing) {
+                painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing
+                                       | QPainter::SmoothPixmapTransform);
+            }
+            painter.setClipRegion(m_region);
+            painter.drawPicture(0, 0, m_picture);
+        }
+        m_image = 0;
+        m_picture = QPicture();
+    }
+    emit rasterized();
+}
+
+#include "moc_declarativechartrasterizer_p.cpp"
+
+QT_CHARTS_END_NAMESPACE
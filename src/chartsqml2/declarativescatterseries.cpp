@@ -44,6 +44,7 @@ DeclarativeScatterSeries::DeclarativeScatterSeries(QObject *parent) :
     connect(this, SIGNAL(pointAdded(int)), this, SLOT(handleCountChanged(int)));
     connect(this, SIGNAL(pointRemoved(int)), this, SLOT(handleCountChanged(int)));
     connect(this, SIGNAL(pointsRemoved(int, int)), this, SLOT(handleCountChanged(int)));
+    connect(this, SIGNAL(pointsReplaced()), this, SLOT(handleCountChanged()));
     connect(this, SIGNAL(brushChanged()), this, SLOT(handleBrushChanged()));
 }
 
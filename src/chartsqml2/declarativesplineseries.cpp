@@ -44,12 +44,13 @@ DeclarativeSplineSeries::DeclarativeSplineSeries(QObject *parent) :
     connect(this, SIGNAL(pointAdded(int)), this, SLOT(handleCountChanged(int)));
     connect(this, SIGNAL(pointRemoved(int)), this, SLOT(handleCountChanged(int)));
     connect(this, SIGNAL(pointsRemoved(int, int)), this, SLOT(handleCountChanged(int)));
+    connect(this, SIGNAL(pointsReplaced()), this, SLOT(handleCountChanged()));
 }
 
 void DeclarativeSplineSeries::handleCountChanged(int index)
 {
     Q_UNUSED(index)
-    emit countChanged(points().count());
+    emit countChanged(count());
 }
 
 qreal DeclarativeSplineSeries::width() const
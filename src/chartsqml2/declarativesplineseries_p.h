@@ -103,6 +103,8 @@ public:
     Q_INVOKABLE void insert(int index, qreal x, qreal y) { DeclarativeXySeries::insert(index, x, y); }
     Q_INVOKABLE void clear() { DeclarativeXySeries::clear(); }
     Q_INVOKABLE QPointF at(int index) { return DeclarativeXySeries::at(index); }
+    Q_REVISION(5) Q_INVOKABLE void appendPoints(const QJSValue &xValues, const QJSValue &yValues = QJSValue()) { DeclarativeXySeries::appendPoints(xValues, yValues); }
+    Q_REVISION(5) Q_INVOKABLE void replacePoints(const QJSValue &xValues, const QJSValue &yValues = QJSValue()) { DeclarativeXySeries::replacePoints(xValues, yValues); }
 
 Q_SIGNALS:
     void countChanged(int count);
@@ -118,7 +120,7 @@ Q_SIGNALS:
 
 public Q_SLOTS:
     static void appendDeclarativeChildren(QQmlListProperty<QObject> *list, QObject *element);
-    void handleCountChanged(int index);
+    void handleCountChanged(int index = 0);
 
 public:
     DeclarativeAxes *m_axes;
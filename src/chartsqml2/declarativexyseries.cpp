@@ -32,9 +32,82 @@
 #include "declarativexypoint_p.h"
 #include <QtCharts/QVXYModelMapper>
 #include <QtCharts/QHXYModelMapper>
+#include <private/charthelpers_p.h>
+#include <cstring>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+static void appendDoubles(QVector<qreal> &values, const char *data, int count)
+{
+    for (int i = 0; i < count; i++) {
+        double value;
+        memcpy(&value, data + i * sizeof(double), sizeof(double));
+        values.append(value);
+    }
+}
+
+// Converts a JavaScript array, a typed array or an ArrayBuffer of doubles to numbers.
+static QVector<qreal> valuesFromJSValue(const QJSValue &values)
+{
+    QVector<qreal> result;
+    if (values.hasProperty(QStringLiteral("buffer"))) {
+        const int length = values.property(QStringLiteral("length")).toInt();
+        result.reserve(length);
+        if (values.property(QStringLiteral("BYTES_PER_ELEMENT")).toInt() == int(sizeof(double))) {
+            // Float64Array, copy the viewed part of its buffer directly
+            const QByteArray bytes = values.property(QStringLiteral("buffer")).toVariant().toByteArray();
+            const int offset = values.property(QStringLiteral("byteOffset")).toInt();
+            if (offset + length * int(sizeof(double)) <= bytes.size()) {
+                appendDoubles(result, bytes.constData() + offset, length);
+                return result;
+            }
+        }
+        for (int i = 0; i < length; i++)
+            result.append(values.property(quint32(i)).toNumber());
+        return result;
+    }
+
+    const QVariant data = values.toVariant();
+    if (data.type() == QVariant::ByteArray) {
+        // ArrayBuffer
+        const QByteArray bytes = data.toByteArray();
+        const int count = bytes.size() / int(sizeof(double));
+        result.reserve(count);
+        appendDoubles(result, bytes.constData(), count);
+    } else {
+        const QVariantList list = data.toList();
+        result.reserve(list.size());
+        for (const QVariant &value : list)
+            result.append(value.toReal());
+    }
+    return result;
+}
+
+QVector<QPointF> DeclarativeXySeries::pointsFromValues(const QJSValue &xValues, const QJSValue &yValues)
+{
+    QVector<QPointF> points;
+    const QVector<qreal> x = valuesFromJSValue(xValues);
+    if (!yValues.isUndefined() && !yValues.isNull()) {
+        const QVector<qreal> y = valuesFromJSValue(yValues);
+        const int count = qMin(x.size(), y.size());
+        points.reserve(count);
+        for (int i = 0; i < count; i++) {
+            const QPointF point(x.at(i), y.at(i));
+            if (isValidValue(point))
+                points.append(point);
+        }
+    } else {
+        // Interleaved x and y
+        points.reserve(x.size() / 2);
+        for (int i = 0; i + 1 < x.size(); i += 2) {
+            const QPointF point(x.at(i), x.at(i + 1));
+            if (isValidValue(point))
+                points.append(point);
+        }
+    }
+    return points;
+}
+
 DeclarativeXySeries::DeclarativeXySeries()
 {
 }
@@ -131,4 +204,23 @@ QPointF DeclarativeXySeries::at(int index)
     return QPointF(0, 0);
 }
 
+void DeclarativeXySeries::appendPoints(const QJSValue &xValues, const QJSValue &yValues)
+{
+    QXYSeries *series = qobject_cast<QXYSeries *>(xySeries());
+    Q_ASSERT(series);
+    const QVector<QPointF> newPoints = pointsFromValues(xValues, yValues);
+    if (newPoints.isEmpty())
+        return;
+    QVector<QPointF> points = series->pointsVector();
+    points += newPoints;
+    series->replace(points);
+}
+
+void DeclarativeXySeries::replacePoints(const QJSValue &xValues, const QJSValue &yValues)
+{
+    QXYSeries *series = qobject_cast<QXYSeries *>(xySeries());
+    Q_ASSERT(series);
+    series->replace(pointsFromValues(xValues, yValues));
+}
+
 QT_CHARTS_END_NAMESPACE
@@ -41,6 +41,7 @@
 
 #include <QtCharts/QXYSeries>
 #include <private/declarativechartglobal_p.h>
+#include <QtQml/QJSValue>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -67,6 +68,11 @@ public:
     void insert(int index, qreal x, qreal y);
     void clear();
     QPointF at(int index);
+    void appendPoints(const QJSValue &xValues, const QJSValue &yValues);
+    void replacePoints(const QJSValue &xValues, const QJSValue &yValues);
+
+private:
+    static QVector<QPointF> pointsFromValues(const QJSValue &xValues, const QJSValue &yValues);
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -2,15 +2,21 @@ TEMPLATE = subdirs
 SUBDIRS += \
            qchartview \
            qchart \
+           qchartrenderer \
            qlineseries \ 
+           qmappedxydataprovider \
+           qmovingaverageseries \
            qbarset \
+           qboxset \
            qbarseries \
+           qhistogramseries \
            qstackedbarseries \
            qpercentbarseries \
            qpieslice qpieseries \
            qpiemodelmapper \
            qsplineseries \
            qscatterseries \
+           qseriesloader \
            qxymodelmapper \
            qbarmodelmapper \
            qhorizontalbarseries \
@@ -128,6 +128,8 @@ private Q_SLOTS:
     void zoomOut();
     void move_data();
     void move();
+    void moveTranslation_data();
+    void moveTranslation();
 };
 
 void tst_Domain::initTestCase()
@@ -728,5 +730,47 @@ void tst_Domain::move()
     TRY_COMPARE(spy2.count(), (dy != 0 ? 1 : 0));
 }
 
+void tst_Domain::moveTranslation_data()
+{
+    QTest::addColumn<bool>("reverseX");
+    QTest::addColumn<bool>("reverseY");
+    QTest::newRow("normal") << false << false;
+    QTest::newRow("reverse x") << true << false;
+    QTest::newRow("reverse y") << false << true;
+    QTest::newRow("reverse both") << true << true;
+}
+
+void tst_Domain::moveTranslation()
+{
+    QFETCH(bool, reverseX);
+    QFETCH(bool, reverseY);
+
+    XYDomain domain;
+    domain.setRange(0, 100, -50, 50);
+    domain.setSize(QSizeF(400, 200));
+    domain.setReverseX(reverseX);
+    domain.setReverseY(reverseY);
+
+    QVector<QPointF> points;
+    points << QPointF(0, 0) << QPointF(25, -10) << QPointF(90, 40);
+    const QVector<QPointF> before = domain.calculateGeometryPoints(points);
+
+    bool translating = false;
+    connect(&domain, &AbstractDomain::updated, [&]() { translating = domain.isTranslating(); });
+    domain.move(12, -7);
+
+    QVERIFY(translating);
+    QVERIFY(!domain.isTranslating());
+    const QVector<QPointF> after = domain.calculateGeometryPoints(points);
+    for (int i = 0; i < points.size(); ++i) {
+        QCOMPARE(after.at(i).x(), before.at(i).x() + domain.translation().x());
+        QCOMPARE(after.at(i).y(), before.at(i).y() + domain.translation().y());
+    }
+
+    translating = true;
+    domain.setRange(0, 200, -50, 50);
+    QVERIFY(!translating);
+}
+
 QTEST_MAIN(tst_Domain)
 #include "tst_domain.moc"
@@ -60,6 +60,7 @@ private slots:
     void insert();
     void remove_data();
     void remove();
+    void lookupAfterEdit();
     void max_raw_data();
     void max_raw();
     void max_data();
@@ -475,6 +476,31 @@ void tst_QBarCategoriesAxis::remove()
     QCOMPARE(spy4.count(), 1);
 }
 
+void tst_QBarCategoriesAxis::lookupAfterEdit()
+{
+    QBarCategoryAxis axis;
+    axis.append(QStringList() << "Jul" << "Aug" << "Sep" << "Oct");
+
+    axis.remove("Aug");
+    axis.insert(0, "Jun");
+    axis.replace("Sep", "Fall");
+    QCOMPARE(axis.categories(), QStringList() << "Jun" << "Jul" << "Fall" << "Oct");
+
+    // duplicates are still rejected, removed categories can be appended again
+    axis.append(QStringList() << "Jul" << "Fall" << "Aug");
+    QCOMPARE(axis.count(), 5);
+    QCOMPARE(axis.at(4), QString("Aug"));
+
+    axis.setRange("Jul", "Fall");
+    QCOMPARE(axis.min(), QString("Jul"));
+    QCOMPARE(axis.max(), QString("Fall"));
+
+    // range is not changed if min is after max
+    axis.setRange("Aug", "Jun");
+    QCOMPARE(axis.min(), QString("Jul"));
+    QCOMPARE(axis.max(), QString("Fall"));
+}
+
 void tst_QBarCategoriesAxis::max_raw_data()
 {
     //"Jan" << "Feb" << "Mar" << "Apr" << "May" << "Jun";
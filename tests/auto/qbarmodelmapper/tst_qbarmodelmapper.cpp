@@ -63,6 +63,7 @@ class tst_qbarmodelmapper : public QObject
     void horizontalMapperCustomMapping_data();
     void horizontalMapperCustomMapping();
     void seriesUpdated();
+    void seriesValuesReplaced();
     void verticalModelInsertRows();
     void verticalModelRemoveRows();
     void verticalModelInsertColumns();
@@ -72,6 +73,7 @@ class tst_qbarmodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void dataRole();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -395,6 +397,47 @@ void tst_qbarmodelmapper::seriesUpdated()
     QCOMPARE(m_model->columnCount(), m_modelColumnCount + newBarSets.count());
 }
 
+void tst_qbarmodelmapper::seriesValuesReplaced()
+{
+    // setup the mapper
+    createVerticalMapper();
+    m_vMapper->setFirstRow(2);
+    m_vMapper->setRowCount(4);
+    QCOMPARE(m_series->barSets().at(1)->count(), 4);
+
+    // Replacing with as many values rewrites the mapped range only
+    QVector<qreal> values;
+    values << 11 << 12 << 13 << 14;
+    m_series->barSets().at(1)->replace(values);
+    QCOMPARE(m_model->rowCount(), m_modelRowCount);
+    for (int i = 0; i < values.count(); i++)
+        QCOMPARE(m_model->data(m_model->index(i + 2, 1)).toReal(), values.at(i));
+    QCOMPARE(m_model->data(m_model->index(1, 1)).toReal(), qreal(1.0));
+    QCOMPARE(m_model->data(m_model->index(6, 1)).toReal(), qreal(6.0));
+    QCOMPARE(m_series->barSets().at(1)->at(0), qreal(11.0));
+
+    // More values grow the mapped range
+    values << 15 << 16;
+    m_series->barSets().at(1)->replace(values);
+    QCOMPARE(m_model->rowCount(), m_modelRowCount + 2);
+    QCOMPARE(m_vMapper->rowCount(), 6);
+    for (int i = 0; i < values.count(); i++)
+        QCOMPARE(m_model->data(m_model->index(i + 2, 1)).toReal(), values.at(i));
+    QCOMPARE(m_model->data(m_model->index(8, 1)).toReal(), qreal(6.0));
+    QCOMPARE(m_series->barSets().at(1)->count(), 6);
+
+    // Fewer values shrink it
+    values.resize(3);
+    m_series->barSets().at(1)->replace(values);
+    QCOMPARE(m_model->rowCount(), m_modelRowCount - 1);
+    QCOMPARE(m_vMapper->rowCount(), 3);
+    for (int i = 0; i < values.count(); i++)
+        QCOMPARE(m_model->data(m_model->index(i + 2, 1)).toReal(), values.at(i));
+    QCOMPARE(m_model->data(m_model->index(5, 1)).toReal(), qreal(6.0));
+    QCOMPARE(m_series->barSets().at(1)->count(), 3);
+    QCOMPARE(m_series->barSets().at(1)->at(2), qreal(13.0));
+}
+
 void tst_qbarmodelmapper::verticalModelInsertRows()
 {
     // setup the mapper
@@ -629,6 +672,31 @@ void tst_qbarmodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qbarmodelmapper::dataRole()
+{
+    // setup the mapper
+    createVerticalMapper();
+    for (int row = 0; row < m_modelRowCount; ++row) {
+        for (int column = 0; column < m_modelColumnCount; column++)
+            m_model->setData(m_model->index(row, column), -row * column, Qt::UserRole);
+    }
+    QCOMPARE(m_vMapper->dataRole(), int(Qt::DisplayRole));
+    QCOMPARE(m_series->barSets().at(2)->at(3), 6.0);
+
+    QSignalSpy spy(m_vMapper, SIGNAL(dataRoleChanged()));
+    m_vMapper->setDataRole(Qt::UserRole);
+    m_vMapper->setDataRole(Qt::UserRole);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(m_series->barSets().at(2)->at(3), -6.0);
+
+    // Changes are read and written with the role
+    QVERIFY(m_model->setData(m_model->index(4, 2), 44, Qt::UserRole));
+    QCOMPARE(m_series->barSets().at(2)->at(4), 44.0);
+    m_series->barSets().at(2)->replace(3, 33.0);
+    QCOMPARE(m_model->data(m_model->index(3, 2), Qt::UserRole).toReal(), 33.0);
+    QCOMPARE(m_model->data(m_model->index(3, 2)).toReal(), 6.0);
+}
+
 void tst_qbarmodelmapper::verticalMapperSignals()
 {
     QVBarModelMapper *mapper = new QVBarModelMapper;
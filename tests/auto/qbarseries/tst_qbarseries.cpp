@@ -32,10 +32,87 @@
 #include <QtCharts/QBarSet>
 #include <QtCharts/QChartView>
 #include <QtCharts/QChart>
+#include <QtCharts/QBarCategoryAxis>
+#include <QtCharts/QChartRenderer>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <private/qabstractbarseries_p.h>
 #include "tst_definitions.h"
 
 QT_CHARTS_USE_NAMESPACE
 
+class TestBarSeries : public QBarSeries
+{
+public:
+    QAbstractBarSeriesPrivate *d() const
+    {
+        return static_cast<QAbstractBarSeriesPrivate *>(d_ptr.data());
+    }
+};
+
+// Creates a chart with one bar set and visible value labels
+static QChart *createLabelChart(const QList<qreal> &values)
+{
+    QChart *chart = new QChart();
+    QBarSeries *series = new QBarSeries();
+    QBarSet *set = new QBarSet(QString("set"));
+    set->append(values);
+    series->append(set);
+    series->setLabelsVisible(true);
+    chart->addSeries(series);
+    chart->createDefaultAxes();
+    chart->axisY(series)->setRange(0, 12);
+    return chart;
+}
+
+// Compares the cached category aggregates with values computed from the sets
+static void verifyCategoryAggregates(TestBarSeries *series)
+{
+    QAbstractBarSeriesPrivate *d = series->d();
+    const int categoryCount = d->categoryCount();
+    qreal min = INT_MAX;
+    qreal max = INT_MIN;
+    qreal top = 0;
+    qreal bottom = 0;
+    qreal maxCategorySum = INT_MIN;
+    for (int category = 0; category < categoryCount; category++) {
+        qreal sum = 0;
+        qreal absoluteSum = 0;
+        qreal categoryTop = 0;
+        qreal categoryBottom = 0;
+        foreach (QBarSet *set, series->barSets()) {
+            if (category >= set->count())
+                continue;
+            const qreal value = set->at(category);
+            sum += value;
+            absoluteSum += qAbs(value);
+            if (value > 0)
+                categoryTop += value;
+            else
+                categoryBottom += value;
+            min = qMin(min, value);
+            max = qMax(max, value);
+        }
+        QCOMPARE(d->categorySum(category), sum);
+        QCOMPARE(d->absoluteCategorySum(category), absoluteSum);
+        QCOMPARE(d->categoryTop(category), categoryTop);
+        QCOMPARE(d->categoryBottom(category), categoryBottom);
+        top = qMax(top, categoryTop);
+        bottom = qMin(bottom, categoryBottom);
+        maxCategorySum = qMax(maxCategorySum, sum);
+    }
+    // Without sets min() and max() report an empty range at zero instead of the extents
+    if (series->count() == 0) {
+        min = 0;
+        max = 0;
+    }
+    QCOMPARE(d->min(), min);
+    QCOMPARE(d->max(), max);
+    QCOMPARE(d->top(), top);
+    QCOMPARE(d->bottom(), bottom);
+    QCOMPARE(d->maxCategorySum(), maxCategorySum);
+}
+
 Q_DECLARE_METATYPE(QBarSet*)
 Q_DECLARE_METATYPE(QList<QBarSet*>)
 Q_DECLARE_METATYPE(QAbstractBarSeries::LabelsPosition)
@@ -83,6 +160,10 @@ private slots:
     void mousePressed();
     void mouseReleased();
     void mouseDoubleClicked();
+    void hitTestVisibleCategories();
+    void hitTestOverlappingSeries();
+    void categoryAggregates();
+    void labelsRendering();
 
 private:
     QBarSeries* m_barseries;
@@ -1398,6 +1479,214 @@ void tst_QBarSeries::mouseDoubleClicked()
     QVERIFY(setSpyArg.at(0).toInt() == 0);
 }
 
+void tst_QBarSeries::hitTestVisibleCategories()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // Bars are looked up in the flat layout of the visible categories only, so
+    // clicks must hit the right bar also when the first categories are scrolled out.
+    QBarSeries *series = new QBarSeries();
+    QBarSet *set1 = new QBarSet(QString("set 1"));
+    QBarSet *set2 = new QBarSet(QString("set 2"));
+    QStringList categories;
+    for (int i = 0; i < 10; i++) {
+        *set1 << 2 + i;
+        *set2 << 12 - i;
+        categories << QString::number(i);
+    }
+    series->append(set1);
+    series->append(set2);
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    QBarCategoryAxis *axisX = qobject_cast<QBarCategoryAxis *>(view.chart()->axisX(series));
+    QVERIFY(axisX);
+    axisX->setCategories(categories);
+    axisX->setRange("3", "6");
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy seriesSpy(series, SIGNAL(clicked(int,QBarSet*)));
+    const qreal barWidth = series->barWidth() / series->count();
+    for (int category = 3; category <= 6; category++) {
+        for (int set = 0; set < series->count(); set++) {
+            QBarSet *barSet = series->barSets().at(set);
+            const qreal x = category - series->barWidth() / 2 + (set + 0.5) * barWidth;
+            const QPointF scenePos = view.chart()->mapToPosition(
+                        QPointF(x, barSet->at(category) / 2), series);
+            QTest::mouseClick(view.viewport(), Qt::LeftButton, 0,
+                              view.mapFromScene(scenePos));
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+            QCOMPARE(seriesSpy.count(), 1);
+            const QList<QVariant> arguments = seriesSpy.takeFirst();
+            QCOMPARE(arguments.at(0).toInt(), category);
+            QCOMPARE(qvariant_cast<QBarSet *>(arguments.at(1)), barSet);
+        }
+    }
+
+    // Between categories and above the shorter bar nothing is hit
+    QPointF scenePos = view.chart()->mapToPosition(QPointF(4.5, 1), series);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, view.mapFromScene(scenePos));
+    const qreal x = 4 - series->barWidth() / 2 + 0.5 * barWidth;
+    scenePos = view.chart()->mapToPosition(QPointF(x, set1->at(4) + 1), series);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, view.mapFromScene(scenePos));
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 0);
+}
+
+void tst_QBarSeries::hitTestOverlappingSeries()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // The bar item covers the whole plot area, but only its bars may take mouse and hover
+    // events. A line series stacked below it must still get the events outside the bars.
+    QLineSeries *line = new QLineSeries();
+    *line << QPointF(0, 8) << QPointF(1, 8) << QPointF(2, 8);
+    QBarSeries *series = new QBarSeries();
+    QBarSet *set = new QBarSet(QString("set"));
+    *set << 2 << 2 << 2;
+    series->append(set);
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->addSeries(line);
+    view.chart()->addSeries(series);
+    QValueAxis *axisX = new QValueAxis();
+    axisX->setRange(-0.5, 2.5);
+    QValueAxis *axisY = new QValueAxis();
+    axisY->setRange(0, 10);
+    view.chart()->setAxisX(axisX, line);
+    view.chart()->setAxisY(axisY, line);
+    view.chart()->setAxisX(axisX, series);
+    view.chart()->setAxisY(axisY, series);
+    view.setMouseTracking(true);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy lineHoveredSpy(line, SIGNAL(hovered(QPointF,bool)));
+    QSignalSpy lineClickedSpy(line, SIGNAL(clicked(QPointF)));
+    QSignalSpy barHoveredSpy(series, SIGNAL(hovered(bool,int,QBarSet*)));
+    QSignalSpy barClickedSpy(series, SIGNAL(clicked(int,QBarSet*)));
+
+    const QPoint linePos = view.mapFromScene(view.chart()->mapToPosition(QPointF(1, 8), line));
+    QTest::mouseMove(view.viewport(), linePos);
+    TRY_COMPARE(lineHoveredSpy.count(), 1);
+    QCOMPARE(lineHoveredSpy.takeFirst().at(1).toBool(), true);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, linePos);
+    TRY_COMPARE(lineClickedSpy.count(), 1);
+    QCOMPARE(barHoveredSpy.count(), 0);
+    QCOMPARE(barClickedSpy.count(), 0);
+
+    // The bars themselves are still hit
+    const QPoint barPos = view.mapFromScene(view.chart()->mapToPosition(QPointF(1, 1), series));
+    QTest::mouseMove(view.viewport(), barPos);
+    TRY_COMPARE(barHoveredSpy.count(), 1);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, barPos);
+    TRY_COMPARE(barClickedSpy.count(), 1);
+    const QList<QVariant> arguments = barClickedSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 1);
+    QCOMPARE(qvariant_cast<QBarSet *>(arguments.at(1)), set);
+    QCOMPARE(lineClickedSpy.count(), 1);
+}
+
+void tst_QBarSeries::categoryAggregates()
+{
+    TestBarSeries series;
+    QBarSet *set1 = new QBarSet(QString("set 1"));
+    QBarSet *set2 = new QBarSet(QString("set 2"));
+    *set1 << 1 << -2 << 3 << 4;
+    *set2 << 5 << 6 << -7;
+    series.append(set1);
+    series.append(set2);
+    verifyCategoryAggregates(&series);
+    QCOMPARE(series.d()->categorySum(2), -4.0);
+    QCOMPARE(series.d()->absoluteCategorySum(2), 10.0);
+
+    // A value change recalculates its category
+    set2->replace(1, -20);
+    verifyCategoryAggregates(&series);
+    QCOMPARE(series.d()->categoryBottom(1), -22.0);
+    set1->replace(3, 40);
+    verifyCategoryAggregates(&series);
+    QCOMPARE(series.d()->max(), 40.0);
+
+    // Inserted and removed values shift the later categories
+    set2->insert(0, 100);
+    verifyCategoryAggregates(&series);
+    QCOMPARE(series.d()->categorySum(0), 101.0);
+    set1->remove(1, 2);
+    verifyCategoryAggregates(&series);
+    set1->append(QList<qreal>() << -50 << 8);
+    verifyCategoryAggregates(&series);
+    QCOMPARE(series.d()->min(), -50.0);
+
+    // Adding and removing sets rebuilds all categories
+    QBarSet *set3 = new QBarSet(QString("set 3"));
+    *set3 << 2 << 2 << 2 << 2 << 2 << 2 << 2;
+    series.append(set3);
+    verifyCategoryAggregates(&series);
+    QCOMPARE(series.d()->categoryCount(), 7);
+    series.remove(set2);
+    verifyCategoryAggregates(&series);
+    QCOMPARE(series.d()->categorySum(0), 3.0);
+    series.clear();
+    verifyCategoryAggregates(&series);
+    QCOMPARE(series.d()->categoryCount(), 0);
+}
+
+void tst_QBarSeries::labelsRendering()
+{
+    const QSize size(400, 300);
+    const QList<qreal> values = QList<qreal>() << 10 << 7 << 6 << 9 << 4;
+    QScopedPointer<QChart> expectedChart(createLabelChart(values));
+    const QImage expected = QChartRenderer(expectedChart.data()).toImage(size);
+
+    QScopedPointer<QChart> chart(createLabelChart(QList<qreal>() << 10 << 3 << 6 << 9 << 4));
+    QChartRenderer renderer(chart.data());
+    QBarSeries *series = qobject_cast<QBarSeries *>(chart->series().first());
+    QBarSet *set = series->barSets().first();
+    QBarCategoryAxis *axisX = qobject_cast<QBarCategoryAxis *>(chart->axisX(series));
+    QVERIFY(axisX);
+    const QStringList categories = axisX->categories();
+    QVERIFY(renderer.toImage(size) != expected);
+
+    // A changed value gets a new label, not the one formatted for the old value
+    set->replace(1, 7);
+    QCOMPARE(renderer.toImage(size), expected);
+
+    // Labels only change with the format, the bars stay the same
+    series->setLabelsFormat(QStringLiteral("<b>@value</b>"));
+    QVERIFY(renderer.toImage(size) != expected);
+    series->setLabelsFormat(QString());
+    QCOMPARE(renderer.toImage(size), expected);
+
+    series->setLabelsVisible(false);
+    QVERIFY(renderer.toImage(size) != expected);
+    series->setLabelsVisible(true);
+    QCOMPARE(renderer.toImage(size), expected);
+
+    // Labels of bars changed while scrolled out of view are formatted when they come back
+    axisX->setRange(categories.at(3), categories.at(4));
+    renderer.toImage(size);
+    set->replace(0, 3);
+    set->replace(0, 10);
+    set->replace(1, 8);
+    renderer.toImage(size);
+    set->replace(1, 7);
+    axisX->setRange(categories.first(), categories.last());
+    QCOMPARE(renderer.toImage(size), expected);
+
+    // Zero bars have no labels
+    QScopedPointer<QChart> zeroChart(createLabelChart(QList<qreal>() << 0 << 0 << 0));
+    QBarSeries *zeroSeries = qobject_cast<QBarSeries *>(zeroChart->series().first());
+    QChartRenderer zeroRenderer(zeroChart.data());
+    const QImage zeroLabels = zeroRenderer.toImage(size);
+    zeroSeries->setLabelsVisible(false);
+    QCOMPARE(zeroRenderer.toImage(size), zeroLabels);
+}
+
 QTEST_MAIN(tst_QBarSeries)
 
 #include "tst_qbarseries.moc"
@@ -60,6 +60,7 @@ private slots:
     void remove();
     void replace_data();
     void replace();
+    void replaceValues();
     void at_data();
     void at();
     void atOperator_data();
@@ -349,6 +350,37 @@ void tst_QBarSet::replace()
     QVERIFY(valueSpy.count() == 2);
 }
 
+void tst_QBarSet::replaceValues()
+{
+    QSignalSpy replacedSpy(m_barset, SIGNAL(valuesReplaced()));
+    QSignalSpy addedSpy(m_barset, SIGNAL(valuesAdded(int,int)));
+    QSignalSpy removedSpy(m_barset, SIGNAL(valuesRemoved(int,int)));
+
+    m_barset->append(1.0);
+    m_barset->append(2.0);
+    QCOMPARE(addedSpy.count(), 2);
+
+    QVector<qreal> values;
+    values << 3.0 << 4.0 << 5.0;
+    m_barset->replace(values);
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(removedSpy.count(), 0);
+    QCOMPARE(addedSpy.count(), 2);
+    QCOMPARE(m_barset->count(), 3);
+    QCOMPARE(m_barset->sum(), 12.0);
+    QCOMPARE(m_barset->at(2), 5.0);
+
+    // Invalid values are dropped like when appending
+    m_barset->replace(QVector<qreal>() << 6.0 << qQNaN() << 7.0);
+    QCOMPARE(replacedSpy.count(), 2);
+    QCOMPARE(m_barset->count(), 2);
+    QCOMPARE(m_barset->at(1), 7.0);
+
+    m_barset->replace(QVector<qreal>());
+    QCOMPARE(replacedSpy.count(), 3);
+    QCOMPARE(m_barset->count(), 0);
+}
+
 void tst_QBarSet::at_data()
 {
 
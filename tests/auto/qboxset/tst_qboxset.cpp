@@ -0,0 +1,231 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtCharts/QBoxSet>
+#include <QtTest/QtTest>
+#include <algorithm>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_QBoxSet : public QObject
+{
+    Q_OBJECT
+
+public Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+private Q_SLOTS:
+    void appendSample();
+    void appendSamplesFewerThanFive();
+    void appendSamplesQuantiles_data();
+    void appendSamplesQuantiles();
+    void sampleTolerance();
+    void clearSamples();
+
+private:
+    QBoxSet *m_boxSet;
+};
+
+static qreal exactQuantile(QVector<qreal> samples, qreal quantile)
+{
+    std::sort(samples.begin(), samples.end());
+    const qreal rank = quantile * (samples.count() - 1);
+    const int lower = int(rank);
+    if (lower + 1 >= samples.count())
+        return samples.last();
+    return samples[lower] + (rank - lower) * (samples[lower + 1] - samples[lower]);
+}
+
+void tst_QBoxSet::initTestCase()
+{
+}
+
+void tst_QBoxSet::cleanupTestCase()
+{
+    QTest::qWait(1); // Allow final deleteLaters to run
+}
+
+void tst_QBoxSet::init()
+{
+    m_boxSet = new QBoxSet();
+}
+
+void tst_QBoxSet::cleanup()
+{
+    delete m_boxSet;
+    m_boxSet = nullptr;
+}
+
+void tst_QBoxSet::appendSample()
+{
+    QSignalSpy valuesSpy(m_boxSet, SIGNAL(valuesChanged()));
+
+    m_boxSet->appendSample(3.0);
+    QCOMPARE(m_boxSet->sampleCount(), 1);
+    QCOMPARE(valuesSpy.count(), 1);
+    for (int i = QBoxSet::LowerExtreme; i <= QBoxSet::UpperExtreme; i++)
+        QCOMPARE(m_boxSet->at(i), 3.0);
+
+    // Invalid samples are ignored
+    m_boxSet->appendSample(qQNaN());
+    m_boxSet->appendSample(qInf());
+    QCOMPARE(m_boxSet->sampleCount(), 1);
+    QCOMPARE(valuesSpy.count(), 1);
+}
+
+void tst_QBoxSet::appendSamplesFewerThanFive()
+{
+    // Up to five samples the quartiles are interpolated between the samples
+    m_boxSet->appendSamples(QVector<qreal>() << 4.0 << 1.0 << 3.0 << 2.0);
+    QCOMPARE(m_boxSet->sampleCount(), 4);
+    QCOMPARE(m_boxSet->at(QBoxSet::LowerExtreme), 1.0);
+    QCOMPARE(m_boxSet->at(QBoxSet::LowerQuartile), 1.75);
+    QCOMPARE(m_boxSet->at(QBoxSet::Median), 2.5);
+    QCOMPARE(m_boxSet->at(QBoxSet::UpperQuartile), 3.25);
+    QCOMPARE(m_boxSet->at(QBoxSet::UpperExtreme), 4.0);
+}
+
+void tst_QBoxSet::appendSamplesQuantiles_data()
+{
+    QTest::addColumn<QVector<qreal> >("samples");
+
+    // Samples are permuted so that they do not arrive in order
+    QVector<qreal> uniform;
+    for (int i = 0; i < 10000; i++)
+        uniform << qreal((i * 7919) % 10000);
+    QTest::newRow("uniform") << uniform;
+
+    QVector<qreal> skewed;
+    for (int i = 0; i < 10000; i++) {
+        const qreal x = qreal((i * 7919) % 10000) / 10000;
+        skewed << x * x * x * 10000;
+    }
+    QTest::newRow("skewed") << skewed;
+
+    QVector<qreal> offset;
+    foreach (qreal sample, uniform)
+        offset << 1.0e6 + sample;
+    QTest::newRow("offset") << offset;
+
+    QVector<qreal> sorted = uniform;
+    std::sort(sorted.begin(), sorted.end());
+    QTest::newRow("sorted") << sorted;
+}
+
+void tst_QBoxSet::appendSamplesQuantiles()
+{
+    QFETCH(QVector<qreal>, samples);
+
+    // Appending the samples one by one and in one batch gives the same estimates
+    QBoxSet batch;
+    batch.appendSamples(samples);
+    foreach (qreal sample, samples)
+        m_boxSet->appendSample(sample);
+
+    QCOMPARE(m_boxSet->sampleCount(), samples.count());
+    QCOMPARE(batch.sampleCount(), samples.count());
+
+    const qreal minimum = *std::min_element(samples.constBegin(), samples.constEnd());
+    const qreal maximum = *std::max_element(samples.constBegin(), samples.constEnd());
+    QCOMPARE(m_boxSet->at(QBoxSet::LowerExtreme), minimum);
+    QCOMPARE(m_boxSet->at(QBoxSet::UpperExtreme), maximum);
+
+    // The estimates stay within one percent of the range from the exact quantiles
+    const qreal tolerance = (maximum - minimum) / 100;
+    const qreal quantiles[] = { 0.25, 0.5, 0.75 };
+    const int positions[] = { QBoxSet::LowerQuartile, QBoxSet::Median, QBoxSet::UpperQuartile };
+    for (int i = 0; i < 3; i++) {
+        const qreal exact = exactQuantile(samples, quantiles[i]);
+        QVERIFY2(qAbs(m_boxSet->at(positions[i]) - exact) <= tolerance,
+                 qPrintable(QString("quantile %1: %2, expected %3").arg(quantiles[i])
+                            .arg(m_boxSet->at(positions[i])).arg(exact)));
+        QCOMPARE(batch.at(positions[i]), m_boxSet->at(positions[i]));
+    }
+}
+
+void tst_QBoxSet::sampleTolerance()
+{
+    QCOMPARE(m_boxSet->sampleTolerance(), 0.0);
+    m_boxSet->setSampleTolerance(-1.0);
+    QCOMPARE(m_boxSet->sampleTolerance(), 0.0);
+
+    QVector<qreal> samples;
+    for (int i = 0; i < 1000; i++)
+        samples << qreal((i * 7919) % 1000);
+    m_boxSet->appendSamples(samples);
+
+    m_boxSet->setSampleTolerance(10.0);
+    QCOMPARE(m_boxSet->sampleTolerance(), 10.0);
+
+    QSignalSpy valuesSpy(m_boxSet, SIGNAL(valuesChanged()));
+    const qreal median = m_boxSet->at(QBoxSet::Median);
+
+    // Samples inside the range move the estimates by less than the tolerance
+    m_boxSet->appendSamples(QVector<qreal>() << 400.0 << 600.0);
+    m_boxSet->appendSample(500.0);
+    QCOMPARE(m_boxSet->sampleCount(), 1003);
+    QCOMPARE(valuesSpy.count(), 0);
+    QCOMPARE(m_boxSet->at(QBoxSet::Median), median);
+    QCOMPARE(m_boxSet->at(QBoxSet::UpperExtreme), 999.0);
+
+    // A new maximum moves the upper extreme by more than the tolerance
+    m_boxSet->appendSample(2000.0);
+    QCOMPARE(valuesSpy.count(), 1);
+    QCOMPARE(m_boxSet->at(QBoxSet::UpperExtreme), 2000.0);
+}
+
+void tst_QBoxSet::clearSamples()
+{
+    m_boxSet->appendSamples(QVector<qreal>() << -100.0 << 1.0 << 2.0 << 3.0 << 4.0 << 100.0);
+    QCOMPARE(m_boxSet->sampleCount(), 6);
+
+    QSignalSpy clearedSpy(m_boxSet, SIGNAL(cleared()));
+    m_boxSet->clear();
+    QCOMPARE(clearedSpy.count(), 1);
+    QCOMPARE(m_boxSet->sampleCount(), 0);
+    for (int i = QBoxSet::LowerExtreme; i <= QBoxSet::UpperExtreme; i++)
+        QCOMPARE(m_boxSet->at(i), 0.0);
+
+    // The estimates start over, the earlier extremes are forgotten
+    m_boxSet->appendSamples(QVector<qreal>() << 10.0 << 20.0 << 30.0);
+    QCOMPARE(m_boxSet->sampleCount(), 3);
+    QCOMPARE(m_boxSet->at(QBoxSet::LowerExtreme), 10.0);
+    QCOMPARE(m_boxSet->at(QBoxSet::LowerQuartile), 15.0);
+    QCOMPARE(m_boxSet->at(QBoxSet::Median), 20.0);
+    QCOMPARE(m_boxSet->at(QBoxSet::UpperQuartile), 25.0);
+    QCOMPARE(m_boxSet->at(QBoxSet::UpperExtreme), 30.0);
+}
+
+QTEST_GUILESS_MAIN(tst_QBoxSet)
+
+#include "tst_qboxset.moc"
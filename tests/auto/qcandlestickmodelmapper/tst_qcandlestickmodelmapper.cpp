@@ -73,6 +73,7 @@ private Q_SLOTS:
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void dataRole();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -554,6 +555,29 @@ void tst_qcandlestickmodelmapper::modelUpdateCell()
     QCOMPARE(m_series->sets().at(index.row())->timestamp(), newValue);
 }
 
+void tst_qcandlestickmodelmapper::dataRole()
+{
+    // setup the mapper
+    createVerticalMapper();
+    for (int row = 0; row < m_modelRowCount; ++row) {
+        for (int column = 0; column < m_modelColumnCount; ++column)
+            m_model->setData(m_model->index(row, column), row * column + 100, Qt::UserRole);
+    }
+    QCOMPARE(m_vMapper->dataRole(), int(Qt::DisplayRole));
+    QCOMPARE(m_series->sets().at(2)->open(), 2.0);
+
+    QSignalSpy spy(m_vMapper, SIGNAL(dataRoleChanged()));
+    m_vMapper->setDataRole(Qt::UserRole);
+    m_vMapper->setDataRole(Qt::UserRole);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(m_series->sets().at(2)->open(), 102.0);
+    QCOMPARE(m_series->sets().at(2)->close(), 112.0);
+
+    m_series->sets().at(2)->setHigh(150.0);
+    QCOMPARE(m_model->data(m_model->index(3, 2), Qt::UserRole).toReal(), 150.0);
+    QCOMPARE(m_model->data(m_model->index(3, 2)).toReal(), 6.0);
+}
+
 void tst_qcandlestickmodelmapper::verticalMapperSignals()
 {
     QVCandlestickModelMapper *mapper = new QVCandlestickModelMapper();
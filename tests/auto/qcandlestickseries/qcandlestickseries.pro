@@ -2,4 +2,6 @@
     error( "Couldn't find the auto.pri file!" )
 }
 
+QT += charts-private
+
 SOURCES += tst_qcandlestickseries.cpp
@@ -30,11 +30,78 @@
 #include <QtCharts/QCandlestickSeries>
 #include <QtCharts/QCandlestickSet>
 #include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <QtCore/QtMath>
 #include <QtTest/QtTest>
+#include <private/qcandlestickseries_p.h>
 #include "tst_definitions.h"
+#include <algorithm>
 
 QT_CHARTS_USE_NAMESPACE
 
+class TestCandlestickSeries : public QCandlestickSeries
+{
+public:
+    QCandlestickSeriesPrivate *d() const
+    {
+        return static_cast<QCandlestickSeriesPrivate *>(d_ptr.data());
+    }
+
+    QVector<CandlestickData> aggregated(int level) const
+    {
+        return d()->aggregatedCandlesticks(level, d()->minimumTimePeriod());
+    }
+
+    // Merges the candlesticks without the cache, in time order
+    QVector<CandlestickData> expectedAggregated(int level) const
+    {
+        QVector<int> rows(count());
+        for (int row = 0; row < rows.count(); ++row)
+            rows[row] = row;
+        std::stable_sort(rows.begin(), rows.end(), [this](int left, int right) {
+            return timestampAt(left) < timestampAt(right);
+        });
+
+        const qreal period = d()->minimumTimePeriod();
+        const qreal origin = timestampAt(rows.first()) - period / 2.0;
+        const qreal mergedPeriod = period * (1 << level);
+        QVector<CandlestickData> merged;
+        int lastBucket = -1;
+        foreach (int row, rows) {
+            const int bucket = qFloor((timestampAt(row) - origin) / mergedPeriod);
+            if (merged.isEmpty() || bucket != lastBucket) {
+                CandlestickData data;
+                data.m_timestamp = origin + (bucket + 0.5) * mergedPeriod;
+                data.m_open = openAt(row);
+                data.m_high = highAt(row);
+                data.m_low = lowAt(row);
+                data.m_close = closeAt(row);
+                merged.append(data);
+                lastBucket = bucket;
+            } else {
+                merged.last().m_high = qMax(merged.last().m_high, highAt(row));
+                merged.last().m_low = qMin(merged.last().m_low, lowAt(row));
+                merged.last().m_close = closeAt(row);
+            }
+        }
+        return merged;
+    }
+};
+
+static void compareCandlesticks(const QVector<CandlestickData> &actual,
+                                const QVector<CandlestickData> &expected)
+{
+    QCOMPARE(actual.count(), expected.count());
+    for (int i = 0; i < actual.count(); ++i) {
+        QCOMPARE(actual.at(i).m_timestamp, expected.at(i).m_timestamp);
+        QCOMPARE(actual.at(i).m_open, expected.at(i).m_open);
+        QCOMPARE(actual.at(i).m_high, expected.at(i).m_high);
+        QCOMPARE(actual.at(i).m_low, expected.at(i).m_low);
+        QCOMPARE(actual.at(i).m_close, expected.at(i).m_close);
+    }
+}
+
 Q_DECLARE_METATYPE(QCandlestickSet *)
 Q_DECLARE_METATYPE(QList<QCandlestickSet *>)
 
@@ -57,6 +124,8 @@ private Q_SLOTS:
     void insert();
     void take();
     void clear();
+    void appendColumns();
+    void replaceColumns();
     void sets();
     void count();
     void type();
@@ -74,8 +143,13 @@ private Q_SLOTS:
     void decreasingColor();
     void brush();
     void pen();
+    void aggregationWidth();
+    void minimumTimePeriod();
+    void aggregatedValues();
+    void aggregationCache();
     void mouseClicked();
     void mouseHovered();
+    void mouseHoveredOverlappingSeries();
     void mousePressed();
     void mouseReleased();
     void mouseDoubleClicked();
@@ -313,6 +387,50 @@ void tst_QCandlestickSeries::clear()
     QCOMPARE(m_series->count(), 0);
 }
 
+void tst_QCandlestickSeries::appendColumns()
+{
+    QSignalSpy countSpy(m_series, SIGNAL(countChanged()));
+
+    m_series->append(m_sets.first());
+    QVERIFY(m_series->append({ 10.0, 11.0 }, { 1.0, 5.0 }, { 6.0, 7.0 }, { 0.5, 1.5 },
+                             { 4.0, 2.0 }));
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(m_series->sets().count(), 1);
+    QCOMPARE(countSpy.count(), 2);
+    QCOMPARE(m_series->timestampAt(0), m_sets.first()->timestamp());
+    QCOMPARE(m_series->closeAt(0), m_sets.first()->close());
+    QCOMPARE(m_series->timestampAt(2), 11.0);
+    QCOMPARE(m_series->openAt(2), 5.0);
+    QCOMPARE(m_series->highAt(2), 7.0);
+    QCOMPARE(m_series->lowAt(2), 1.5);
+    QCOMPARE(m_series->closeAt(2), 2.0);
+
+    // Columns of different length are rejected
+    QVERIFY(!m_series->append({ 12.0 }, { 1.0 }, { 2.0 }, { 0.0 }, {}));
+    QCOMPARE(m_series->count(), 3);
+
+    // Set values follow the set
+    m_sets.first()->setClose(m_sets.first()->close() + 1.0);
+    QCOMPARE(m_series->closeAt(0), m_sets.first()->close());
+
+    m_series->clear();
+    QCOMPARE(m_series->count(), 0);
+}
+
+void tst_QCandlestickSeries::replaceColumns()
+{
+    m_series->append(m_sets);
+    QSignalSpy removeSpy(m_series, SIGNAL(candlestickSetsRemoved(QList<QCandlestickSet *>)));
+
+    QVERIFY(m_series->replace({ 1.0, 2.0, 3.0 }, { 1.0, 2.0, 3.0 }, { 4.0, 4.0, 4.0 },
+                              { 0.0, 0.0, 0.0 }, { 3.0, 2.0, 1.0 }));
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(m_series->sets().count(), 0);
+    QCOMPARE(removeSpy.count(), 1);
+    QCOMPARE(m_series->openAt(1), 2.0);
+    QCOMPARE(m_series->closeAt(2), 1.0);
+}
+
 void tst_QCandlestickSeries::sets()
 {
     m_series->append(m_sets);
@@ -579,6 +697,176 @@ void tst_QCandlestickSeries::pen()
     QCOMPARE(spy.count(), 1);
 }
 
+void tst_QCandlestickSeries::aggregationWidth()
+{
+    QSignalSpy spy(m_series, SIGNAL(aggregationWidthChanged()));
+
+    QCOMPARE(m_series->aggregationWidth(), -1.0);
+
+    m_series->setAggregationWidth(4.0);
+    QCOMPARE(m_series->aggregationWidth(), 4.0);
+    QCOMPARE(spy.count(), 1);
+
+    // Try set same aggregation width
+    m_series->setAggregationWidth(4.0);
+    QCOMPARE(spy.count(), 1);
+
+    m_series->setAggregationWidth(-3.0);
+    QCOMPARE(m_series->aggregationWidth(), -1.0);
+    QCOMPARE(spy.count(), 2);
+}
+
+void tst_QCandlestickSeries::minimumTimePeriod()
+{
+    // The smallest gap between neighboring timestamps is kept up to date incrementally
+    TestCandlestickSeries series;
+    QCOMPARE(series.d()->minimumTimePeriod(), 0.0);
+
+    // Out of order
+    QVERIFY(series.append({ 10, 40, 20 }, { 1, 1, 1 }, { 2, 2, 2 }, { 0, 0, 0 }, { 1, 1, 1 }));
+    QCOMPARE(series.d()->minimumTimePeriod(), 10.0);
+    QCandlestickSet *set = new QCandlestickSet(1, 2, 0, 1, 23);
+    QVERIFY(series.append(set));
+    QCOMPARE(series.d()->minimumTimePeriod(), 3.0);
+
+    // Removing the row that held the minimum gap restores the gap around it
+    QVERIFY(series.remove(set));
+    delete set;
+    QCOMPARE(series.d()->minimumTimePeriod(), 10.0);
+
+    // Duplicate timestamps are a gap of zero until one of them goes away
+    QCandlestickSet *duplicate = new QCandlestickSet(1, 2, 0, 1, 40);
+    QVERIFY(series.append(duplicate));
+    QCOMPARE(series.d()->minimumTimePeriod(), 0.0);
+
+    // Moving an attached set updates the gaps on both sides of its old and new position
+    duplicate->setTimestamp(45);
+    QCOMPARE(series.d()->minimumTimePeriod(), 5.0);
+    duplicate->setTimestamp(7);
+    QCOMPARE(series.d()->minimumTimePeriod(), 3.0);
+    duplicate->setTimestamp(30);
+    QCOMPARE(series.d()->minimumTimePeriod(), 10.0);
+
+    // Replacing and clearing the columns rebuilds the gaps
+    QVERIFY(series.replace({ 150, 100, 130, 130 }, { 1, 1, 1, 1 }, { 2, 2, 2, 2 },
+                           { 0, 0, 0, 0 }, { 1, 1, 1, 1 }));
+    QCOMPARE(series.d()->minimumTimePeriod(), 0.0);
+    QVERIFY(series.replace({ 150, 100, 130 }, { 1, 1, 1 }, { 2, 2, 2 }, { 0, 0, 0 },
+                           { 1, 1, 1 }));
+    QCOMPARE(series.d()->minimumTimePeriod(), 20.0);
+    series.clear();
+    QCOMPARE(series.d()->minimumTimePeriod(), 0.0);
+}
+
+void tst_QCandlestickSeries::aggregatedValues()
+{
+    TestCandlestickSeries series;
+    QVERIFY(series.append({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 },
+                          { 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0 },
+                          { 15.0, 90.0, 35.0, 45.0, 55.0, 65.0, 99.0 },
+                          { 5.0, 15.0, 2.0, 35.0, 45.0, 1.0, 65.0 },
+                          { 12.0, 22.0, 32.0, 42.0, 52.0, 62.0, 72.0 }));
+
+    // Level 0 keeps every candlestick
+    compareCandlesticks(series.aggregated(0), series.expectedAggregated(0));
+    QCOMPARE(series.aggregated(0).count(), 7);
+
+    // Pairs take the first open, the highest high, the lowest low and the last close
+    QVector<CandlestickData> merged = series.aggregated(1);
+    QCOMPARE(merged.count(), 4);
+    QCOMPARE(merged.at(0).m_timestamp, 1.5);
+    QCOMPARE(merged.at(0).m_open, 10.0);
+    QCOMPARE(merged.at(0).m_high, 90.0);
+    QCOMPARE(merged.at(0).m_low, 5.0);
+    QCOMPARE(merged.at(0).m_close, 22.0);
+    QCOMPARE(merged.at(1).m_timestamp, 3.5);
+    QCOMPARE(merged.at(1).m_open, 30.0);
+    QCOMPARE(merged.at(1).m_high, 45.0);
+    QCOMPARE(merged.at(1).m_low, 2.0);
+    QCOMPARE(merged.at(1).m_close, 42.0);
+    QCOMPARE(merged.at(3).m_timestamp, 7.5);
+    QCOMPARE(merged.at(3).m_open, 70.0);
+    QCOMPARE(merged.at(3).m_high, 99.0);
+    QCOMPARE(merged.at(3).m_low, 65.0);
+    QCOMPARE(merged.at(3).m_close, 72.0);
+
+    merged = series.aggregated(2);
+    QCOMPARE(merged.count(), 2);
+    QCOMPARE(merged.at(0).m_timestamp, 2.5);
+    QCOMPARE(merged.at(0).m_open, 10.0);
+    QCOMPARE(merged.at(0).m_high, 90.0);
+    QCOMPARE(merged.at(0).m_low, 2.0);
+    QCOMPARE(merged.at(0).m_close, 42.0);
+    QCOMPARE(merged.at(1).m_open, 50.0);
+    QCOMPARE(merged.at(1).m_high, 99.0);
+    QCOMPARE(merged.at(1).m_low, 1.0);
+    QCOMPARE(merged.at(1).m_close, 72.0);
+
+    // Rows out of time order are merged in time order
+    TestCandlestickSeries reversed;
+    QVERIFY(reversed.append({ 4.0, 3.0, 2.0, 1.0 }, { 40.0, 30.0, 20.0, 10.0 },
+                            { 45.0, 35.0, 25.0, 15.0 }, { 35.0, 25.0, 15.0, 5.0 },
+                            { 42.0, 32.0, 22.0, 12.0 }));
+    merged = reversed.aggregated(1);
+    QCOMPARE(merged.count(), 2);
+    QCOMPARE(merged.at(0).m_open, 10.0);
+    QCOMPARE(merged.at(0).m_close, 22.0);
+    QCOMPARE(merged.at(1).m_open, 30.0);
+    QCOMPARE(merged.at(1).m_close, 42.0);
+}
+
+void tst_QCandlestickSeries::aggregationCache()
+{
+    TestCandlestickSeries series;
+    QList<QCandlestickSet *> sets;
+    for (int i = 0; i < 8; ++i) {
+        QCandlestickSet *set = new QCandlestickSet(10.0 + i, 20.0 + i, 5.0 + i, 15.0 + i,
+                                                   qreal(i + 1));
+        sets.append(set);
+        QVERIFY(series.append(set));
+    }
+    compareCandlesticks(series.aggregated(1), series.expectedAggregated(1));
+    compareCandlesticks(series.aggregated(2), series.expectedAggregated(2));
+
+    // Appending in time order extends the cached candlesticks
+    QCandlestickSet *appended = new QCandlestickSet(30.0, 40.0, 1.0, 35.0, 9.0);
+    sets.append(appended);
+    QVERIFY(series.append(appended));
+    compareCandlesticks(series.aggregated(1), series.expectedAggregated(1));
+    QCOMPARE(series.aggregated(1).last().m_open, 30.0);
+    compareCandlesticks(series.aggregated(2), series.expectedAggregated(2));
+
+    // Changing a set value drops the cache
+    sets.at(2)->setHigh(100.0);
+    sets.at(5)->setLow(-100.0);
+    compareCandlesticks(series.aggregated(1), series.expectedAggregated(1));
+    QCOMPARE(series.aggregated(1).at(1).m_high, 100.0);
+    compareCandlesticks(series.aggregated(2), series.expectedAggregated(2));
+    QCOMPARE(series.aggregated(2).at(1).m_low, -100.0);
+
+    // Removing a set drops the cache, also when a later append restores the row count
+    QVERIFY(series.remove(sets.takeFirst()));
+    QCandlestickSet *replacement = new QCandlestickSet(50.0, 60.0, 45.0, 55.0, 10.0);
+    sets.append(replacement);
+    QVERIFY(series.append(replacement));
+    QCOMPARE(series.count(), 9);
+    compareCandlesticks(series.aggregated(1), series.expectedAggregated(1));
+    QCOMPARE(series.aggregated(1).first().m_open, sets.first()->open());
+    compareCandlesticks(series.aggregated(2), series.expectedAggregated(2));
+
+    // Inserting before the last row drops the cache
+    QCandlestickSet *inserted = new QCandlestickSet(70.0, 80.0, 65.0, 75.0, 0.0);
+    QVERIFY(series.insert(0, inserted));
+    compareCandlesticks(series.aggregated(1), series.expectedAggregated(1));
+    QCOMPARE(series.aggregated(1).first().m_open, 70.0);
+    compareCandlesticks(series.aggregated(2), series.expectedAggregated(2));
+
+    // Appending out of time order rebuilds the cache
+    QVERIFY(series.append({ 5.5 }, { 90.0 }, { 95.0 }, { 85.0 }, { 91.0 }));
+    compareCandlesticks(series.aggregated(1), series.expectedAggregated(1));
+    compareCandlesticks(series.aggregated(2), series.expectedAggregated(2));
+}
+
 void tst_QCandlestickSeries::mouseClicked()
 {
     SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
@@ -758,6 +1046,58 @@ void tst_QCandlestickSeries::mouseHovered()
     setSpyArgs.clear();
 }
 
+void tst_QCandlestickSeries::mouseHoveredOverlappingSeries()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+    SKIP_IF_FLAKY_MOUSE_MOVE();
+
+    // The candlestick item covers the whole plot area, but only the candlesticks may take
+    // hover and mouse events. A line series stacked below must get the rest.
+    QLineSeries *line = new QLineSeries();
+    *line << QPointF(1.0, 8.0) << QPointF(2.0, 8.0) << QPointF(3.0, 8.0);
+    QCandlestickSeries *series = new QCandlestickSeries();
+    for (int i = 1; i <= 3; ++i)
+        series->append(new QCandlestickSet(2.0, 3.0, 1.0, 1.5, i));
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->addSeries(line);
+    view.chart()->addSeries(series);
+    QValueAxis *axisX = new QValueAxis();
+    axisX->setRange(0.0, 4.0);
+    QValueAxis *axisY = new QValueAxis();
+    axisY->setRange(0.0, 10.0);
+    view.chart()->setAxisX(axisX, line);
+    view.chart()->setAxisY(axisY, line);
+    view.chart()->setAxisX(axisX, series);
+    view.chart()->setAxisY(axisY, series);
+    view.setMouseTracking(true);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy lineHoveredSpy(line, SIGNAL(hovered(QPointF,bool)));
+    QSignalSpy lineClickedSpy(line, SIGNAL(clicked(QPointF)));
+    QSignalSpy seriesHoveredSpy(series, SIGNAL(hovered(bool,QCandlestickSet*)));
+
+    // Above the middle candlestick only the line is hit
+    const QPoint linePos = view.mapFromScene(view.chart()->mapToPosition(QPointF(2.0, 8.0), line));
+    QTest::mouseMove(view.viewport(), linePos);
+    TRY_COMPARE(lineHoveredSpy.count(), 1);
+    QCOMPARE(lineHoveredSpy.takeFirst().at(1).toBool(), true);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, linePos);
+    TRY_COMPARE(lineClickedSpy.count(), 1);
+    QCOMPARE(seriesHoveredSpy.count(), 0);
+
+    // The candlestick itself still takes hover
+    const QPoint candlestickPos = view.mapFromScene(
+                view.chart()->mapToPosition(QPointF(2.0, 1.75), series));
+    QTest::mouseMove(view.viewport(), candlestickPos);
+    TRY_COMPARE(seriesHoveredSpy.count(), 1);
+    const QList<QVariant> arguments = seriesHoveredSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toBool(), true);
+    QCOMPARE(qvariant_cast<QCandlestickSet *>(arguments.at(1)), series->sets().at(1));
+}
+
 void tst_QCandlestickSeries::mousePressed()
 {
     SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
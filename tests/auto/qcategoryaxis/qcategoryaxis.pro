@@ -1,5 +1,8 @@
 !include( ../auto.pri ) {
     error( "Couldn't find the auto.pri file!" )
 }
+
+QT += charts-private
+
 HEADERS += ../qabstractaxis/tst_qabstractaxis.h
 SOURCES += tst_qcategoryaxis.cpp ../qabstractaxis/tst_qabstractaxis.cpp
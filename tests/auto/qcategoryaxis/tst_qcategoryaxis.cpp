@@ -30,6 +30,37 @@
 #include "../qabstractaxis/tst_qabstractaxis.h"
 #include <QtCharts/QCategoryAxis>
 #include <QtCharts/QLineSeries>
+#include <private/chartaxiselement_p.h>
+#include <private/qcategoryaxis_p.h>
+#include <algorithm>
+
+class TestCategoryAxis : public QCategoryAxis
+{
+public:
+    QCategoryAxisPrivate *d() const { return static_cast<QCategoryAxisPrivate *>(d_ptr.data()); }
+    ChartAxisElement *item() const { return d_ptr->axisItem(); }
+};
+
+// Gives access to the label items of an axis item
+class AxisElementAccess : public ChartAxisElement
+{
+public:
+    static QList<QGraphicsTextItem *> visibleLabels(ChartAxisElement *element)
+    {
+        QList<QGraphicsTextItem *> labels;
+        foreach (QGraphicsItem *item, (element->*&AxisElementAccess::labelItems)()) {
+            QGraphicsTextItem *label = static_cast<QGraphicsTextItem *>(item);
+            if (label->isVisible() && !label->toPlainText().isEmpty())
+                labels.append(label);
+        }
+        return labels;
+    }
+
+    static int labelItemCount(ChartAxisElement *element)
+    {
+        return (element->*&AxisElementAccess::labelItems)().count();
+    }
+};
 
 class tst_QCategoryAxis: public tst_QAbstractAxis
 {
@@ -68,6 +99,11 @@ private slots:
     void interval_data();
     void interval();
     void reverse();
+    void visibleCategories_data();
+    void visibleCategories();
+    void visibleLabelItems();
+    void categoryLookup();
+    void replaceLabel();
 
 private:
     QCategoryAxis* m_categoryaxis;
@@ -343,6 +379,153 @@ void tst_QCategoryAxis::reverse()
     QCOMPARE(m_categoryaxis->isReverse(), true);
 }
 
+void tst_QCategoryAxis::visibleCategories_data()
+{
+    QTest::addColumn<qreal>("min");
+    QTest::addColumn<qreal>("max");
+    QTest::addColumn<int>("first");
+    QTest::addColumn<int>("last");
+
+    // Categories [0, 10], [10, 20] and [20, 30]
+    QTest::newRow("all") << (qreal)-5 << (qreal)35 << 0 << 2;
+    QTest::newRow("exact") << (qreal)0 << (qreal)30 << 0 << 2;
+    QTest::newRow("first two") << (qreal)5 << (qreal)15 << 0 << 1;
+    QTest::newRow("inside one") << (qreal)12 << (qreal)18 << 1 << 1;
+    QTest::newRow("last") << (qreal)25 << (qreal)40 << 2 << 2;
+    QTest::newRow("below") << (qreal)-20 << (qreal)-10 << 0 << -1;
+    QTest::newRow("above") << (qreal)35 << (qreal)40 << 0 << -1;
+}
+
+void tst_QCategoryAxis::visibleCategories()
+{
+    QFETCH(qreal, min);
+    QFETCH(qreal, max);
+    QFETCH(int, first);
+    QFETCH(int, last);
+
+    TestCategoryAxis axis;
+    axis.append("a", 10);
+    axis.append("b", 20);
+    axis.append("c", 30);
+
+    int visibleFirst;
+    int visibleLast;
+    axis.d()->visibleCategories(min, max, &visibleFirst, &visibleLast);
+    QCOMPARE(visibleFirst, first);
+    QCOMPARE(visibleLast, last);
+}
+
+void tst_QCategoryAxis::visibleLabelItems()
+{
+    TestCategoryAxis *axis = new TestCategoryAxis();
+    for (int i = 0; i < 1000; i++)
+        axis->append(QString::number(i), i + 1);
+
+    QLineSeries *series = new QLineSeries();
+    *series << QPointF(0, 0) << QPointF(1000, 1);
+    QChartView view;
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    view.chart()->setAxisX(axis, series);
+    view.chart()->legend()->hide();
+    axis->setRange(100.5, 110.5);
+    view.resize(800, 300);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QVERIFY(axis->item());
+
+    // Only the categories within the range get label items
+    QTRY_VERIFY(!AxisElementAccess::visibleLabels(axis->item()).isEmpty());
+    QVERIFY(AxisElementAccess::labelItemCount(axis->item()) <= 12 + 16);
+    QStringList texts;
+    foreach (QGraphicsTextItem *label, AxisElementAccess::visibleLabels(axis->item()))
+        texts.append(label->toPlainText());
+    for (int i = 101; i <= 109; i++)
+        QVERIFY2(texts.contains(QString::number(i)), qPrintable(QString::number(i)));
+    foreach (const QString &text, texts) {
+        QVERIFY2(text.toInt() >= 100 && text.toInt() <= 110, qPrintable(text));
+    }
+
+    // Labels that would overlap are left out
+    axis->setRange(0, 1000);
+    QTRY_VERIFY(AxisElementAccess::visibleLabels(axis->item()).count() < 1000 / 2);
+    QList<QRectF> rects;
+    foreach (QGraphicsTextItem *label, AxisElementAccess::visibleLabels(axis->item()))
+        rects.append(label->sceneBoundingRect());
+    std::sort(rects.begin(), rects.end(), [](const QRectF &left, const QRectF &right) {
+        return left.left() < right.left();
+    });
+    QVERIFY(rects.count() > 1);
+    for (int i = 1; i < rects.count(); i++)
+        QVERIFY(rects.at(i - 1).right() <= rects.at(i).left());
+}
+
+void tst_QCategoryAxis::categoryLookup()
+{
+    TestCategoryAxis axis;
+    axis.setStartValue(-10);
+    axis.append("a", 10);
+    axis.append("b", 20);
+    axis.append("c", 30);
+
+    QCOMPARE(axis.d()->categoryIndex("a"), 0);
+    QCOMPARE(axis.d()->categoryIndex("c"), 2);
+    QCOMPARE(axis.d()->categoryIndex("d"), -1);
+
+    QCOMPARE(axis.d()->categoryAt(-10), 0);
+    QCOMPARE(axis.d()->categoryAt(9.5), 0);
+    QCOMPARE(axis.d()->categoryAt(10), 1);
+    QCOMPARE(axis.d()->categoryAt(25), 2);
+    QCOMPARE(axis.d()->categoryAt(30), 2);
+    QCOMPARE(axis.d()->categoryAt(-11), -1);
+    QCOMPARE(axis.d()->categoryAt(31), -1);
+
+    // Indexes follow the categories after a removal
+    axis.remove("a");
+    QCOMPARE(axis.d()->categoryIndex("a"), -1);
+    QCOMPARE(axis.d()->categoryIndex("b"), 0);
+    QCOMPARE(axis.d()->categoryIndex("c"), 1);
+    QCOMPARE(axis.startValue("b"), (qreal)-10);
+    QCOMPARE(axis.d()->categoryAt(0), 0);
+    QCOMPARE(axis.d()->categoryAt(25), 1);
+}
+
+void tst_QCategoryAxis::replaceLabel()
+{
+    TestCategoryAxis axis;
+    axis.append("a", 10);
+    axis.append("b", 20);
+    axis.append("c", 30);
+    QSignalSpy spy(&axis, SIGNAL(categoriesChanged()));
+
+    axis.replaceLabel("b", "replaced");
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(axis.categoriesLabels(), QStringList() << "a" << "replaced" << "c");
+    QCOMPARE(axis.d()->categoryIndex("replaced"), 1);
+    QCOMPARE(axis.d()->categoryIndex("b"), -1);
+    QCOMPARE(axis.startValue("replaced"), (qreal)10);
+    QCOMPARE(axis.endValue("replaced"), (qreal)20);
+
+    // Labels stay unique, as with append()
+    axis.replaceLabel("replaced", "c");
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(axis.categoriesLabels(), QStringList() << "a" << "replaced" << "c");
+    QCOMPARE(axis.d()->categoryIndex("replaced"), 1);
+    QCOMPARE(axis.d()->categoryIndex("c"), 2);
+    QCOMPARE(axis.endValue("c"), (qreal)30);
+
+    // Unknown labels are ignored
+    axis.replaceLabel("b", "d");
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(axis.d()->categoryIndex("d"), -1);
+
+    // The replaced label can be appended again
+    axis.append("b", 40);
+    QCOMPARE(axis.count(), 4);
+    QCOMPARE(axis.d()->categoryIndex("b"), 3);
+    QCOMPARE(axis.startValue("b"), (qreal)30);
+}
+
 QTEST_MAIN(tst_QCategoryAxis)
 #include "tst_qcategoryaxis.moc"
 
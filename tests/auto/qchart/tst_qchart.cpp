@@ -45,6 +45,21 @@
 
 QT_CHARTS_USE_NAMESPACE
 
+// Counts how often the layer it belongs to is rendered
+class PaintCounter : public QGraphicsRectItem
+{
+public:
+    explicit PaintCounter(QGraphicsItem *parent) : QGraphicsRectItem(parent), paintCount(0) {}
+
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+    {
+        paintCount++;
+        QGraphicsRectItem::paint(painter, option, widget);
+    }
+
+    int paintCount;
+};
+
 Q_DECLARE_METATYPE(QAbstractAxis *)
 Q_DECLARE_METATYPE(QValueAxis *)
 Q_DECLARE_METATYPE(QBarCategoryAxis *)
@@ -125,6 +140,8 @@ private slots:
     void backgroundRoundness();
     void zoomInAndOut_data();
     void zoomInAndOut();
+    void cachedLayers();
+    void cachedLayerReuse();
 private:
     void createTestData();
 
@@ -1200,6 +1217,103 @@ void tst_QChart::zoomInAndOut()
     CHECK_AXIS_RANGES_MATCH
 }
 
+void tst_QChart::cachedLayers()
+{
+    // Layers are painted directly unless caching is asked for
+    QCOMPARE(m_chart->isLayerCachingEnabled(), false);
+    m_chart->setTitle("Title");
+    QVERIFY(!m_chart->legend()->graphicsEffect());
+    m_chart->setLayerCachingEnabled(true);
+    QCOMPARE(m_chart->isLayerCachingEnabled(), true);
+    QVERIFY(m_chart->legend()->graphicsEffect());
+
+    QLineSeries *series = new QLineSeries(m_chart);
+    *series << QPointF(0, 0) << QPointF(1, 1) << QPointF(2, 0);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_chart->setTitle("Title");
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    QGraphicsScene *scene = m_chart->scene();
+    const QRect rect = m_chart->rect().toAlignedRect();
+    QImage first(rect.size(), QImage::Format_ARGB32_Premultiplied);
+    first.fill(Qt::white);
+    QPainter painter(&first);
+    scene->render(&painter, rect, rect);
+    painter.end();
+
+    // Changing a cached element must show up in the next frame
+    m_chart->setTitle("Changed");
+    QImage changed(rect.size(), QImage::Format_ARGB32_Premultiplied);
+    changed.fill(Qt::white);
+    painter.begin(&changed);
+    scene->render(&painter, rect, rect);
+    painter.end();
+    QVERIFY(changed != first);
+
+    // ... and so must changing a series drawn above the cached layers
+    m_chart->setTitle("Title");
+    series->replace(1, QPointF(1, 0.5));
+    series->replace(1, QPointF(1, 1));
+    QImage restored(rect.size(), QImage::Format_ARGB32_Premultiplied);
+    restored.fill(Qt::white);
+    painter.begin(&restored);
+    scene->render(&painter, rect, rect);
+    painter.end();
+    QCOMPARE(restored, first);
+
+    // Turning caching off paints the same frame without any cache effects
+    m_chart->setLayerCachingEnabled(false);
+    QVERIFY(!m_chart->legend()->graphicsEffect());
+    foreach (QGraphicsItem *item, scene->items())
+        QVERIFY(!item->graphicsEffect());
+    QImage direct(rect.size(), QImage::Format_ARGB32_Premultiplied);
+    direct.fill(Qt::white);
+    painter.begin(&direct);
+    scene->render(&painter, rect, rect);
+    painter.end();
+    QCOMPARE(direct, first);
+}
+
+void tst_QChart::cachedLayerReuse()
+{
+    QLineSeries *series = new QLineSeries(m_chart);
+    *series << QPointF(0, 0) << QPointF(1, 1) << QPointF(2, 0);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_chart->setLayerCachingEnabled(true);
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    QCoreApplication::processEvents();
+
+    // The legend is a cached layer, so an item in it is only painted when the layer is
+    // rendered into its pixmap
+    PaintCounter *counter = new PaintCounter(m_chart->legend());
+    counter->setRect(QRectF(m_chart->legend()->boundingRect().center(), QSizeF(2, 2)));
+
+    QGraphicsScene *scene = m_chart->scene();
+    const QRect rect = m_chart->rect().toAlignedRect();
+    QImage image(rect.size(), QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    scene->render(&painter, rect, rect);
+    const int paintCount = counter->paintCount;
+    QVERIFY(paintCount > 0);
+
+    // Series updates reuse the pixmap of the layer
+    series->replace(1, QPointF(1, 0.5));
+    scene->render(&painter, rect, rect);
+    series->replace(1, QPointF(1, 1));
+    scene->render(&painter, rect, rect);
+    QCOMPARE(counter->paintCount, paintCount);
+
+    // A change within the layer renders it again
+    counter->setRect(counter->rect().translated(1, 0));
+    scene->render(&painter, rect, rect);
+    QVERIFY(counter->paintCount > paintCount);
+    painter.end();
+}
+
 QTEST_MAIN(tst_QChart)
 #include "tst_qchart.moc"
 
@@ -0,0 +1,191 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChartRenderer>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
+#include "tst_definitions.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+static QChart *createChart()
+{
+    QChart *chart = new QChart();
+    QLineSeries *series = new QLineSeries(chart);
+    for (int i = 0; i < 100; i++)
+        series->append(i, (i * 7) % 13);
+    chart->addSeries(series);
+    chart->createDefaultAxes();
+    chart->setTitle("Title");
+    return chart;
+}
+
+// Waits until all tasks have started, so that the renders overlap, and then
+// renders a new chart several times.
+class RenderTask : public QRunnable
+{
+public:
+    RenderTask(QSemaphore *started, QSemaphore *go, QVector<QImage> *images)
+        : m_started(started), m_go(go), m_images(images) {}
+
+    void run()
+    {
+        m_started->release();
+        m_go->acquire();
+        for (int i = 0; i < m_images->size(); i++) {
+            QScopedPointer<QChart> chart(createChart());
+            QChartRenderer renderer(chart.data());
+            (*m_images)[i] = renderer.toImage(QSize(320, 240));
+        }
+    }
+
+private:
+    QSemaphore *m_started;
+    QSemaphore *m_go;
+    QVector<QImage> *m_images;
+};
+
+class tst_QChartRenderer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void toImage_data();
+    void toImage();
+    void renderDevice();
+    void chartOwnership();
+    void chartInView();
+    void concurrentRendering();
+};
+
+void tst_QChartRenderer::toImage_data()
+{
+    QTest::addColumn<QSize>("size");
+    QTest::addColumn<qreal>("devicePixelRatio");
+    QTest::newRow("320x240") << QSize(320, 240) << qreal(1.0);
+    QTest::newRow("320x240@2x") << QSize(320, 240) << qreal(2.0);
+    QTest::newRow("1x1") << QSize(1, 1) << qreal(1.0);
+}
+
+void tst_QChartRenderer::toImage()
+{
+    QFETCH(QSize, size);
+    QFETCH(qreal, devicePixelRatio);
+
+    QScopedPointer<QChart> chart(createChart());
+    QChartRenderer renderer(chart.data());
+    const QImage image = renderer.toImage(size, devicePixelRatio);
+    QCOMPARE(image.size(), size * devicePixelRatio);
+    QCOMPARE(image.devicePixelRatio(), devicePixelRatio);
+    QCOMPARE(chart->size(), QSizeF(size));
+
+    QVERIFY(renderer.toImage(QSize()).isNull());
+    QVERIFY(QChartRenderer().toImage(size).isNull());
+}
+
+void tst_QChartRenderer::renderDevice()
+{
+    QScopedPointer<QChart> chart(createChart());
+    QChartRenderer renderer(chart.data());
+
+    QImage image(320, 240, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    const QImage blank = image;
+    QVERIFY(renderer.render(&image));
+    QVERIFY(image != blank);
+    QVERIFY(!renderer.render(static_cast<QPaintDevice *>(0)));
+}
+
+void tst_QChartRenderer::chartOwnership()
+{
+    QScopedPointer<QChart> chart(createChart());
+    {
+        QChartRenderer renderer(chart.data());
+        QVERIFY(!renderer.toImage(QSize(100, 100)).isNull());
+        QVERIFY(chart->scene());
+    }
+    QVERIFY(!chart->scene());
+
+    // The chart can be destroyed before the renderer
+    QChartRenderer renderer(createChart());
+    QVERIFY(!renderer.toImage(QSize(100, 100)).isNull());
+    delete renderer.chart();
+    QVERIFY(!renderer.chart());
+    QVERIFY(renderer.toImage(QSize(100, 100)).isNull());
+}
+
+void tst_QChartRenderer::chartInView()
+{
+    QChartView view(createChart());
+    view.resize(200, 200);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    const QSizeF size = view.chart()->size();
+
+    QChartRenderer renderer(view.chart());
+    QCOMPARE(renderer.toImage(QSize(640, 480)).size(), QSize(640, 480));
+    QCOMPARE(view.chart()->size(), size);
+    QCOMPARE(view.chart()->scene(), view.scene());
+}
+
+void tst_QChartRenderer::concurrentRendering()
+{
+    const int threadCount = 8;
+    const int renderCount = 10;
+
+    // Reference rendered in this thread before any other thread runs
+    QScopedPointer<QChart> chart(createChart());
+    const QImage reference = QChartRenderer(chart.data()).toImage(QSize(320, 240));
+    QVERIFY(!reference.isNull());
+
+    QVector<QVector<QImage> > images(threadCount, QVector<QImage>(renderCount));
+    QSemaphore started;
+    QSemaphore go;
+    QThreadPool pool;
+    pool.setMaxThreadCount(threadCount);
+    for (int i = 0; i < threadCount; i++)
+        pool.start(new RenderTask(&started, &go, &images[i]));
+    QVERIFY(started.tryAcquire(threadCount, 60000));
+    go.release(threadCount);
+    QVERIFY(pool.waitForDone(60000));
+
+    // Every thread lays out and paints the same chart as the GUI thread
+    for (const QVector<QImage> &threadImages : images) {
+        for (const QImage &image : threadImages)
+            QCOMPARE(image, reference);
+    }
+}
+
+QTEST_MAIN(tst_QChartRenderer)
+
+#include "tst_qchartrenderer.moc"
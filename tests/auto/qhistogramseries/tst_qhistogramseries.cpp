@@ -0,0 +1,320 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QHistogramSeries>
+#include <QtCharts/QBarSet>
+#include <QtCharts/QChartView>
+#include <QtCharts/QChart>
+#include "tst_definitions.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_QHistogramSeries : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void qhistogramseries();
+    void fixedBins();
+    void adaptiveBins();
+    void batchUpdate();
+    void outliers();
+    void invalidSamples();
+    void rebin();
+    void largeSampleCount();
+    void clear();
+    void chart();
+
+private:
+    QHistogramSeries *m_series;
+};
+
+void tst_QHistogramSeries::init()
+{
+    m_series = new QHistogramSeries();
+}
+
+void tst_QHistogramSeries::cleanup()
+{
+    delete m_series;
+    m_series = 0;
+}
+
+void tst_QHistogramSeries::qhistogramseries()
+{
+    QCOMPARE(m_series->type(), QAbstractSeries::SeriesTypeBar);
+    QCOMPARE(m_series->count(), 1);
+    QVERIFY(m_series->binSet() != 0);
+    QCOMPARE(m_series->barSets().at(0), m_series->binSet());
+    QCOMPARE(m_series->binningMode(), QHistogramSeries::BinsAdaptive);
+    QCOMPARE(m_series->binWidth(), qreal(1.0));
+    QCOMPARE(m_series->binOrigin(), qreal(0.0));
+    QCOMPARE(m_series->adaptiveBinCount(), 10);
+    QCOMPARE(m_series->sampleCount(), 0);
+    QCOMPARE(m_series->binCount(), 0);
+}
+
+void tst_QHistogramSeries::fixedBins()
+{
+    m_series->setBinningMode(QHistogramSeries::BinsFixed);
+    m_series->setBinWidth(2.0);
+    QSignalSpy binsSpy(m_series, SIGNAL(binsChanged()));
+    QSignalSpy valueSpy(m_series->binSet(), SIGNAL(valueChanged(int)));
+
+    *m_series << 3.0 << 3.5;
+    QCOMPARE(m_series->binCount(), 1);
+    QCOMPARE(m_series->lowerBinEdge(0), qreal(2.0));
+    QCOMPARE(m_series->upperBinEdge(0), qreal(4.0));
+    QCOMPARE(m_series->binSet()->at(0), qreal(2.0));
+    QCOMPARE(binsSpy.count(), 1);
+    // The second sample only touched the existing bin
+    QCOMPARE(valueSpy.count(), 1);
+
+    // Bins grow at both ends without touching the existing counts
+    m_series->append(QVector<qreal>() << -1.0 << 9.0 << 2.0);
+    QCOMPARE(m_series->binCount(), 6);
+    QCOMPARE(m_series->lowerBinEdge(0), qreal(-2.0));
+    QCOMPARE(m_series->upperBinEdge(5), qreal(10.0));
+    QCOMPARE(m_series->binSet()->at(0), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(1), qreal(0.0));
+    QCOMPARE(m_series->binSet()->at(2), qreal(3.0));
+    QCOMPARE(m_series->binSet()->at(5), qreal(1.0));
+    QCOMPARE(m_series->binSet()->sum(), qreal(5.0));
+    QCOMPARE(m_series->sampleCount(), 5);
+    QCOMPARE(binsSpy.count(), 2);
+}
+
+void tst_QHistogramSeries::adaptiveBins()
+{
+    m_series->setAdaptiveBinCount(4);
+    m_series->append(QVector<qreal>() << 0.0 << 1.0 << 2.0 << 3.0 << 4.0 << 4.0);
+    QCOMPARE(m_series->binCount(), 4);
+    QCOMPARE(m_series->lowerBinEdge(0), qreal(0.0));
+    QCOMPARE(m_series->upperBinEdge(3), qreal(4.0));
+    // The largest sample belongs to the last bin
+    QCOMPARE(m_series->binSet()->at(0), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(3), qreal(3.0));
+
+    // Samples inside the range are counted without recounting
+    QSignalSpy binsSpy(m_series, SIGNAL(binsChanged()));
+    m_series->append(1.5);
+    QCOMPARE(binsSpy.count(), 0);
+    QCOMPARE(m_series->binSet()->at(1), qreal(2.0));
+
+    // Samples outside the range widen the bins
+    m_series->append(8.0);
+    QCOMPARE(binsSpy.count(), 1);
+    QCOMPARE(m_series->binCount(), 4);
+    QCOMPARE(m_series->upperBinEdge(3), qreal(8.0));
+    QCOMPARE(m_series->binSet()->at(0), qreal(3.0));
+    QCOMPARE(m_series->binSet()->at(1), qreal(2.0));
+    QCOMPARE(m_series->binSet()->at(2), qreal(2.0));
+    QCOMPARE(m_series->binSet()->at(3), qreal(1.0));
+}
+
+void tst_QHistogramSeries::batchUpdate()
+{
+    m_series->setBinningMode(QHistogramSeries::BinsFixed);
+    m_series->append(QVector<qreal>() << 0.5 << 1.5 << 2.5 << 3.5);
+    QCOMPARE(m_series->binCount(), 4);
+
+    // A batch within the existing bins replaces the counts once
+    QSignalSpy valueSpy(m_series->binSet(), SIGNAL(valueChanged(int)));
+    QSignalSpy replacedSpy(m_series->binSet(), SIGNAL(valuesReplaced()));
+    m_series->append(QVector<qreal>() << 0.2 << 1.2 << 2.2 << 3.2 << 3.7);
+    QCOMPARE(valueSpy.count(), 0);
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(m_series->binSet()->at(0), qreal(2.0));
+    QCOMPARE(m_series->binSet()->at(3), qreal(3.0));
+
+    // A batch hitting a single bin only updates that bar
+    m_series->append(QVector<qreal>() << 1.1 << 1.9);
+    QCOMPARE(valueSpy.count(), 1);
+    QCOMPARE(valueSpy.at(0).at(0).toInt(), 1);
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(m_series->binSet()->at(1), qreal(4.0));
+    QCOMPARE(m_series->binSet()->sum(), qreal(11.0));
+}
+
+void tst_QHistogramSeries::outliers()
+{
+    // Far outliers would need more bins than an int can count. The bins stay on the bulk of
+    // the samples and the outliers are counted in the outermost bins.
+    m_series->setBinningMode(QHistogramSeries::BinsFixed);
+    m_series->append(QVector<qreal>() << 0.5 << 1.5 << 1e300);
+    QCOMPARE(m_series->binCount(), 100000);
+    QCOMPARE(m_series->lowerBinEdge(0), qreal(0.0));
+    QCOMPARE(m_series->binSet()->at(0), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(1), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(m_series->binCount() - 1), qreal(1.0));
+    QCOMPARE(m_series->binSet()->sum(), qreal(3.0));
+
+    // A far low outlier keeps the existing bins and goes into the first one
+    m_series->append(-1e300);
+    QCOMPARE(m_series->binCount(), 100000);
+    QCOMPARE(m_series->lowerBinEdge(0), qreal(0.0));
+    QCOMPARE(m_series->binSet()->at(0), qreal(2.0));
+    QCOMPARE(m_series->binSet()->at(1), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(m_series->binCount() - 1), qreal(1.0));
+    QCOMPARE(m_series->binSet()->sum(), qreal(4.0));
+
+    // Recounting centers the bins on the median sample
+    m_series->setBinOrigin(0.25);
+    QCOMPARE(m_series->binCount(), 100000);
+    QCOMPARE(m_series->lowerBinEdge(0), qreal(-49998.75));
+    QCOMPARE(m_series->binSet()->at(0), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(49999), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(50000), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(m_series->binCount() - 1), qreal(1.0));
+    QCOMPARE(m_series->binSet()->sum(), qreal(4.0));
+
+    // Bins are added towards new samples only up to the limit
+    m_series->append(QVector<qreal>() << -49999.0 << 1e6);
+    QCOMPARE(m_series->binCount(), 100000);
+    QCOMPARE(m_series->lowerBinEdge(0), qreal(-49998.75));
+    QCOMPARE(m_series->binSet()->at(0), qreal(2.0));
+    QCOMPARE(m_series->binSet()->at(49999), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(50000), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(m_series->binCount() - 1), qreal(2.0));
+    QCOMPARE(m_series->binSet()->sum(), qreal(6.0));
+
+    // The adaptive range of the samples is wider than the largest qreal
+    m_series->setBinningMode(QHistogramSeries::BinsAdaptive);
+    m_series->append(QVector<qreal>() << 1.5e308 << -1.5e308);
+    QCOMPARE(m_series->binCount(), m_series->adaptiveBinCount());
+    QCOMPARE(m_series->binSet()->sum(), qreal(8.0));
+    QCOMPARE(m_series->binSet()->at(0), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(m_series->binCount() - 1), qreal(1.0));
+}
+
+void tst_QHistogramSeries::invalidSamples()
+{
+    QSignalSpy countSpy(m_series, SIGNAL(sampleCountChanged()));
+    m_series->append(qQNaN());
+    m_series->append(QVector<qreal>() << qInf() << -qInf());
+    QCOMPARE(countSpy.count(), 0);
+    QCOMPARE(m_series->sampleCount(), 0);
+    QCOMPARE(m_series->binCount(), 0);
+
+    m_series->append(QVector<qreal>() << 1.0 << qQNaN());
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(m_series->sampleCount(), 1);
+    QCOMPARE(m_series->binSet()->sum(), qreal(1.0));
+}
+
+void tst_QHistogramSeries::rebin()
+{
+    m_series->setBinningMode(QHistogramSeries::BinsFixed);
+    m_series->append(QVector<qreal>() << 0.5 << 1.5 << 2.5 << 3.5);
+    QCOMPARE(m_series->binCount(), 4);
+
+    QSignalSpy widthSpy(m_series, SIGNAL(binWidthChanged(qreal)));
+    m_series->setBinWidth(2.0);
+    QCOMPARE(widthSpy.count(), 1);
+    QCOMPARE(m_series->binCount(), 2);
+    QCOMPARE(m_series->binSet()->at(0), qreal(2.0));
+    QCOMPARE(m_series->binSet()->at(1), qreal(2.0));
+
+    m_series->setBinOrigin(1.0);
+    QCOMPARE(m_series->binCount(), 3);
+    QCOMPARE(m_series->lowerBinEdge(0), qreal(-1.0));
+    QCOMPARE(m_series->binSet()->at(0), qreal(1.0));
+    QCOMPARE(m_series->binSet()->at(1), qreal(2.0));
+    QCOMPARE(m_series->binSet()->at(2), qreal(1.0));
+
+    // Invalid widths are ignored
+    m_series->setBinWidth(0.0);
+    QCOMPARE(m_series->binWidth(), qreal(2.0));
+    QCOMPARE(widthSpy.count(), 1);
+
+    m_series->setBinningMode(QHistogramSeries::BinsAdaptive);
+    QCOMPARE(m_series->binCount(), 10);
+    QCOMPARE(m_series->binSet()->sum(), qreal(4.0));
+}
+
+void tst_QHistogramSeries::largeSampleCount()
+{
+    // Enough samples to be counted on several threads
+    QVector<qreal> samples;
+    for (int i = 0; i < 300000; i++)
+        samples.append(i % 100);
+
+    m_series->setAdaptiveBinCount(100);
+    m_series->append(samples);
+    QCOMPARE(m_series->binCount(), 100);
+    QCOMPARE(m_series->binSet()->sum(), qreal(300000));
+    // The last bin also holds the largest value
+    QCOMPARE(m_series->binSet()->at(0), qreal(3000));
+    QCOMPARE(m_series->binSet()->at(99), qreal(3000));
+
+    m_series->setBinningMode(QHistogramSeries::BinsFixed);
+    m_series->setBinWidth(10.0);
+    QCOMPARE(m_series->binCount(), 10);
+    for (int i = 0; i < 10; i++)
+        QCOMPARE(m_series->binSet()->at(i), qreal(30000));
+}
+
+void tst_QHistogramSeries::clear()
+{
+    m_series->append(QVector<qreal>() << 1.0 << 2.0 << 3.0);
+    QSignalSpy countSpy(m_series, SIGNAL(sampleCountChanged()));
+    QSignalSpy binsSpy(m_series, SIGNAL(binsChanged()));
+    m_series->clear();
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(binsSpy.count(), 1);
+    QCOMPARE(m_series->sampleCount(), 0);
+    QCOMPARE(m_series->binCount(), 0);
+    QCOMPARE(m_series->count(), 1);
+}
+
+void tst_QHistogramSeries::chart()
+{
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->addSeries(m_series);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    for (int i = 0; i < 100; i++)
+        m_series->append(i % 7);
+    m_series->setBinningMode(QHistogramSeries::BinsFixed);
+    QCOMPARE(m_series->binCount(), 7);
+    QCOMPARE(m_series->binSet()->sum(), qreal(100));
+
+    view.chart()->removeSeries(m_series);
+}
+
+QTEST_MAIN(tst_QHistogramSeries)
+
+#include "tst_qhistogramseries.moc"
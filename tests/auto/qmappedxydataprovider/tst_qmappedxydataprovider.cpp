@@ -0,0 +1,277 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QMappedXYDataProvider>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QValueAxis>
+#include <QtCore/QTemporaryFile>
+#include <private/xychart_p.h>
+#include "tst_definitions.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_QMappedXYDataProvider : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void defaults();
+    void packedDoubles();
+    void floatBlocks();
+    void partialRecord();
+    void openFailure();
+    void seriesAllPoints();
+    void seriesDecimated();
+    void seriesVisibleRange();
+    void seriesPanned();
+
+private:
+    bool writeDoubles(QTemporaryFile &file, int count);
+};
+
+// Writes packed (x, y) pairs with ascending x and a single peak and dip in y
+bool tst_QMappedXYDataProvider::writeDoubles(QTemporaryFile &file, int count)
+{
+    if (!file.open())
+        return false;
+    QVector<double> values;
+    values.reserve(2 * count);
+    for (int i = 0; i < count; i++) {
+        values.append(i);
+        values.append(i == count / 3 ? 1000.0 : (i == 2 * count / 3 ? -1000.0 : (i % 10)));
+    }
+    const qint64 size = values.size() * qint64(sizeof(double));
+    const bool ok = file.write(reinterpret_cast<const char *>(values.constData()), size) == size;
+    file.close();
+    return ok;
+}
+
+void tst_QMappedXYDataProvider::defaults()
+{
+    QMappedXYDataProvider provider;
+    QVERIFY(provider.fileName().isEmpty());
+    QCOMPARE(provider.valueType(), QMappedXYDataProvider::Double);
+    QCOMPARE(provider.offset(), qint64(0));
+    QCOMPARE(provider.stride(), qint64(2 * sizeof(double)));
+    QCOMPARE(provider.xOffset(), qint64(0));
+    QCOMPARE(provider.yOffset(), qint64(sizeof(double)));
+    QVERIFY(!provider.isOpen());
+    QCOMPARE(provider.count(), 0);
+
+    provider.setValueType(QMappedXYDataProvider::Float);
+    QCOMPARE(provider.stride(), qint64(2 * sizeof(float)));
+    QCOMPARE(provider.yOffset(), qint64(sizeof(float)));
+}
+
+void tst_QMappedXYDataProvider::packedDoubles()
+{
+    QTemporaryFile file;
+    QVERIFY(writeDoubles(file, 100));
+
+    QMappedXYDataProvider provider(file.fileName());
+    QVERIFY(provider.open());
+    QVERIFY(provider.isOpen());
+    QCOMPARE(provider.count(), 100);
+    QCOMPARE(provider.at(0), QPointF(0, 0));
+    QCOMPARE(provider.at(33), QPointF(33, 1000));
+    QCOMPARE(provider.at(99), QPointF(99, 9));
+
+    // Skipping the first record as a header
+    provider.setOffset(2 * sizeof(double));
+    QCOMPARE(provider.count(), 99);
+    QCOMPARE(provider.at(0), QPointF(1, 1));
+
+    provider.close();
+    QVERIFY(!provider.isOpen());
+    QCOMPARE(provider.count(), 0);
+}
+
+void tst_QMappedXYDataProvider::floatBlocks()
+{
+    // All x values followed by all y values
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    const int count = 10;
+    QVector<float> values;
+    for (int i = 0; i < count; i++)
+        values.append(i * 0.5f);
+    for (int i = 0; i < count; i++)
+        values.append(-i);
+    const qint64 size = values.size() * qint64(sizeof(float));
+    QCOMPARE(file.write(reinterpret_cast<const char *>(values.constData()), size), size);
+    file.close();
+
+    QMappedXYDataProvider provider(file.fileName());
+    provider.setValueType(QMappedXYDataProvider::Float);
+    provider.setStride(sizeof(float));
+    provider.setYOffset(count * sizeof(float));
+    QVERIFY(provider.open());
+    QCOMPARE(provider.count(), count);
+    for (int i = 0; i < count; i++)
+        QCOMPARE(provider.at(i), QPointF(i * 0.5, -i));
+}
+
+void tst_QMappedXYDataProvider::partialRecord()
+{
+    QTemporaryFile file;
+    QVERIFY(writeDoubles(file, 10));
+    QVERIFY(file.open());
+    QVERIFY(file.resize(file.size() - 1));
+    file.close();
+
+    QMappedXYDataProvider provider(file.fileName());
+    QVERIFY(provider.open());
+    QCOMPARE(provider.count(), 9);
+}
+
+void tst_QMappedXYDataProvider::openFailure()
+{
+    QMappedXYDataProvider provider(QStringLiteral("this file does not exist"));
+    QVERIFY(!provider.open());
+    QVERIFY(!provider.isOpen());
+    QVERIFY(!provider.errorString().isEmpty());
+    QCOMPARE(provider.count(), 0);
+}
+
+void tst_QMappedXYDataProvider::seriesAllPoints()
+{
+    QTemporaryFile file;
+    QVERIFY(writeDoubles(file, 100));
+    QMappedXYDataProvider provider(file.fileName());
+    QVERIFY(provider.open());
+
+    QLineSeries series;
+    QSignalSpy spy(&series, SIGNAL(pointsReplaced()));
+    series.setDataProvider(&provider);
+    QCOMPARE(series.dataProvider(), static_cast<QXYDataProvider *>(&provider));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(series.count(), 100);
+    for (int i = 0; i < series.count(); i++)
+        QCOMPARE(series.at(i), provider.at(i));
+
+    // The points last loaded stay
+    series.setDataProvider(0);
+    QVERIFY(!series.dataProvider());
+    QCOMPARE(series.count(), 100);
+}
+
+void tst_QMappedXYDataProvider::seriesDecimated()
+{
+    QTemporaryFile file;
+    QVERIFY(writeDoubles(file, 100000));
+    QMappedXYDataProvider provider(file.fileName());
+    QVERIFY(provider.open());
+
+    QLineSeries series;
+    series.setDataProvider(&provider);
+    QVERIFY(series.count() > 0);
+    QVERIFY(series.count() < provider.count() / 10);
+
+    // The ends and the extremes are kept, in order of x
+    const QVector<QPointF> points = series.pointsVector();
+    QCOMPARE(points.first(), provider.at(0));
+    QCOMPARE(points.last(), provider.at(provider.count() - 1));
+    QVERIFY(points.contains(provider.at(100000 / 3)));
+    QVERIFY(points.contains(provider.at(2 * 100000 / 3)));
+    for (int i = 1; i < points.count(); i++)
+        QVERIFY(points.at(i - 1).x() < points.at(i).x());
+}
+
+void tst_QMappedXYDataProvider::seriesVisibleRange()
+{
+    QTemporaryFile file;
+    QVERIFY(writeDoubles(file, 100000));
+    QMappedXYDataProvider provider(file.fileName());
+    QVERIFY(provider.open());
+
+    QChartView view;
+    view.resize(400, 300);
+    QLineSeries *series = new QLineSeries();
+    series->setDataProvider(&provider);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    // Zooming in loads the visible points and one neighbor on each side
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(view.chart()->axisX(series));
+    QVERIFY(axisX);
+    axisX->setRange(500, 600);
+    TRY_COMPARE(series->count(), 103);
+    QCOMPARE(series->at(0), provider.at(499));
+    QCOMPARE(series->at(series->count() - 1), provider.at(601));
+}
+
+void tst_QMappedXYDataProvider::seriesPanned()
+{
+    QTemporaryFile file;
+    QVERIFY(writeDoubles(file, 100000));
+    QMappedXYDataProvider provider(file.fileName());
+    QVERIFY(provider.open());
+
+    QChartView view;
+    view.resize(400, 300);
+    QLineSeries *series = new QLineSeries();
+    series->setDataProvider(&provider);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(view.chart()->axisX(series));
+    QVERIFY(axisX);
+    axisX->setRange(500, 600);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    XYChart *item = 0;
+    foreach (QGraphicsItem *graphicsItem, view.scene()->items()) {
+        if (XYChart *chartItem = qobject_cast<XYChart *>(graphicsItem->toGraphicsObject()))
+            item = chartItem;
+    }
+    QVERIFY(item);
+
+    // A pan reloads the points of the new range. The reloaded geometry must not be shifted
+    // a second time by the translation of the pan.
+    const qreal firstX = series->at(0).x();
+    view.chart()->scroll(40, 0);
+    QVERIFY(series->at(0).x() > firstX);
+    const QVector<QPointF> geometry = item->geometryPoints();
+    QCOMPARE(geometry.count(), series->count());
+    const QPointF origin = view.chart()->plotArea().topLeft();
+    for (int i = 0; i < geometry.count(); i++) {
+        const QPointF expected = view.chart()->mapToPosition(series->at(i), series) - origin;
+        QVERIFY(qAbs(geometry.at(i).x() - expected.x()) < 0.01);
+        QVERIFY(qAbs(geometry.at(i).y() - expected.y()) < 0.01);
+    }
+}
+
+QTEST_MAIN(tst_QMappedXYDataProvider)
+
+#include "tst_qmappedxydataprovider.moc"
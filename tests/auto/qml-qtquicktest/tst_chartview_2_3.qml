@@ -0,0 +1,131 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+import QtQuick 2.0
+import QtTest 1.2
+import QtCharts 2.3
+
+Rectangle {
+    width: 400
+    height: 300
+
+    TestCase {
+        id: tc1
+        name: "tst_qml-qtquicktest ChartView Properties 2.3"
+        when: windowShown
+
+        function test_threadedRenderingDefault() {
+            compare(chartView.threadedRendering, false, "ChartView.threadedRendering");
+        }
+
+        function test_threadedRendering() {
+            threadedRenderingSpy.clear();
+            chartView.threadedRendering = true;
+            compare(chartView.threadedRendering, true);
+            compare(threadedRenderingSpy.count, 1);
+            chartView.threadedRendering = true;
+            compare(threadedRenderingSpy.count, 1);
+
+            // The series keeps being drawn while the scene is rasterized in the render thread
+            lineSeries.append(0, 0.5);
+            lineSeries.append(100, 0.5);
+            verifyLineAt(0.5);
+
+            for (var i = 0; i < 10; i++) {
+                var y = i % 2 ? 0.5 : 0.25;
+                lineSeries.replace(0, lineSeries.at(0).y, 0, y);
+                lineSeries.replace(100, lineSeries.at(1).y, 100, y);
+                chartView.threadedRendering = !chartView.threadedRendering;
+            }
+            compare(threadedRenderingSpy.count, 11);
+            compare(chartView.threadedRendering, true);
+            verifyLineAt(0.5);
+            verify(!lineAt(0.25));
+
+            lineSeries.replace(0, 0.5, 0, 0.25);
+            lineSeries.replace(100, 0.5, 100, 0.25);
+            verifyLineAt(0.25);
+            compare(chartView.threadedRendering, true);
+
+            chartView.threadedRendering = false;
+            compare(chartView.threadedRendering, false);
+            compare(threadedRenderingSpy.count, 12);
+            lineSeries.replace(0, 0.25, 0, 0.5);
+            lineSeries.replace(100, 0.25, 100, 0.5);
+            verifyLineAt(0.5);
+            lineSeries.clear();
+        }
+
+        // Not a test function, called from test functions
+        function lineAt(y) {
+            var position = chartView.mapToPosition(Qt.point(50, y), lineSeries);
+            var image = grabImage(chartView);
+            return Qt.colorEqual(image.pixel(Math.round(position.x), Math.round(position.y)),
+                                 lineSeries.color);
+        }
+
+        // Not a test function, called from test functions
+        function verifyLineAt(y) {
+            tryVerify(function() { return lineAt(y); }, 5000, "line drawn at " + y);
+        }
+    }
+
+    ChartView {
+        id: chartView
+        anchors.fill: parent
+        legend.visible: false
+
+        ValueAxis {
+            id: axisX
+            min: 0
+            max: 100
+        }
+
+        ValueAxis {
+            id: axisY
+            min: 0
+            max: 1
+        }
+
+        LineSeries {
+            id: lineSeries
+            axisX: axisX
+            axisY: axisY
+            color: "red"
+            width: 6
+        }
+
+        SignalSpy {
+            id: threadedRenderingSpy
+            target: chartView
+            signalName: "threadedRenderingChanged"
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+import QtQuick 2.0
+import QtTest 1.2
+import QtCharts 2.0
+
+Rectangle {
+    id: root
+    width: 400
+    height: 300
+
+    TestCase {
+        id: tc1
+        name: "tst_qml-qtquicktest ChartView Rendering"
+        when: windowShown
+
+        function init() {
+            root.height = 300;
+            lineSeries.clear();
+            lineSeries.append(0, 0.5);
+            lineSeries.append(100, 0.5);
+            verifyLineAt(0.5);
+        }
+
+        function test_partialUpdate() {
+            var outside = sampleOutsidePlotArea();
+
+            // Only the line changes, the rest of the chart keeps its pixels
+            moveLine(0.5, 0.25);
+            verifyLineAt(0.25);
+            verify(!lineAt(0.5));
+            compareSamples(outside, sampleOutsidePlotArea());
+
+            moveLine(0.25, 0.5);
+            verifyLineAt(0.5);
+            verify(!lineAt(0.25));
+            compareSamples(outside, sampleOutsidePlotArea());
+        }
+
+        function test_resize() {
+            var oldPosition = chartView.mapToPosition(Qt.point(50, 0.5), lineSeries);
+
+            // A new size replaces the whole texture
+            root.height = 400;
+            tryVerify(function() {
+                var position = chartView.mapToPosition(Qt.point(50, 0.5), lineSeries);
+                return Math.abs(position.y - oldPosition.y) > 10;
+            }, 5000, "plot area resized");
+            verifyLineAt(0.5);
+            verify(!isLineColor(oldPosition));
+
+            // The new texture is updated in place again
+            var outside = sampleOutsidePlotArea();
+            moveLine(0.5, 0.25);
+            verifyLineAt(0.25);
+            verify(!lineAt(0.5));
+            compareSamples(outside, sampleOutsidePlotArea());
+        }
+
+        // Not a test function, called from test functions
+        function moveLine(from, to) {
+            lineSeries.replace(0, from, 0, to);
+            lineSeries.replace(100, from, 100, to);
+        }
+
+        // Not a test function, called from test functions
+        function isLineColor(position) {
+            var image = grabImage(chartView);
+            return Qt.colorEqual(image.pixel(Math.round(position.x), Math.round(position.y)),
+                                 lineSeries.color);
+        }
+
+        // Not a test function, called from test functions
+        function lineAt(y) {
+            return isLineColor(chartView.mapToPosition(Qt.point(50, y), lineSeries));
+        }
+
+        // Not a test function, called from test functions
+        function verifyLineAt(y) {
+            tryVerify(function() { return lineAt(y); }, 5000, "line drawn at " + y);
+        }
+
+        // Not a test function, called from test functions
+        function sampleOutsidePlotArea() {
+            var image = grabImage(chartView);
+            var plotArea = chartView.plotArea;
+            var samples = [];
+            for (var x = 2; x < chartView.width; x += 7) {
+                for (var y = 2; y < chartView.height; y += 7) {
+                    if (x >= plotArea.x - 2 && x <= plotArea.x + plotArea.width + 2
+                            && y >= plotArea.y - 2 && y <= plotArea.y + plotArea.height + 2)
+                        continue;
+                    samples.push(image.pixel(x, y));
+                }
+            }
+            return samples;
+        }
+
+        // Not a test function, called from test functions
+        function compareSamples(expected, actual) {
+            compare(actual.length, expected.length);
+            for (var i = 0; i < expected.length; i++)
+                verify(Qt.colorEqual(actual[i], expected[i]), "pixel " + i + " unchanged");
+        }
+    }
+
+    ChartView {
+        id: chartView
+        anchors.fill: parent
+        title: "Rendering"
+        legend.visible: false
+
+        ValueAxis {
+            id: axisX
+            min: 0
+            max: 100
+        }
+
+        ValueAxis {
+            id: axisY
+            min: 0
+            max: 1
+        }
+
+        LineSeries {
+            id: lineSeries
+            axisX: axisX
+            axisY: axisY
+            color: "red"
+            width: 6
+        }
+    }
+}
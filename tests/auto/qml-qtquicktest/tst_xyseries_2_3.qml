@@ -0,0 +1,123 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.0
+import QtTest 1.0
+import QtCharts 2.3
+
+Rectangle {
+    width: 400
+    height: 300
+
+    TestCase {
+        id: tc1
+        name: "tst_qml-qtquicktest XY Series 2.3"
+        when: windowShown
+
+        function test_appendPoints() {
+            lineSeriesPointsReplacedSpy.clear();
+            lineSeriesPointAddedSpy.clear();
+            lineSeries.appendPoints([0, 0.5, 1, 0.25]);
+            compare(lineSeries.count, 2);
+            compare(lineSeries.at(1).x, 1);
+            compare(lineSeries.at(1).y, 0.25);
+
+            var y = new Float64Array([0.1, 0.2, 0.3]);
+            lineSeries.appendPoints([2, 3, 4], y);
+            splineSeries.appendPoints(new Float64Array([0, 1, 2]), y);
+            scatterSeries.appendPoints(new Float64Array([0, 0.1, 1, 0.2]).buffer);
+            compare(lineSeries.count, 5);
+            compare(lineSeries.at(4).x, 4);
+            compare(lineSeries.at(4).y, 0.3);
+            compare(splineSeries.count, 3);
+            compare(splineSeries.at(2).y, 0.3);
+            compare(scatterSeries.count, 2);
+            compare(scatterSeries.at(1).x, 1);
+
+            // Each batch is a single replacement instead of a point added per point
+            compare(lineSeriesPointsReplacedSpy.count, 2);
+            compare(lineSeriesPointAddedSpy.count, 0);
+            clear();
+        }
+
+        function test_replacePoints() {
+            lineSeries.appendPoints([0, 1, 2], [0.1, 0.2, 0.3]);
+            lineSeriesPointsReplacedSpy.clear();
+            lineSeries.replacePoints([0, 1], [0.5, 0.5]);
+            compare(lineSeries.count, 2);
+            compare(lineSeries.at(0).y, 0.5);
+            compare(lineSeriesPointsReplacedSpy.count, 1);
+
+            scatterSeries.replacePoints(new Float64Array([3, 0.75]));
+            compare(scatterSeries.count, 1);
+            compare(scatterSeries.at(0).x, 3);
+            compare(scatterSeries.at(0).y, 0.75);
+            clear();
+        }
+
+        // Not a test function, called from test functions
+        function clear() {
+            lineSeries.clear();
+            splineSeries.clear();
+            scatterSeries.clear();
+        }
+    }
+
+    ChartView {
+        id: chartView
+        anchors.fill: parent
+
+        LineSeries {
+            id: lineSeries
+            name: "line"
+
+            SignalSpy {
+                id: lineSeriesPointAddedSpy
+                target: lineSeries
+                signalName: "pointAdded"
+            }
+
+            SignalSpy {
+                id: lineSeriesPointsReplacedSpy
+                target: lineSeries
+                signalName: "pointsReplaced"
+            }
+        }
+
+        SplineSeries {
+            id: splineSeries
+            name: "spline"
+        }
+
+        ScatterSeries {
+            id: scatterSeries
+            name: "scatter"
+        }
+    }
+}
@@ -0,0 +1,236 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QMovingAverageSeries>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QCandlestickSeries>
+#include <QtCharts/QCandlestickSet>
+#include "tst_definitions.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_QMovingAverageSeries : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void qmovingaverageseries();
+    void average();
+    void deviations();
+    void replacePoint();
+    void removeFront();
+    void candlestickSource();
+    void sourceDestroyed();
+
+private:
+    void verifyPoints();
+
+    QLineSeries *m_source;
+    QMovingAverageSeries *m_series;
+};
+
+void tst_QMovingAverageSeries::init()
+{
+    m_source = new QLineSeries();
+    m_series = new QMovingAverageSeries(m_source, 3);
+}
+
+void tst_QMovingAverageSeries::cleanup()
+{
+    delete m_series;
+    m_series = 0;
+    delete m_source;
+    m_source = 0;
+}
+
+void tst_QMovingAverageSeries::verifyPoints()
+{
+    // Compare against a straightforward calculation of every window
+    const int windowSize = m_series->windowSize();
+    QCOMPARE(m_series->count(), qMax(m_source->count() - windowSize + 1, 0));
+    for (int i = 0; i < m_series->count(); i++) {
+        qreal sum = 0;
+        for (int j = i; j < i + windowSize; j++)
+            sum += m_source->at(j).y();
+        const qreal mean = sum / windowSize;
+        qreal variance = 0;
+        for (int j = i; j < i + windowSize; j++)
+            variance += (m_source->at(j).y() - mean) * (m_source->at(j).y() - mean);
+        variance /= windowSize;
+        const qreal expected = mean * (1 + m_series->envelope())
+                + m_series->deviations() * qSqrt(variance);
+        QCOMPARE(m_series->at(i).x(), m_source->at(i + windowSize - 1).x());
+        QVERIFY(qAbs(m_series->at(i).y() - expected) < 1e-9);
+    }
+}
+
+void tst_QMovingAverageSeries::qmovingaverageseries()
+{
+    QMovingAverageSeries series;
+    QCOMPARE(series.type(), QAbstractSeries::SeriesTypeLine);
+    QVERIFY(!series.source());
+    QCOMPARE(series.windowSize(), 20);
+    QCOMPARE(series.deviations(), qreal(0.0));
+    QCOMPARE(series.envelope(), qreal(0.0));
+    QCOMPARE(series.count(), 0);
+
+    series.setWindowSize(0);
+    QCOMPARE(series.windowSize(), 1);
+    QCOMPARE(m_series->source(), static_cast<QAbstractSeries *>(m_source));
+}
+
+void tst_QMovingAverageSeries::average()
+{
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+
+    *m_source << QPointF(0, 1) << QPointF(1, 2);
+    QCOMPARE(m_series->count(), 0);
+
+    *m_source << QPointF(2, 6) << QPointF(3, 4) << QPointF(4, 8);
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(addedSpy.count(), 3);
+    QCOMPARE(m_series->at(0), QPointF(2, 3));
+    QCOMPARE(m_series->at(1), QPointF(3, 4));
+    QCOMPARE(m_series->at(2), QPointF(4, 6));
+
+    m_series->setWindowSize(2);
+    verifyPoints();
+
+    m_source->insert(1, QPointF(0.5, 10));
+    verifyPoints();
+
+    m_source->clear();
+    QCOMPARE(m_series->count(), 0);
+}
+
+void tst_QMovingAverageSeries::deviations()
+{
+    for (int i = 0; i < 50; i++)
+        m_source->append(i, (i * 7) % 11);
+
+    m_series->setDeviations(2.0);
+    verifyPoints();
+    m_series->setEnvelope(-0.05);
+    verifyPoints();
+
+    // Appended values keep updating incrementally
+    for (int i = 50; i < 100; i++)
+        m_source->append(i, (i * 5) % 13);
+    verifyPoints();
+}
+
+void tst_QMovingAverageSeries::replacePoint()
+{
+    for (int i = 0; i < 20; i++)
+        m_source->append(i, i * i % 7);
+    m_series->setDeviations(1.0);
+
+    m_source->replace(0, QPointF(0, 100));
+    verifyPoints();
+    m_source->replace(10, QPointF(10, -5));
+    verifyPoints();
+    m_source->replace(19, QPointF(19, 3));
+    verifyPoints();
+
+    // Later appends continue from the updated window
+    m_source->append(20, 1);
+    verifyPoints();
+}
+
+void tst_QMovingAverageSeries::removeFront()
+{
+    for (int i = 0; i < 20; i++)
+        m_source->append(i, i % 4);
+
+    QSignalSpy removedSpy(m_series, SIGNAL(pointsRemoved(int,int)));
+    m_source->removePoints(0, 5);
+    QCOMPARE(removedSpy.count(), 1);
+    verifyPoints();
+
+    m_source->append(20, 9);
+    verifyPoints();
+
+    m_source->removePoints(0, m_source->count() - 1);
+    verifyPoints();
+}
+
+void tst_QMovingAverageSeries::candlestickSource()
+{
+    QCandlestickSeries candlesticks;
+    m_series->setSource(&candlesticks);
+    QCOMPARE(m_series->source(), static_cast<QAbstractSeries *>(&candlesticks));
+
+    candlesticks.append(new QCandlestickSet(1, 2, 0, 1, 1));
+    candlesticks.append(new QCandlestickSet(1, 2, 0, 2, 2));
+    candlesticks.append({ 3, 4 }, { 1, 1 }, { 9, 9 }, { 0, 0 }, { 6, 7 });
+    QCOMPARE(m_series->count(), 2);
+    QCOMPARE(m_series->at(0), QPointF(3, 3));
+    QCOMPARE(m_series->at(1), QPointF(4, 5));
+
+    candlesticks.sets().first()->setClose(4);
+    QCOMPARE(m_series->at(0), QPointF(3, 4));
+
+    // Replacing the columns with as many rows only restructures the candlesticks
+    QVERIFY(candlesticks.replace({ 1, 2, 3, 4 }, { 1, 1, 1, 1 }, { 9, 9, 9, 9 }, { 0, 0, 0, 0 },
+                                 { 3, 3, 3, 9 }));
+    QCOMPARE(m_series->count(), 2);
+    QCOMPARE(m_series->at(0), QPointF(3, 3));
+    QCOMPARE(m_series->at(1), QPointF(4, 5));
+
+    candlesticks.append({ 5 }, { 1 }, { 9 }, { 0 }, { 3 });
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(m_series->at(2), QPointF(5, 5));
+
+    m_series->setSource(0);
+    QCOMPARE(m_series->count(), 0);
+}
+
+void tst_QMovingAverageSeries::sourceDestroyed()
+{
+    m_source->append(0, 1);
+    m_source->append(1, 1);
+    m_source->append(2, 1);
+    QCOMPARE(m_series->count(), 1);
+
+    QSignalSpy sourceSpy(m_series, SIGNAL(sourceChanged(QAbstractSeries*)));
+    delete m_source;
+    m_source = 0;
+    QVERIFY(!m_series->source());
+    QCOMPARE(m_series->count(), 0);
+    QCOMPARE(sourceSpy.count(), 1);
+}
+
+QTEST_MAIN(tst_QMovingAverageSeries)
+
+#include "tst_qmovingaverageseries.moc"
@@ -72,6 +72,7 @@ class tst_qpiemodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void dataRole();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -538,6 +539,28 @@ void tst_qpiemodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qpiemodelmapper::dataRole()
+{
+    // setup the mapper
+    createVerticalMapper();
+    for (int row = 0; row < m_modelRowCount; ++row)
+        m_model->setData(m_model->index(row, 0), row + 100, Qt::UserRole);
+    QCOMPARE(m_vMapper->dataRole(), int(Qt::DisplayRole));
+    QCOMPARE(m_series->slices().at(3)->value(), 0.0);
+
+    QSignalSpy spy(m_vMapper, SIGNAL(dataRoleChanged()));
+    m_vMapper->setDataRole(Qt::UserRole);
+    m_vMapper->setDataRole(Qt::UserRole);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(m_series->slices().at(3)->value(), 103.0);
+    // Labels keep using the display role
+    QCOMPARE(m_series->slices().at(3)->label(), QString("3"));
+
+    m_series->slices().at(3)->setValue(33.0);
+    QCOMPARE(m_model->data(m_model->index(3, 0), Qt::UserRole).toReal(), 33.0);
+    QCOMPARE(m_model->data(m_model->index(3, 0)).toReal(), 0.0);
+}
+
 void tst_qpiemodelmapper::verticalMapperSignals()
 {
     QVPieModelMapper *mapper = new QVPieModelMapper;
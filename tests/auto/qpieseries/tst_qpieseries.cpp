@@ -62,6 +62,7 @@ private slots:
     void take();
     void takeAnimated();
     void calculatedValues();
+    void otherSlice();
     void clickedSignal();
     void hoverSignal();
     void sliceSeries();
@@ -478,6 +479,44 @@ void tst_qpieseries::calculatedValues()
     QCOMPARE(angleSpanSpy.count(), 6);
 }
 
+void tst_qpieseries::otherSlice()
+{
+    QCOMPARE(m_series->otherSliceThreshold(), 0.0);
+    QCOMPARE(m_series->otherSliceLabel(), QString("Other"));
+    m_series->setOtherSliceThreshold(-1.0);
+    QCOMPARE(m_series->otherSliceThreshold(), 0.0);
+
+    m_view->chart()->addSeries(m_series);
+    m_series->append("slice 1", 100);
+    m_series->append("slice 2", 1);
+    m_series->append("slice 3", 1);
+    m_series->setOtherSliceThreshold(10.0);
+    m_series->setOtherSliceLabel("Rest");
+    QCOMPARE(m_series->otherSliceThreshold(), 10.0);
+    QCOMPARE(m_series->otherSliceLabel(), QString("Rest"));
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    // Grouping only changes how the slices are drawn
+    bool ok;
+    QCOMPARE(m_series->count(), 3);
+    verifyCalculatedData(*m_series, &ok);
+    if (!ok)
+        return;
+
+    // The sum follows value changes of single slices
+    QSignalSpy sumSpy(m_series, SIGNAL(sumChanged()));
+    m_series->slices().at(1)->setValue(50);
+    QCOMPARE(sumSpy.count(), 1);
+    QCOMPARE(m_series->sum(), 151.0);
+    verifyCalculatedData(*m_series, &ok);
+    if (!ok)
+        return;
+
+    m_series->setOtherSliceThreshold(0.0);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    verifyCalculatedData(*m_series, &ok);
+}
+
 void tst_qpieseries::verifyCalculatedData(const QPieSeries &series, bool *ok)
 {
     *ok = false;
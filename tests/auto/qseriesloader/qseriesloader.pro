@@ -0,0 +1,4 @@
+!include( ../auto.pri ) {
+    error( "Couldn't find the auto.pri file!" )
+}
+SOURCES += tst_qseriesloader.cpp
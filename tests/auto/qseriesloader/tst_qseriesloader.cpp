@@ -0,0 +1,274 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QSeriesLoader>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QBarSet>
+#include <QtCharts/QCandlestickSeries>
+#include <QtCore/QTemporaryFile>
+#include "tst_definitions.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_QSeriesLoader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void defaults();
+    void csv();
+    void tsv();
+    void binary();
+    void chunks();
+    void cancel();
+    void errors();
+
+private:
+    bool writeFile(QTemporaryFile &file, const QByteArray &data);
+    bool writeRows(QTemporaryFile &file, int rows);
+};
+
+bool tst_QSeriesLoader::writeFile(QTemporaryFile &file, const QByteArray &data)
+{
+    if (!file.open())
+        return false;
+    const bool ok = file.write(data) == data.size();
+    file.close();
+    return ok;
+}
+
+// Writes rows of "index,index / 2" without a header
+bool tst_QSeriesLoader::writeRows(QTemporaryFile &file, int rows)
+{
+    if (!file.open())
+        return false;
+    QByteArray block;
+    for (int row = 0; row < rows; row++) {
+        block += QByteArray::number(row) + ',' + QByteArray::number(row * 0.5) + '\n';
+        if (block.size() > (1 << 20) || row == rows - 1) {
+            if (file.write(block) != block.size())
+                return false;
+            block.clear();
+        }
+    }
+    file.close();
+    return true;
+}
+
+void tst_QSeriesLoader::defaults()
+{
+    QSeriesLoader loader;
+    QCOMPARE(loader.format(), QSeriesLoader::Csv);
+    QCOMPARE(loader.headerRows(), 0);
+    QCOMPARE(loader.valueType(), QSeriesLoader::Double);
+    QCOMPARE(loader.columnCount(), 2);
+    QCOMPARE(loader.offset(), qint64(0));
+    QVERIFY(!loader.isLoading());
+    QCOMPARE(loader.rowCount(), 0);
+}
+
+void tst_QSeriesLoader::csv()
+{
+    QTemporaryFile file;
+    QVERIFY(writeFile(file, "x,y,label,value\r\n"
+                            "1,2.5,a,10\r\n"
+                            "\r\n"
+                            " 2 , -3e2 ,b,\"20\"\n"
+                            "3,not a number,c,30\n"
+                            "4,1.25E-1,d,40\n"
+                            "5,6"));
+
+    QSeriesLoader loader;
+    loader.setHeaderRows(1);
+    QLineSeries series;
+    series.append(100, 100);
+    QBarSet set("set");
+    loader.addSeries(&series, 0, 1);
+    loader.addBarSet(&set, 3);
+    QSignalSpy finishedSpy(&loader, SIGNAL(finished()));
+    QSignalSpy progressSpy(&loader, SIGNAL(progressChanged(qreal)));
+    QSignalSpy replacedSpy(&series, SIGNAL(pointsReplaced()));
+
+    QVERIFY(loader.load(file.fileName()));
+    QVERIFY(loader.isLoading());
+    QVERIFY(finishedSpy.wait(10000));
+    QVERIFY(!loader.isLoading());
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(progressSpy.last().at(0).toReal(), qreal(1.0));
+
+    // The row with an invalid y and the one without a fourth column are skipped
+    QCOMPARE(loader.rowCount(), 3);
+    QCOMPARE(series.count(), 3);
+    QCOMPARE(series.at(0), QPointF(1, 2.5));
+    QCOMPARE(series.at(1), QPointF(2, -300));
+    QCOMPARE(series.at(2), QPointF(4, 0.125));
+    QCOMPARE(set.count(), 3);
+    QCOMPARE(set.at(0), qreal(10));
+    QCOMPARE(set.at(1), qreal(20));
+    QCOMPARE(set.at(2), qreal(40));
+}
+
+void tst_QSeriesLoader::tsv()
+{
+    QTemporaryFile file;
+    QVERIFY(writeFile(file, "1\t2\n3\t4\n5\t6\n"));
+
+    QSeriesLoader loader;
+    loader.setFormat(QSeriesLoader::Tsv);
+    QLineSeries series;
+    loader.addSeries(&series, 1, 0);
+    QSignalSpy finishedSpy(&loader, SIGNAL(finished()));
+    QVERIFY(loader.load(file.fileName()));
+    QVERIFY(finishedSpy.wait(10000));
+    QCOMPARE(series.count(), 3);
+    QCOMPARE(series.at(0), QPointF(2, 1));
+    QCOMPARE(series.at(2), QPointF(6, 5));
+}
+
+void tst_QSeriesLoader::binary()
+{
+    // A four byte header followed by records of five floats
+    QByteArray data("head");
+    for (int row = 0; row < 10; row++) {
+        const float record[5] = { float(row), float(row + 1), float(row + 3),
+                                  float(row - 1), float(row + 2) };
+        data.append(reinterpret_cast<const char *>(record), sizeof(record));
+    }
+    data.append("xx");
+    QTemporaryFile file;
+    QVERIFY(writeFile(file, data));
+
+    QSeriesLoader loader;
+    loader.setFormat(QSeriesLoader::Binary);
+    loader.setValueType(QSeriesLoader::Float);
+    loader.setColumnCount(5);
+    loader.setOffset(4);
+    QCandlestickSeries candlesticks;
+    QLineSeries series;
+    loader.addCandlestickSeries(&candlesticks, 0, 1, 2, 3, 4);
+    loader.addSeries(&series, 0, 4);
+    QSignalSpy finishedSpy(&loader, SIGNAL(finished()));
+    QVERIFY(loader.load(file.fileName()));
+    QVERIFY(finishedSpy.wait(10000));
+
+    QCOMPARE(loader.rowCount(), 10);
+    QCOMPARE(candlesticks.count(), 10);
+    QCOMPARE(series.count(), 10);
+    for (int row = 0; row < 10; row++)
+        QCOMPARE(series.at(row), QPointF(row, row + 2));
+
+    // Columns must be inside the records
+    loader.addSeries(&series, 0, 5);
+    QVERIFY(!loader.load(file.fileName()));
+    QVERIFY(!loader.errorString().isEmpty());
+}
+
+void tst_QSeriesLoader::chunks()
+{
+    // Large enough to be parsed in several chunks, which must be joined in order
+    const int rows = 1000000;
+    QTemporaryFile file;
+    QVERIFY(writeRows(file, rows));
+
+    QSeriesLoader loader;
+    QLineSeries series;
+    loader.addSeries(&series, 0, 1);
+    QSignalSpy finishedSpy(&loader, SIGNAL(finished()));
+    QSignalSpy progressSpy(&loader, SIGNAL(progressChanged(qreal)));
+    QVERIFY(loader.load(file.fileName()));
+    QVERIFY(finishedSpy.wait(60000));
+
+    QVERIFY(progressSpy.count() > 1);
+    for (int i = 1; i < progressSpy.count(); i++)
+        QVERIFY(progressSpy.at(i - 1).at(0).toReal() < progressSpy.at(i).at(0).toReal());
+    QCOMPARE(series.count(), rows);
+    const QVector<QPointF> points = series.pointsVector();
+    for (int row = 0; row < rows; row++) {
+        if (points.at(row) != QPointF(row, row * 0.5))
+            QFAIL(qPrintable(QString("Wrong point at row %1").arg(row)));
+    }
+}
+
+void tst_QSeriesLoader::cancel()
+{
+    QTemporaryFile file;
+    QVERIFY(writeRows(file, 1000000));
+
+    QSeriesLoader loader;
+    QLineSeries series;
+    series.append(1, 1);
+    loader.addSeries(&series, 0, 1);
+    QSignalSpy finishedSpy(&loader, SIGNAL(finished()));
+    QSignalSpy canceledSpy(&loader, SIGNAL(canceled()));
+    QVERIFY(loader.load(file.fileName()));
+    loader.cancel();
+    QVERIFY(canceledSpy.wait(60000));
+    QCOMPARE(finishedSpy.count(), 0);
+    QVERIFY(!loader.isLoading());
+    QCOMPARE(series.count(), 1);
+
+    // The loader can be used again and destroyed while loading
+    QVERIFY(loader.load(file.fileName()));
+    QSeriesLoader *other = new QSeriesLoader();
+    other->addSeries(&series, 0, 1);
+    QVERIFY(other->load(file.fileName()));
+    delete other;
+    QVERIFY(finishedSpy.wait(60000));
+    QCOMPARE(series.count(), 1000000);
+}
+
+void tst_QSeriesLoader::errors()
+{
+    QSeriesLoader loader;
+    QVERIFY(!loader.load(QStringLiteral("this file does not exist")));
+    QVERIFY(!loader.errorString().isEmpty());
+
+    QLineSeries series;
+    loader.addSeries(&series, 0, 1);
+    QVERIFY(!loader.load(QStringLiteral("this file does not exist")));
+    QVERIFY(!loader.isLoading());
+
+    QTemporaryFile file;
+    QVERIFY(writeRows(file, 10));
+    QVERIFY(loader.load(file.fileName()));
+    QVERIFY(!loader.load(file.fileName()));
+    QVERIFY(!loader.errorString().isEmpty());
+
+    loader.clearTargets();
+    QSignalSpy finishedSpy(&loader, SIGNAL(finished()));
+    QVERIFY(finishedSpy.wait(10000));
+    QCOMPARE(series.count(), 0);
+    QVERIFY(!loader.load(file.fileName()));
+}
+
+QTEST_MAIN(tst_QSeriesLoader)
+
+#include "tst_qseriesloader.moc"
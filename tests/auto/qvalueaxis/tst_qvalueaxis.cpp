@@ -30,6 +30,39 @@
 #include "../qabstractaxis/tst_qabstractaxis.h"
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QLineSeries>
+#include <QtCore/QtMath>
+#include <private/chartaxiselement_p.h>
+#include <private/qabstractaxis_p.h>
+#include <cmath>
+
+class TestValueAxis : public QValueAxis
+{
+public:
+    ChartAxisElement *item() const { return d_ptr->axisItem(); }
+};
+
+// Gives access to the tick items of an axis item
+class AxisElementAccess : public ChartAxisElement
+{
+public:
+    static QList<QGraphicsItem *> labels(ChartAxisElement *element)
+    {
+        return (element->*&AxisElementAccess::labelItems)();
+    }
+
+    static QList<QGraphicsItem *> gridLines(ChartAxisElement *element)
+    {
+        return (element->*&AxisElementAccess::gridItems)();
+    }
+
+    static int visibleCount(const QList<QGraphicsItem *> &items)
+    {
+        int count = 0;
+        foreach (QGraphicsItem *item, items)
+            count += item->isVisible() ? 1 : 0;
+        return count;
+    }
+};
 
 class tst_QValueAxis: public tst_QAbstractAxis
 {
@@ -70,6 +103,10 @@ private slots:
     void autoscale();
     void reverse();
     void labels();
+    void tickType();
+    void automaticTickValues_data();
+    void automaticTickValues();
+    void tickItemPool();
 
 private:
     QValueAxis* m_valuesaxis;
@@ -462,6 +499,126 @@ void tst_QValueAxis::labels()
     QCOMPARE(originalStrings, updatedStrings);
 }
 
+void tst_QValueAxis::tickType()
+{
+    QCOMPARE(m_valuesaxis->tickType(), QValueAxis::TicksFixed);
+
+    QSignalSpy spy(m_valuesaxis, SIGNAL(tickTypeChanged(QValueAxis::TickType)));
+    m_valuesaxis->setTickType(QValueAxis::TicksAutomatic);
+    m_valuesaxis->setTickType(QValueAxis::TicksAutomatic);
+    QCOMPARE(m_valuesaxis->tickType(), QValueAxis::TicksAutomatic);
+    QCOMPARE(spy.count(), 1);
+
+    m_valuesaxis->setRange(0.3, 97.0);
+    m_chart->setAxisX(m_valuesaxis, m_series);
+    m_view->resize(300, 300);
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+
+    m_valuesaxis->setTickType(QValueAxis::TicksFixed);
+    QCOMPARE(spy.count(), 2);
+}
+
+void tst_QValueAxis::automaticTickValues_data()
+{
+    QTest::addColumn<qreal>("min");
+    QTest::addColumn<qreal>("max");
+    QTest::newRow("0.3 - 97.0") << 0.3 << 97.0;
+    QTest::newRow("-1.5 - 1.5") << -1.5 << 1.5;
+    QTest::newRow("-0.00025 - 0.00075") << -0.00025 << 0.00075;
+    // min / step is far outside the int range
+    QTest::newRow("1e12 - 1e12 + 50") << 1e12 << 1e12 + 50;
+    QTest::newRow("-1e15 - -1e15 + 3") << -1e15 << -1e15 + 3;
+}
+
+void tst_QValueAxis::automaticTickValues()
+{
+    QFETCH(qreal, min);
+    QFETCH(qreal, max);
+
+    m_valuesaxis->setTickType(QValueAxis::TicksAutomatic);
+    m_valuesaxis->setLabelFormat("x%.17g");
+    m_valuesaxis->setRange(min, max);
+    m_chart->setAxisX(m_valuesaxis, m_series);
+    m_view->resize(800, 300);
+    m_view->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_view));
+    QTest::qWait(100);
+
+    QVector<qreal> ticks;
+    for (QGraphicsItem *i : m_chart->scene()->items()) {
+        if (QGraphicsTextItem *text = qgraphicsitem_cast<QGraphicsTextItem *>(i)) {
+            const QString label = text->toPlainText();
+            if (label.startsWith(QLatin1Char('x')))
+                ticks << label.mid(1).toDouble();
+        }
+    }
+    std::sort(ticks.begin(), ticks.end());
+
+    QVERIFY(ticks.size() >= 2);
+    const qreal step = ticks.at(1) - ticks.at(0);
+    QVERIFY(step > 0);
+    const qreal mantissa = step / qPow(10.0, std::floor(std::log10(step)));
+    QVERIFY(qFuzzyCompare(mantissa, 1.0) || qFuzzyCompare(mantissa, 2.0)
+            || qFuzzyCompare(mantissa, 5.0));
+    for (int i = 0; i < ticks.size(); ++i) {
+        QVERIFY(ticks.at(i) >= min && ticks.at(i) <= max);
+        const qreal index = (ticks.at(i) - ticks.at(0)) / step;
+        QVERIFY(qAbs(index - i) < 1e-6);
+        const qreal multiple = ticks.at(i) / step;
+        QVERIFY(qAbs(multiple - std::round(multiple)) < 1e-6);
+    }
+    // No interval is left without a tick
+    QVERIFY(ticks.first() - min < step);
+    QVERIFY(max - ticks.last() < step);
+}
+
+void tst_QValueAxis::tickItemPool()
+{
+    TestValueAxis *axis = new TestValueAxis();
+    QLineSeries *series = new QLineSeries();
+    *series << QPointF(0, 0) << QPointF(100, 100);
+    QChartView view;
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    view.chart()->setAxisX(axis, series);
+    axis->setRange(0, 100);
+    axis->setTickCount(11);
+    view.resize(400, 300);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QVERIFY(axis->item());
+    QTRY_COMPARE(AxisElementAccess::visibleCount(AxisElementAccess::labels(axis->item())), 11);
+    const QList<QGraphicsItem *> labels = AxisElementAccess::labels(axis->item());
+    const QList<QGraphicsItem *> gridLines = AxisElementAccess::gridLines(axis->item());
+    QCOMPARE(labels.count(), 11);
+
+    // Fewer ticks hide the items that are no longer needed
+    axis->setTickCount(5);
+    QTRY_COMPARE(AxisElementAccess::visibleCount(AxisElementAccess::labels(axis->item())), 5);
+    QCOMPARE(AxisElementAccess::visibleCount(AxisElementAccess::gridLines(axis->item())), 5);
+    QCOMPARE(AxisElementAccess::labels(axis->item()), labels);
+
+    // More ticks show the hidden items again instead of creating new ones
+    axis->setTickCount(11);
+    QTRY_COMPARE(AxisElementAccess::visibleCount(AxisElementAccess::labels(axis->item())), 11);
+    QCOMPARE(AxisElementAccess::labels(axis->item()), labels);
+    QCOMPARE(AxisElementAccess::gridLines(axis->item()), gridLines);
+    QCOMPARE(AxisElementAccess::visibleCount(gridLines), 11);
+
+    // A sharp drop trims the hidden items. Labels that would overlap their neighbors are
+    // hidden at 60 ticks, so the grid lines tell when the new layout is in place.
+    axis->setTickCount(60);
+    QTRY_COMPARE(AxisElementAccess::visibleCount(AxisElementAccess::gridLines(axis->item())), 60);
+    QCOMPARE(AxisElementAccess::labels(axis->item()).count(), 60);
+    QCOMPARE(AxisElementAccess::labels(axis->item()).mid(0, 11), labels);
+    axis->setTickCount(2);
+    QTRY_COMPARE(AxisElementAccess::visibleCount(AxisElementAccess::labels(axis->item())), 2);
+    QCOMPARE(AxisElementAccess::labels(axis->item()).count(), 2 + 16);
+    QCOMPARE(AxisElementAccess::gridLines(axis->item()).count(), 2 + 16);
+    QCOMPARE(AxisElementAccess::labels(axis->item()).mid(0, 2), labels.mid(0, 2));
+}
+
 QTEST_MAIN(tst_QValueAxis)
 #include "tst_qvalueaxis.moc"
 
@@ -36,11 +36,94 @@
 #include <QtCharts/QLineSeries>
 #include <QtCharts/QVXYModelMapper>
 #include <QtCharts/QHXYModelMapper>
+#include <QtCharts/QChartModelColumns>
 #include <QtGui/QStandardItemModel>
 #include "tst_definitions.h"
 
 QT_CHARTS_USE_NAMESPACE
 
+// Generates its values on the fly.
+class GeneratedTableModel : public QAbstractTableModel
+{
+public:
+    GeneratedTableModel(int rowCount, QObject *parent = 0)
+        : QAbstractTableModel(parent), m_rowCount(rowCount), m_offset(0) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const
+    { return parent.isValid() ? 0 : m_rowCount; }
+    int columnCount(const QModelIndex &parent = QModelIndex()) const
+    { return parent.isValid() ? 0 : 2; }
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const
+    {
+        if (role != Qt::DisplayRole)
+            return QVariant();
+        return index.column() == 0 ? qreal(index.row()) : qreal(index.row() + m_offset);
+    }
+
+    void setOffset(int offset)
+    {
+        m_offset = offset;
+        emit dataChanged(index(0, 0), index(m_rowCount - 1, 1));
+    }
+
+private:
+    int m_rowCount;
+    int m_offset;
+};
+
+// Keeps x and y interleaved in one array and exposes them for Qt::UserRole. data() returns
+// different values for that role and counts the reads, so the tests can tell which path was used.
+class ColumnTableModel : public QAbstractTableModel, public QChartModelColumns
+{
+    Q_OBJECT
+    Q_INTERFACES(QtCharts::QChartModelColumns)
+
+public:
+    ColumnTableModel(int rowCount, QObject *parent = 0)
+        : QAbstractTableModel(parent), m_values(rowCount * 2), m_userRoleReads(0)
+    {
+        for (int i = 0; i < m_values.size(); i++)
+            m_values[i] = i;
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const
+    { return parent.isValid() ? 0 : m_values.size() / 2; }
+    int columnCount(const QModelIndex &parent = QModelIndex()) const
+    { return parent.isValid() ? 0 : 2; }
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const
+    {
+        const qreal value = m_values.at(index.row() * 2 + index.column());
+        if (role == Qt::DisplayRole)
+            return QString::number(-value);
+        if (role == Qt::UserRole) {
+            m_userRoleReads++;
+            return value + 1000;
+        }
+        return QVariant();
+    }
+
+    int userRoleReads() const { return m_userRoleReads; }
+
+    const qreal *columnData(int column, int role, int *stride) const
+    {
+        if (role != Qt::UserRole)
+            return nullptr;
+        *stride = 2;
+        return m_values.constData() + column;
+    }
+
+    void scale(qreal factor)
+    {
+        for (int i = 0; i < m_values.size(); i++)
+            m_values[i] *= factor;
+        emit dataChanged(index(0, 0), index(rowCount() - 1, 1));
+    }
+
+private:
+    QVector<qreal> m_values;
+    mutable int m_userRoleReads;
+};
+
 class tst_qxymodelmapper : public QObject
 {
     Q_OBJECT
@@ -73,6 +156,8 @@ class tst_qxymodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void modelUpdateAll();
+    void modelColumns();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -544,6 +629,63 @@ void tst_qxymodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qxymodelmapper::modelUpdateAll()
+{
+    const int rowCount = 1000;
+    GeneratedTableModel model(rowCount);
+    QLineSeries series;
+    QVXYModelMapper mapper;
+    mapper.setXColumn(0);
+    mapper.setYColumn(1);
+    mapper.setModel(&model);
+    mapper.setSeries(&series);
+    QCOMPARE(series.count(), rowCount);
+
+    QSignalSpy replacedSpy(&series, SIGNAL(pointsReplaced()));
+    QSignalSpy pointReplacedSpy(&series, SIGNAL(pointReplaced(int)));
+
+    // A change of the whole model replaces the points at once
+    model.setOffset(10);
+
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(pointReplacedSpy.count(), 0);
+    QCOMPARE(series.count(), rowCount);
+    QCOMPARE(series.at(0), QPointF(0, 10));
+    QCOMPARE(series.at(rowCount - 1), QPointF(rowCount - 1, rowCount + 9));
+}
+
+void tst_qxymodelmapper::modelColumns()
+{
+    ColumnTableModel model(100);
+    QLineSeries series;
+    QVXYModelMapper mapper;
+    QSignalSpy roleSpy(&mapper, SIGNAL(dataRoleChanged()));
+    mapper.setXColumn(0);
+    mapper.setYColumn(1);
+    mapper.setFirstRow(10);
+    mapper.setRowCount(50);
+    mapper.setModel(&model);
+    mapper.setSeries(&series);
+
+    // Display role goes through data()
+    QCOMPARE(mapper.dataRole(), int(Qt::DisplayRole));
+    QCOMPARE(series.count(), 50);
+    QCOMPARE(series.at(0), QPointF(-20, -21));
+
+    // The user role is copied from the arrays without calling data()
+    mapper.setDataRole(Qt::UserRole);
+    QCOMPARE(roleSpy.count(), 1);
+    QCOMPARE(series.count(), 50);
+    QCOMPARE(series.at(0), QPointF(20, 21));
+    QCOMPARE(series.at(49), QPointF(118, 119));
+
+    model.scale(2);
+    QCOMPARE(series.count(), 50);
+    QCOMPARE(series.at(0), QPointF(40, 42));
+    QCOMPARE(series.at(49), QPointF(236, 238));
+    QCOMPARE(model.userRoleReads(), 0);
+}
+
 void tst_qxymodelmapper::verticalMapperSignals()
 {
     QVXYModelMapper *mapper = new QVXYModelMapper;
@@ -0,0 +1,11 @@
+!include( ../tests.pri ) {
+    error( "Couldn't find the tests.pri file!" )
+}
+
+CONFIG += benchmark
+QT += testlib widgets
+
+!contains(TARGET, ^tst_bench_.*):TARGET = $$join(TARGET,,"tst_bench_")
+
+target.path = $$[QT_INSTALL_TESTS]/charts/benchmarks/$$TARGET
+INSTALLS += target
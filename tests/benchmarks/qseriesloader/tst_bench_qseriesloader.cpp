@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QSeriesLoader>
+#include <QtCharts/QLineSeries>
+#include <QtCore/QTemporaryFile>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_QSeriesLoader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void loadCsv_data();
+    void loadCsv();
+
+private:
+    bool writeRows(QTemporaryFile &file, int rows);
+};
+
+// Writes rows of "index,index / 2" without a header
+bool tst_QSeriesLoader::writeRows(QTemporaryFile &file, int rows)
+{
+    if (!file.open())
+        return false;
+    QByteArray block;
+    for (int row = 0; row < rows; row++) {
+        block += QByteArray::number(row) + ',' + QByteArray::number(row * 0.5) + '\n';
+        if (block.size() > (1 << 20) || row == rows - 1) {
+            if (file.write(block) != block.size())
+                return false;
+            block.clear();
+        }
+    }
+    file.close();
+    return true;
+}
+
+void tst_QSeriesLoader::loadCsv_data()
+{
+    QTest::addColumn<int>("rows");
+    QTest::newRow("1M") << 1000000;
+    // Set QTCHARTS_LOADER_BENCHMARK_ROWS to 100000000 to measure loading a 100M-row file
+    const int rows = qEnvironmentVariableIntValue("QTCHARTS_LOADER_BENCHMARK_ROWS");
+    if (rows > 0)
+        QTest::newRow(qPrintable(QString::number(rows))) << rows;
+}
+
+void tst_QSeriesLoader::loadCsv()
+{
+    QFETCH(int, rows);
+    QTemporaryFile file;
+    QVERIFY(writeRows(file, rows));
+
+    QSeriesLoader loader;
+    QLineSeries series;
+    loader.addSeries(&series, 0, 1);
+    QSignalSpy finishedSpy(&loader, SIGNAL(finished()));
+    QBENCHMARK {
+        QVERIFY(loader.load(file.fileName()));
+        QVERIFY(finishedSpy.wait(600000));
+    }
+    QCOMPARE(series.count(), rows);
+}
+
+QTEST_MAIN(tst_QSeriesLoader)
+
+#include "tst_bench_qseriesloader.moc"
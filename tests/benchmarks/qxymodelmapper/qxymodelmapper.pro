@@ -0,0 +1,4 @@
+!include( ../benchmarks.pri ) {
+    error( "Couldn't find the benchmarks.pri file!" )
+}
+SOURCES += tst_bench_qxymodelmapper.cpp
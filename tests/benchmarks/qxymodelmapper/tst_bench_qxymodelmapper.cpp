@@ -0,0 +1,95 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QVXYModelMapper>
+#include <QtCore/QAbstractTableModel>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Generates its values on the fly, so that mapping a large model is cheap to set up.
+class GeneratedTableModel : public QAbstractTableModel
+{
+public:
+    GeneratedTableModel(int rowCount, QObject *parent = 0)
+        : QAbstractTableModel(parent), m_rowCount(rowCount), m_offset(0) {}
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const
+    { return parent.isValid() ? 0 : m_rowCount; }
+    int columnCount(const QModelIndex &parent = QModelIndex()) const
+    { return parent.isValid() ? 0 : 2; }
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const
+    {
+        if (role != Qt::DisplayRole)
+            return QVariant();
+        return index.column() == 0 ? qreal(index.row()) : qreal(index.row() + m_offset);
+    }
+
+    void setOffset(int offset)
+    {
+        m_offset = offset;
+        emit dataChanged(index(0, 0), index(m_rowCount - 1, 1));
+    }
+
+private:
+    int m_rowCount;
+    int m_offset;
+};
+
+class tst_QXYModelMapper : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void modelUpdateAll();
+};
+
+void tst_QXYModelMapper::modelUpdateAll()
+{
+    const int rowCount = 1000000;
+    GeneratedTableModel model(rowCount);
+    QLineSeries series;
+    QVXYModelMapper mapper;
+    mapper.setXColumn(0);
+    mapper.setYColumn(1);
+    mapper.setModel(&model);
+    mapper.setSeries(&series);
+    QCOMPARE(series.count(), rowCount);
+
+    int offset = 0;
+    QBENCHMARK {
+        model.setOffset(++offset);
+    }
+    QCOMPARE(series.at(rowCount - 1), QPointF(rowCount - 1, rowCount - 1 + offset));
+}
+
+QTEST_MAIN(tst_QXYModelMapper)
+
+#include "tst_bench_qxymodelmapper.moc"